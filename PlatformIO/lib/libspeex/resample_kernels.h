@@ -0,0 +1,188 @@
+/**
+   @file resample_kernels.h
+   @brief Fixed point inner product kernels of the resampler
+
+   Picks one kernel set for inner_product_single and interpolate_product_single at compile
+   time, the way resample_sse.h and resample_neon.h do for their targets:
+
+   USE_KERNEL_UNROLLED  four accumulators, portable C
+   USE_KERNEL_VECTOR    GCC vector extensions, 4 x 32 bit lanes
+   USE_KERNEL_PAIRED    two samples per 32 bit load, for cores without unaligned loads
+
+   Without one of these, Xtensa builds take USE_KERNEL_PAIRED and everything else keeps the
+   generic loops of resample.c. All kernels add up the same 32 bit products as the generic
+   loops and saturate the same way, so the output is bit-exact. filt_len is always a multiple
+   of 8, which the unrolling relies on.
+*/
+
+#ifndef RESAMPLE_KERNELS_H
+#define RESAMPLE_KERNELS_H
+
+#if defined(FIXED_POINT)
+
+#if !defined(USE_KERNEL_UNROLLED) && !defined(USE_KERNEL_VECTOR) && !defined(USE_KERNEL_PAIRED) && defined(__XTENSA__)
+#define USE_KERNEL_PAIRED
+#endif
+
+#include <stdint.h>
+
+/* the tail of interpolate_product_single, shared by all kernels */
+static inline spx_word32_t interpolate_sum(const spx_word32_t accum[4], const spx_word16_t *frac)
+{
+   spx_word32_t sum = MULT16_32_Q15(frac[0],SHR32(accum[0], 1)) + MULT16_32_Q15(frac[1],SHR32(accum[1], 1)) + MULT16_32_Q15(frac[2],SHR32(accum[2], 1)) + MULT16_32_Q15(frac[3],SHR32(accum[3], 1));
+   return SATURATE32PSHR(sum, 15, 32767);
+}
+
+#if defined(USE_KERNEL_UNROLLED)
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline spx_word32_t inner_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len)
+{
+   unsigned int i;
+   spx_word32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+   for (i=0;i<len;i+=4)
+   {
+      sum0 += MULT16_16(a[i], b[i]);
+      sum1 += MULT16_16(a[i+1], b[i+1]);
+      sum2 += MULT16_16(a[i+2], b[i+2]);
+      sum3 += MULT16_16(a[i+3], b[i+3]);
+   }
+   return SATURATE32PSHR(sum0 + sum1 + sum2 + sum3, 15, 32767);
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline spx_word32_t interpolate_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len, const spx_uint32_t oversample, const spx_word16_t *frac)
+{
+   unsigned int i;
+   spx_word32_t accum[4] = {0,0,0,0};
+   for (i=0;i<len;i+=2)
+   {
+      const spx_word16_t *b0 = b + i*oversample;
+      const spx_word16_t *b1 = b0 + oversample;
+      accum[0] += MULT16_16(a[i], b0[0]) + MULT16_16(a[i+1], b1[0]);
+      accum[1] += MULT16_16(a[i], b0[1]) + MULT16_16(a[i+1], b1[1]);
+      accum[2] += MULT16_16(a[i], b0[2]) + MULT16_16(a[i+1], b1[2]);
+      accum[3] += MULT16_16(a[i], b0[3]) + MULT16_16(a[i+1], b1[3]);
+   }
+   return interpolate_sum(accum, frac);
+}
+
+#elif defined(USE_KERNEL_VECTOR)
+
+typedef spx_int32_t resample_v4si __attribute__((vector_size(16)));
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline spx_word32_t inner_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len)
+{
+   unsigned int i;
+   resample_v4si sum = {0,0,0,0};
+   for (i=0;i<len;i+=4)
+   {
+      const resample_v4si va = {a[i], a[i+1], a[i+2], a[i+3]};
+      const resample_v4si vb = {b[i], b[i+1], b[i+2], b[i+3]};
+      sum += va * vb;
+   }
+   return SATURATE32PSHR(sum[0] + sum[1] + sum[2] + sum[3], 15, 32767);
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline spx_word32_t interpolate_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len, const spx_uint32_t oversample, const spx_word16_t *frac)
+{
+   unsigned int i;
+   resample_v4si sum = {0,0,0,0};
+   spx_word32_t accum[4];
+   for (i=0;i<len;i++)
+   {
+      const resample_v4si vb = {b[0], b[1], b[2], b[3]};
+      sum += a[i] * vb;
+      b += oversample;
+   }
+   accum[0] = sum[0];
+   accum[1] = sum[1];
+   accum[2] = sum[2];
+   accum[3] = sum[3];
+   return interpolate_sum(accum, frac);
+}
+
+#elif defined(USE_KERNEL_PAIRED)
+
+/* Input samples j and j+1 as one little endian 32 bit word. When the input is not 32 bit
+   aligned, each pair is put together from the upper half of the word before and the lower
+   half of the word after, so every load stays aligned. */
+#define PAIR_LO(w) ((spx_word16_t)((w) & 0xffff))
+#define PAIR_HI(w) ((spx_word16_t)((w) >> 16))
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+/* a is the filter row, aligned as every row is filt_len long; b is the input */
+static inline spx_word32_t inner_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len)
+{
+   unsigned int i;
+   spx_word32_t sum0 = 0, sum1 = 0;
+   const uint32_t *pa = (const uint32_t *)a;
+   if (((uintptr_t)b & 3) == 0)
+   {
+      const uint32_t *pb = (const uint32_t *)b;
+      for (i=0;i<len/2;i++)
+      {
+         const uint32_t wa = pa[i], wb = pb[i];
+         sum0 += MULT16_16(PAIR_LO(wa), PAIR_LO(wb));
+         sum1 += MULT16_16(PAIR_HI(wa), PAIR_HI(wb));
+      }
+   } else {
+      /* the word before b holds b[0] in its upper half, it lies inside the resampler memory */
+      const uint32_t *pb = (const uint32_t *)(b - 1);
+      uint32_t prev = pb[0];
+      /* the last word would reach one sample past the input, that sample is read on its own */
+      for (i=0;i<len/2-1;i++)
+      {
+         const uint32_t wa = pa[i], wb = pb[i+1];
+         sum0 += MULT16_16(PAIR_LO(wa), PAIR_HI(prev));
+         sum1 += MULT16_16(PAIR_HI(wa), PAIR_LO(wb));
+         prev = wb;
+      }
+      sum0 += MULT16_16(PAIR_LO(pa[i]), PAIR_HI(prev));
+      sum1 += MULT16_16(PAIR_HI(pa[i]), b[len-1]);
+   }
+   return SATURATE32PSHR(sum0 + sum1, 15, 32767);
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+/* a is the input, b steps through the interpolation table with oversample, unaligned */
+static inline spx_word32_t interpolate_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len, const spx_uint32_t oversample, const spx_word16_t *frac)
+{
+   unsigned int i;
+   spx_word32_t accum[4] = {0,0,0,0};
+   spx_word16_t x0, x1;
+   const uint32_t *pa = (const uint32_t *)((uintptr_t)a & ~(uintptr_t)3);
+   const int aligned = ((uintptr_t)a & 3) == 0;
+   uint32_t prev = aligned ? 0 : pa[0];
+   for (i=0;i<len;i+=2)
+   {
+      if (aligned)
+      {
+         const uint32_t w = pa[i/2];
+         x0 = PAIR_LO(w);
+         x1 = PAIR_HI(w);
+      } else if (i+2 < len) {
+         const uint32_t w = pa[i/2+1];
+         x0 = PAIR_HI(prev);
+         x1 = PAIR_LO(w);
+         prev = w;
+      } else {
+         x0 = PAIR_HI(prev);
+         x1 = a[i+1];
+      }
+      accum[0] += MULT16_16(x0, b[0]) + MULT16_16(x1, b[oversample]);
+      accum[1] += MULT16_16(x0, b[1]) + MULT16_16(x1, b[oversample+1]);
+      accum[2] += MULT16_16(x0, b[2]) + MULT16_16(x1, b[oversample+2]);
+      accum[3] += MULT16_16(x0, b[3]) + MULT16_16(x1, b[oversample+3]);
+      b += 2*oversample;
+   }
+   return interpolate_sum(accum, frac);
+}
+
+#endif
+
+#endif /* FIXED_POINT */
+
+#endif /* RESAMPLE_KERNELS_H */
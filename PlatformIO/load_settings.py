@@ -48,6 +48,9 @@ if os.path.isfile(settings):
 
         staticIp = True
 
+    if ("ntpServer" in config[sectionGeneral]) :
+        cpp_defines.append(("NTP_SERVER", "\\\"" + config[sectionGeneral]["ntpServer"] + "\\\""))
+
     if ("scanStrongestAP" in config[sectionWifi]) :
         cpp_defines.append(("SCAN_STRONGEST_AP", "\\\"" + config[sectionWifi]["scanStrongestAP"] + "\\\""))
 
@@ -0,0 +1,43 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// gain of convertI2s32ToPcm16 which keeps the level of the mic
+const int32_t I2S_UNITY_GAIN = 16;
+
+/**
+ * Gain for convertI2s32ToPcm16 from the gain setting of the config, where 5 (the default)
+ * leaves the level alone and every step up or down is 6 dB, from -24 dB at 1 to +42 dB at 12
+ */
+inline int32_t i2sGainFromSetting(int setting)
+{
+    setting = setting < 1 ? 1 : (setting > 12 ? 12 : setting);
+    return setting >= 5 ? I2S_UNITY_GAIN << (setting - 5) : I2S_UNITY_GAIN >> (5 - setting);
+}
+
+/**
+ * @brief Convert 32 bit I2S slots to 16 bit PCM with gain
+ *
+ * I2S microphones like the INMP441 send 24 bit samples left aligned in 32 bit slots.
+ * The top 20 bits are kept, multiplied by gain in 1/16 (I2S_UNITY_GAIN gives the top 16
+ * bits of the sample) and saturated to 16 bit, so a boost brings up the precision below.
+ * The output may overlap the input (out == (int16_t *)in), every slot is read before
+ * its half of the buffer is written.
+ */
+inline void convertI2s32ToPcm16(const int32_t *in, int16_t *out, size_t count, int32_t gain)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        // (2^19 * 4095) still fits in 32 bits, so gains up to 4095 can not overflow
+        int32_t sample = ((in[i] >> 12) * gain) >> 8;
+        if (sample > 32767)
+        {
+            sample = 32767;
+        }
+        else if (sample < -32768)
+        {
+            sample = -32768;
+        }
+        out[i] = (int16_t)sample;
+    }
+}
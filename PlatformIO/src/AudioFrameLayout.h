@@ -0,0 +1,37 @@
+#pragma once
+
+/**
+ * @brief How the captured audio is split into audioFrame messages
+ *
+ * A frame is made of whole device reads, a message is frame_ms worth of audio, but never
+ * more than maxBytes and never less than what fits evenly into one read. With a read
+ * larger than a message the frame is that one read, split into several messages.
+ * Plain C++, so the host benchmarks size their messages the same way.
+ */
+struct AudioFrameLayout
+{
+    int messageBytes; // sample bytes per published message
+    int frameBytes;   // sample bytes per captured frame, a whole number of messages
+
+    AudioFrameLayout(int readBytes, int bytesPerSecond, int frame_ms, int maxBytes)
+    {
+        messageBytes = bytesPerSecond * frame_ms / 1000;
+        if (messageBytes > maxBytes)
+        {
+            messageBytes = maxBytes;
+        }
+        if (messageBytes >= readBytes)
+        {
+            messageBytes -= messageBytes % readBytes;
+            frameBytes = messageBytes;
+        }
+        else
+        {
+            if (readBytes % messageBytes != 0)
+            {
+                messageBytes = readBytes;
+            }
+            frameBytes = readBytes;
+        }
+    }
+};
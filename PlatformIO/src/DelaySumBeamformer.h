@@ -0,0 +1,113 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+/**
+ * @brief Fixed-point delay-and-sum beamformer for a microphone array
+ *
+ * Takes the interleaved samples of all channels (CHANNELS values per sample, as the array
+ * delivers them), delays each channel by a whole number of samples and sums them with Q15
+ * weights. The channels are copied into a channel-major history first, so the delay and sum
+ * loops walk through contiguous memory. The last MAX_DELAY samples of each channel are kept,
+ * delays therefore reach back into the previous block.
+ */
+template <int CHANNELS, int MAX_SAMPLES, int MAX_DELAY>
+class DelaySumBeamformer
+{
+    int16_t history[CHANNELS][MAX_DELAY + MAX_SAMPLES];
+    int32_t sum[MAX_SAMPLES];
+    int delays[CHANNELS];
+    int16_t weights[CHANNELS];
+    size_t lastCount = 0;
+
+public:
+    DelaySumBeamformer()
+    {
+        memset(history, 0, sizeof(history));
+        for (int c = 0; c < CHANNELS; c++)
+        {
+            delays[c] = 0;
+            weights[c] = 32768 / CHANNELS;
+        }
+    }
+
+    /* Delay of each channel in samples, clamped to 0..MAX_DELAY */
+    void setDelays(const int *channelDelays)
+    {
+        for (int c = 0; c < CHANNELS; c++)
+        {
+            delays[c] = channelDelays[c] < 0 ? 0 : (channelDelays[c] > MAX_DELAY ? MAX_DELAY : channelDelays[c]);
+        }
+    }
+
+    /* Weight of each channel in Q15, for unity gain they add up to 32768, which they must not exceed */
+    void setWeights(const int16_t *channelWeights)
+    {
+        memcpy(weights, channelWeights, sizeof(weights));
+    }
+
+    /**
+     * Steer to a look direction in the plane of the array.
+     * x and y are the positions of the channels in meters, azimuth is in degrees. A plane wave
+     * from that direction reaches the channel closest to the source first, that channel gets
+     * the longest delay, so all channels line up.
+     */
+    void steer(const float *x, const float *y, float azimuth, int rate)
+    {
+        const float speedOfSound = 343.0f;
+        const float ux = cosf(azimuth * (float)M_PI / 180.0f);
+        const float uy = sinf(azimuth * (float)M_PI / 180.0f);
+        // how many samples earlier than the array center each channel hears the wave
+        float lead[CHANNELS];
+        float minLead = 0.0f;
+        for (int c = 0; c < CHANNELS; c++)
+        {
+            lead[c] = (x[c] * ux + y[c] * uy) / speedOfSound * rate;
+            minLead = (c == 0 || lead[c] < minLead) ? lead[c] : minLead;
+        }
+        int channelDelays[CHANNELS];
+        for (int c = 0; c < CHANNELS; c++)
+        {
+            channelDelays[c] = (int)lroundf(lead[c] - minLead);
+        }
+        setDelays(channelDelays);
+    }
+
+    /* Beam of count samples (at most MAX_SAMPLES) of the interleaved input written to out */
+    void process(const int16_t *interleaved, size_t count, int16_t *out)
+    {
+        if (count > MAX_SAMPLES)
+        {
+            count = MAX_SAMPLES;
+        }
+        // keep the tail of the previous block, then append the new samples channel by channel
+        for (int c = 0; c < CHANNELS; c++)
+        {
+            int16_t *channel = history[c];
+            memmove(channel, &channel[lastCount], MAX_DELAY * sizeof(int16_t));
+            const int16_t *in = &interleaved[c];
+            for (size_t s = 0; s < count; s++)
+            {
+                channel[MAX_DELAY + s] = in[s * CHANNELS];
+            }
+        }
+        lastCount = count;
+        memset(sum, 0, count * sizeof(int32_t));
+        for (int c = 0; c < CHANNELS; c++)
+        {
+            const int16_t *delayed = &history[c][MAX_DELAY - delays[c]];
+            const int32_t weight = weights[c];
+            for (size_t s = 0; s < count; s++)
+            {
+                sum[s] += delayed[s] * weight;
+            }
+        }
+        for (size_t s = 0; s < count; s++)
+        {
+            int32_t sample = sum[s] >> 15;
+            out[s] = sample > 32767 ? 32767 : (sample < -32768 ? -32768 : sample);
+        }
+    }
+};
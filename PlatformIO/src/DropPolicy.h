@@ -0,0 +1,61 @@
+#pragma once
+#include <stdint.h>
+#include "SpscQueue.h"
+
+// What happens to audio frames when the publishing falls behind the capture
+enum {
+    DROP_NEWEST = 0, // frames which do not fit in the queue are dropped
+    DROP_OLDEST = 1, // queued frames older than drop_ms are dropped
+    DROP_BLOCK = 2   // the capture waits up to drop_ms for room, then drops the frame
+};
+
+inline bool isValidDropPolicy(int policy)
+{
+    return policy == DROP_NEWEST || policy == DROP_OLDEST || policy == DROP_BLOCK;
+}
+
+/**
+ * Capture side of the drop policy: the slot for the next frame, or NULL if the frame is to
+ * be dropped. With DROP_BLOCK this waits up to drop_ms for the publisher to release a slot.
+ * now() returns the time in microseconds, wait(micros) blocks until the publisher released
+ * a frame or micros have passed.
+ */
+template <typename T, size_t S, typename Now, typename Wait>
+T *acquireFrame(SpscQueue<T, S> &queue, int policy, int drop_ms, Now now, Wait wait)
+{
+    T *frame = queue.acquire();
+    if (frame == NULL && policy == DROP_BLOCK)
+    {
+        const int64_t deadline = now() + (int64_t)drop_ms * 1000;
+        int64_t current;
+        while (frame == NULL && (current = now()) < deadline)
+        {
+            wait(deadline - current);
+            frame = queue.acquire();
+        }
+    }
+    return frame;
+}
+
+/**
+ * Publish side of the drop policy: the oldest frame to publish, or NULL if there is none.
+ * With DROP_OLDEST the frames queued more than drop_ms before now (in microseconds, the
+ * clock of their queuedTime) are released first and added to dropped, which keeps the
+ * latency bound: they are of no use anymore.
+ */
+template <typename T, size_t S, typename Counter>
+T *frontFrame(SpscQueue<T, S> &queue, int policy, int drop_ms, int64_t now, Counter &dropped)
+{
+    T *frame = queue.front();
+    if (policy == DROP_OLDEST)
+    {
+        const int64_t oldest = now - (int64_t)drop_ms * 1000;
+        while (frame != NULL && frame->queuedTime < oldest)
+        {
+            queue.release();
+            dropped++;
+            frame = queue.front();
+        }
+    }
+    return frame;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * @brief How capture and playback share the audio device
+ *
+ * The audioGroup bits: PLAY while I2Stask plays, STREAM while CaptureTask streams. A half
+ * duplex device has one port for both directions, playing stops the stream and both tasks
+ * hold wbSemaphore while they use the port. A full duplex device keeps streaming while it
+ * plays, the capture has a port of its own and does not take wbSemaphore.
+ * Plain C++, so the host tests gate their simulated device the same way.
+ */
+const int PLAY = 1 << 0;
+const int STREAM = 1 << 1;
+// audioData drained down to its low watermark, for a push waiting for room
+const int SPACE = 1 << 2;
+
+/* Capture keeps running while playing, if configured and the device can */
+inline bool isFullDuplex(bool configured, bool deviceCan) { return configured && deviceCan; }
+
+/* The bits a PlayAudioEvent clears before it sets PLAY */
+inline int playClearsBits(bool duplex) { return duplex ? 0 : STREAM; }
+
+/* Whether CaptureTask holds wbSemaphore around a frame */
+inline bool captureTakesSemaphore(bool duplex) { return !duplex; }
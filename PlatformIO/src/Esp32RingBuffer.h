@@ -1,6 +1,8 @@
 #pragma once
 #include <Arduino.h>
 #include <freertos/ringbuf.h>
+#include <algorithm>
+#include <atomic>
 
 
 /**
@@ -14,6 +16,11 @@
  * 
  * The implementation is multi-core and multi-thread safe. Use methods ...FromISR
  * in an interrupt service routine. 
+ *
+ * Watermarks let producer and consumer wake each other instead of polling: onFilled is
+ * called by every push which leaves at least the high watermark buffered, onDrained by the
+ * pop or clear which takes the buffer from above the low watermark to at most it. They run
+ * in the task which pushes or pops, not from the ...FromISR methods.
  */
 template <
     typename IT,
@@ -23,6 +30,27 @@ template <
 class Esp32RingBuffer
 {
     RingbufHandle_t rbh;
+    std::atomic<size_t> highWatermark{S * sizeof(OT)};
+    std::atomic<size_t> lowWatermark{0};
+    void (*onFilled)() = NULL;
+    void (*onDrained)() = NULL;
+
+    void filled()
+    {
+        if (onFilled != NULL && size() >= highWatermark)
+        {
+            onFilled();
+        }
+    }
+
+    void drained(size_t before, size_t after)
+    {
+        const size_t low = lowWatermark;
+        if (onDrained != NULL && before > low && after <= low)
+        {
+            onDrained();
+        }
+    }
 
 public:
     Esp32RingBuffer()
@@ -32,16 +60,41 @@ public:
     }
 
 
+    /* Set the callbacks and both watermarks in bytes, before the tasks use the buffer */
+    void setWatermarks(size_t high, void (*filledCallback)(), size_t low, void (*drainedCallback)())
+    {
+        onFilled = filledCallback;
+        onDrained = drainedCallback;
+        highWatermark = high;
+        lowWatermark = low;
+    }
+
+    /* Producer: move the watermark onFilled waits for */
+    void setHighWatermark(size_t high) { highWatermark = high; }
+
+    /* Producer: move the watermark onDrained waits for */
+    void setLowWatermark(size_t low) { lowWatermark = low; }
+
     /* Push an input item to the end of the buffer */
     bool push(const IT inElement)
     {
-        return pdTRUE == xRingbufferSend(rbh, &inElement, sizeof(IT), pdMS_TO_TICKS(10));
+        const bool pushed = pdTRUE == xRingbufferSend(rbh, &inElement, sizeof(IT), pdMS_TO_TICKS(10));
+        if (pushed)
+        {
+            filled();
+        }
+        return pushed;
     }
     
     /* Push an item array to the end of the buffer */
     bool push(const IT *const inElement_p, size_t len = 1) 
     {
-        return pdTRUE == xRingbufferSend(rbh, inElement_p, sizeof(IT)*len, pdMS_TO_TICKS(10));
+        const bool pushed = pdTRUE == xRingbufferSend(rbh, inElement_p, sizeof(IT)*len, pdMS_TO_TICKS(10));
+        if (pushed)
+        {
+            filled();
+        }
+        return pushed;
     }
 
     /* Pop the data at the beginning of the buffer */
@@ -49,7 +102,8 @@ public:
     {
         bool retval = false;
         size_t item_size;
-        if (size() >= sizeof(OT))
+        const size_t before = size();
+        if (before >= sizeof(OT))
         {
             OT *item_p = static_cast<OT *>(xRingbufferReceiveUpTo(rbh, &item_size, pdMS_TO_TICKS(100), sizeof(OT)));
             if (item_p != NULL)
@@ -64,21 +118,56 @@ public:
                     retval = true;
                 }
                 vRingbufferReturnItem(rbh, item_p);
+                drained(before, before - item_size);
             }
         }
         return retval;
     }
 
+    /* Pop up to n output items into dst, returns the number of items popped.
+     * The byte buffer hands out at most the contiguous part up to the wrap around,
+     * so a single call needs at most two receives instead of one per item */
+    size_t popInto(OT *dst, size_t n)
+    {
+        const size_t before = size();
+        const size_t wanted = std::min(n, before / sizeof(OT)) * sizeof(OT);
+        uint8_t *dst_p = reinterpret_cast<uint8_t *>(dst);
+        size_t received = 0;
+        while (received < wanted)
+        {
+            size_t item_size;
+            void *item_p = xRingbufferReceiveUpTo(rbh, &item_size, 0, wanted - received);
+            if (item_p == NULL)
+            {
+                break;
+            }
+            memcpy(&dst_p[received], item_p, item_size);
+            vRingbufferReturnItem(rbh, item_p);
+            received += item_size;
+        }
+        if ((received % sizeof(OT)) != 0)
+        {
+            Serial.println("Did not receive enough data, this should not happen");
+        }
+        drained(before, before - received);
+        return received / sizeof(OT);
+    }
+
+    /* Return the number of complete output items which can be popped right now.
+     * The FreeRTOS byte buffer cannot hand out data without consuming it, so this
+     * only peeks at the fill level, not at the data itself */
+    size_t available() { return size() / sizeof(OT); }
+
     /* Push an input item to the end of the buffer from within an interrupt service routine */
     bool pushFromISR(const IT inElement)
     {
-        return pdTRUE == xRingbufferSendFromISR(rbh, &inElement, sizeof(IT), pdMS_TO_TICKS(10));
+        return pdTRUE == xRingbufferSendFromISR(rbh, &inElement, sizeof(IT), NULL);
     }
 
     /* Push an input item array to the end of the buffer from within an interrupt service routine */
     bool pushFromISR(const IT *const inElement_p, size_t len = 1) 
     {
-        return pdTRUE == xRingbufferSendFromISR(rbh, inElement_p, sizeof(IT)*len, pdMS_TO_TICKS(10));
+        return pdTRUE == xRingbufferSendFromISR(rbh, inElement_p, sizeof(IT)*len, NULL);
     }
 
     /* Pop the data from the beginning of the buffer from within an interrupt service routine */
@@ -118,6 +207,7 @@ public:
         // we try to get to a state where we are not getting any more memory back
         // this requires at least 2 calls to xRingbufferReceiveUpTo
         void* item_p;
+        const size_t before = size();
         
         do 
         {
@@ -130,6 +220,7 @@ public:
           }
         }
         while (item_p != NULL);            
+        drained(before, 0);
     }
     /* return the used size of the buffer in bytes */
     size_t size() { return xRingbufferGetMaxItemSize(rbh) - xRingbufferGetCurFreeSize(rbh); }
@@ -138,5 +229,5 @@ public:
     size_t maxSize() { return xRingbufferGetMaxItemSize(rbh); }
 
     /* return the free size of the buffer in bytes*/
-    size_t freeSize() { return xRingbufferGetMaxItemSize(rbh); }
+    size_t freeSize() { return xRingbufferGetCurFreeSize(rbh); }
 };
@@ -9,11 +9,32 @@
 #include "ESPAsyncWebServer.h"
 #include <ArduinoJson.h>
 #include "index_html.h"
+// -DAUDIO_RINGBUFFER_FREERTOS=1 buffers the playback in the FreeRTOS ring buffer instead
+#ifdef AUDIO_RINGBUFFER_FREERTOS
 #include "Esp32RingBuffer.h"
+#else
+#include "SpscRingBuffer.h"
+#endif
+#include "SpscQueue.h"
+#include "DropPolicy.h"
+#include "VoiceActivityGate.h"
+#include "ImaAdpcm.h"
+#include "PcmConverter.h"
+#include "VolumeRamp.h"
+#include "UnderrunConcealer.h"
+#include "PlaybackStart.h"
+#include "DuplexGate.h"
+#include "StreamingChunks.h"
+#include "AudioFrameLayout.h"
+#include "SoundBank.h"
 #include <map>
+#include <sys/time.h>
+#include <limits.h>
+
+#ifndef NTP_SERVER
+#define NTP_SERVER "pool.ntp.org"
+#endif
 
-const int PLAY = BIT0;
-const int STREAM = BIT1;
 
 enum {
   HW_LOCAL = 0,
@@ -36,10 +57,26 @@ struct Config {
   int hotword_brightness = 15;  
   uint16_t volume = 100;
   int gain = 5;
+  int frame_ms = 16;
+  bool vad = false;
+  int vad_preroll_ms = 500;
+  bool adpcm = false;
+  int beam = -1;
+  bool audio_stats = false;
+  int drop_policy = DROP_NEWEST;
+  int drop_ms = 500;
+  int play_start_ms = 200;
+  bool full_duplex = false;
+  int resampler_quality = -1;
 };
 const char *configfile = "/config.json"; 
 Config config;
 
+// Capture keeps running while playing, on devices which can and if configured
+bool fullDuplex() {
+    return isFullDuplex(config.full_duplex, device->isFullDuplex());
+}
+
 struct wavfile_header {
     char riff_tag[4];       // 4
     int riff_length;        // 4
@@ -56,7 +93,175 @@ struct wavfile_header {
     int data_length;        // 4
 };
 struct wavfile_header header;
-std::string finishedMsg = "";
+static_assert(sizeof(wavfile_header) == 44, "audioFrame header must be 44 bytes");
+
+// Header of IMA-ADPCM audioFrames (format 0x11), one ADPCM block per message
+struct wavfile_adpcm_header {
+    char riff_tag[4];       // 4
+    int riff_length;        // 4
+    char wave_tag[4];       // 4
+    char fmt_tag[4];        // 4
+    int fmt_length;         // 4
+    short audio_format;     // 2
+    short num_channels;     // 2
+    int sample_rate;        // 4
+    int byte_rate;          // 4
+    short block_align;      // 2
+    short bits_per_sample;  // 2
+    short extra_length;     // 2
+    short samples_per_block;// 2
+    char fact_tag[4];       // 4
+    int fact_length;        // 4
+    int sample_length;      // 4
+    char data_tag[4];       // 4
+    int data_length;        // 4
+};
+struct wavfile_adpcm_header adpcmHeader;
+static_assert(sizeof(wavfile_adpcm_header) == 60, "ADPCM audioFrame header must be 60 bytes");
+// set by initHeader when config.adpcm is in effect
+bool adpcmFrames = false;
+
+// 128 ms of 16 kHz 16 bit audio, the longest configurable frame duration
+const int AUDIO_FRAME_MAX_BYTES = 4096;
+const int AUDIO_FRAME_POOL_SIZE = 4;
+const int AUDIO_FRAME_HEADER_MAX_BYTES = sizeof(wavfile_adpcm_header);
+// An audioFrame exactly as it is published. The capture task copies the header from initHeader
+// into a frame only once per header change, right aligned against the data, the device reads
+// its samples directly behind it, so nothing has to be copied to publish.
+struct AudioFrame {
+    uint32_t headerSerial;  // value of headerSerial when the header was copied
+    size_t length;          // number of bytes in data
+    size_t headerLength;    // number of header bytes in front of data
+    size_t messageLength;   // number of data bytes per published message
+    bool adpcm;             // data holds IMA-ADPCM blocks of messageLength
+    uint32_t sequence;      // counts every captured frame, dropped ones included
+    int64_t captureTime;    // wall clock in microseconds, taken when the read returned
+    int64_t queuedTime;     // esp_timer_get_time() at the same moment, for the latency bound
+    uint8_t headerSpace[AUDIO_FRAME_HEADER_MAX_BYTES];
+    uint8_t data[AUDIO_FRAME_MAX_BYTES];
+    // header followed by the data of the first message
+    const uint8_t *message() const { return &headerSpace[AUDIO_FRAME_HEADER_MAX_BYTES - headerLength]; }
+};
+static_assert(offsetof(AudioFrame, data) == offsetof(AudioFrame, headerSpace) + AUDIO_FRAME_HEADER_MAX_BYTES, "audioFrame samples must follow the header");
+// captured frames travel from the capture task to the publish task
+SpscQueue<AudioFrame, AUDIO_FRAME_POOL_SIZE> audioFrames;
+// the capture task keeps reading into this frame while the queue is full, so the DMA does not overrun
+AudioFrame overrunFrame;
+
+// In full duplex the played audio is published as well, as reference for echo cancellation
+struct ReferenceFrame {
+    size_t length;          // number of sample bytes in data
+    struct wavfile_header header;
+    uint8_t data[AUDIO_FRAME_MAX_BYTES];
+};
+static_assert(offsetof(ReferenceFrame, data) == offsetof(ReferenceFrame, header) + sizeof(wavfile_header), "reference samples must follow the header");
+SpscQueue<ReferenceFrame, 4> referenceFrames;
+// header for the format being played, set when playing starts
+struct wavfile_header referenceHeader;
+// bytes in the reference frame being filled, and how many it takes (whole samples)
+size_t referenceFill = 0;
+size_t referenceCapacity = AUDIO_FRAME_MAX_BYTES;
+// incremented by initHeader on every change of header
+uint32_t headerSerial = 0;
+// set by initHeader: bytes captured per frame, a multiple of the device read size
+int audioFrameBytes = 512;
+// in ADPCM mode the device reads into this buffer, the frame gets the encoded blocks
+int16_t captureSamples[AUDIO_FRAME_MAX_BYTES / 2];
+ImaAdpcmEncoder adpcmEncoder;
+
+// frame durations selectable in the web UI and on the audio topic
+bool isValidFrameMs(int frame_ms) {
+    return frame_ms == 16 || frame_ms == 32 || frame_ms == 64 || frame_ms == 128;
+}
+
+// Counters of the capture path. Written by the capture and publish tasks, readable from everywhere
+struct CaptureStats {
+    std::atomic<uint32_t> captured{0};     // frames read from the device
+    std::atomic<uint32_t> readFailures{0}; // reads which did not return a full frame
+    std::atomic<uint32_t> dropped{0};      // frames dropped because the publish task fell behind
+    std::atomic<uint32_t> published{0};    // frames handed to the MQTT client
+    std::atomic<uint32_t> gated{0};        // frames held back by the voice activity gate
+    std::atomic<uint32_t> publishFailures{0}; // messages the MQTT client did not accept
+    std::atomic<uint32_t> referenceDropped{0}; // played blocks missing in the reference, the queue was full
+    // histogram of the time to publish a frame, bucket i counts frames below publishTimeLimitsMs[i]
+    std::atomic<uint32_t> publishTime[8];
+};
+CaptureStats captureStats;
+const uint32_t publishTimeLimitsMs[] = {1, 2, 5, 10, 20, 50, 100}; // the last bucket takes the rest
+static_assert(sizeof(publishTimeLimitsMs) / sizeof(publishTimeLimitsMs[0]) + 1 == sizeof(CaptureStats::publishTime) / sizeof(CaptureStats::publishTime[0]), "one more publish time bucket than limits");
+
+void recordPublishTime(uint32_t ms) {
+    size_t bucket = 0;
+    while (bucket < sizeof(publishTimeLimitsMs) / sizeof(publishTimeLimitsMs[0]) && ms >= publishTimeLimitsMs[bucket]) {
+        bucket++;
+    }
+    captureStats.publishTime[bucket]++;
+}
+
+// The counters as JSON, for the captureStats topic and the web UI
+std::string captureStatsJson() {
+    char json[384];
+    int len = snprintf(json, sizeof(json),
+        "{\"captured\":%u,\"published\":%u,\"dropped\":%u,\"gated\":%u,\"read_failures\":%u,\"publish_failures\":%u,\"reference_dropped\":%u,\"publish_ms\":{",
+        (unsigned)captureStats.captured, (unsigned)captureStats.published, (unsigned)captureStats.dropped,
+        (unsigned)captureStats.gated, (unsigned)captureStats.readFailures, (unsigned)captureStats.publishFailures,
+        (unsigned)captureStats.referenceDropped);
+    const size_t limits = sizeof(publishTimeLimitsMs) / sizeof(publishTimeLimitsMs[0]);
+    for (size_t i = 0; i <= limits && len < (int)sizeof(json); i++) {
+        if (i < limits) {
+            len += snprintf(&json[len], sizeof(json) - len, "\"<%u\":%u,", publishTimeLimitsMs[i], (unsigned)captureStats.publishTime[i]);
+        } else {
+            len += snprintf(&json[len], sizeof(json) - len, "\">=%u\":%u}}", publishTimeLimitsMs[i - 1], (unsigned)captureStats.publishTime[i]);
+        }
+    }
+    return std::string(json);
+}
+
+// Counters of the playback path, written by I2Stask
+struct PlaybackStats {
+    std::atomic<uint32_t> underruns{0};       // times the stream ran dry while playing
+    std::atomic<uint32_t> concealedFrames{0}; // frames of fill played during underruns
+    std::atomic<uint32_t> longestGapMs{0};    // longest time without samples during playback
+};
+PlaybackStats playbackStats;
+
+// The counters as JSON, for the playbackStats topic and the web UI
+std::string playbackStatsJson() {
+    char json[128];
+    snprintf(json, sizeof(json), "{\"underruns\":%u,\"concealed_frames\":%u,\"longest_gap_ms\":%u}",
+        (unsigned)playbackStats.underruns, (unsigned)playbackStats.concealedFrames, (unsigned)playbackStats.longestGapMs);
+    return std::string(json);
+}
+
+// the longest configurable pre-roll, 1 s of 16 kHz 16 bit audio
+const int VAD_PREROLL_MAX_MS = 1000;
+const int VAD_PREROLL_MAX_BYTES = 16000 * 2 * VAD_PREROLL_MAX_MS / 1000;
+// In Idle the audio only feeds the remote wake word detection. With config.vad set, frames
+// without voice are then kept in the pre-roll instead of being published, on speech onset
+// the pre-roll is sent first, so the wake word is not clipped.
+bool vadGateIdle = false;
+VoiceActivityDetector voiceDetector;
+PrerollBuffer<VAD_PREROLL_MAX_BYTES> preroll;
+// Each playBytes or playBytesStreaming request is queued as an utterance, their samples follow
+// each other in audioData. The MQTT task fills the newest one, I2Stask plays them in order and
+// publishes playFinished for each.
+struct Utterance {
+    std::string finishedMsg;
+    int sampleRate;
+    int numChannels;
+    int bitDepth;
+    std::atomic<size_t> bytes{0};      // pushed to audioData so far, always even once complete
+    std::atomic<bool> complete{false}; // all of it is in audioData
+};
+const int PLAY_QUEUE_SIZE = 4;
+SpscQueue<Utterance, PLAY_QUEUE_SIZE> playQueue;
+// the utterance MQTT messages are pushed to, NULL between requests
+Utterance *openUtterance = NULL;
+// I2Stask counts this up when it drops the queue, openUtterance is gone then
+std::atomic<uint32_t> playGeneration{0};
+uint32_t openGeneration = 0;
+// playBytesStreaming: puts the chunks back in order
+StreamingChunks streamingChunks;
 bool mqttInitialized = false;
 int retryCount = 0;
 int I2SMode = -1;
@@ -66,23 +271,58 @@ bool DEBUG = false;
 std::string audioFrameTopic = std::string("hermes/audioServer/") + config.siteid + std::string("/audioFrame");
 std::string playBytesTopic = std::string("hermes/audioServer/") + config.siteid + std::string("/playBytes/#");
 std::string playFinishedTopic = std::string("hermes/audioServer/") + config.siteid + std::string("/playFinished");
+std::string playBytesStreamingTopic = std::string("hermes/audioServer/") + config.siteid + std::string("/playBytesStreaming/#");
 std::string hotwordTopic = "hermes/hotword/#";
 std::string audioTopic = config.siteid + std::string("/audio");
 std::string ledTopic = config.siteid + std::string("/led");
 std::string debugTopic = config.siteid + std::string("/debug");
 std::string restartTopic = config.siteid + std::string("/restart");
+std::string audioStatsTopic = config.siteid + std::string("/audioStats");
+std::string captureStatsTopic = config.siteid + std::string("/captureStats");
+std::string playbackStatsTopic = config.siteid + std::string("/playbackStats");
+std::string audioReferenceTopic = config.siteid + std::string("/audioReference");
+std::string soundsTopic = config.siteid + std::string("/sounds/");
 AsyncMqttClient asyncClient; 
 WiFiClient net;
 PubSubClient audioServer(net); 
+// MQTT task pushes, I2Stask pops
+#ifdef AUDIO_RINGBUFFER_FREERTOS
 Esp32RingBuffer<uint8_t, uint16_t, (1U << 15)> audioData;
-long message_size = 0;
-int queueDelay = 10;
-int sampleRate = 16000;
-int numChannels = 2;
-int bitDepth = 16;
+#else
+SpscRingBuffer<uint8_t, uint16_t, (1U << 15)> audioData;
+#endif
+// The I2S task pops at most PLAYBACK_BLOCK_MAX_BYTES of the stream at a time and converts
+// them to what the device plays, 8 bit mono to 16 bit stereo makes 4 times as many bytes
+const int PLAYBACK_BLOCK_MAX_BYTES = 1024;
+uint8_t playbackBlock[PLAYBACK_BLOCK_MAX_BYTES];
+int16_t playbackSamples[PLAYBACK_BLOCK_MAX_BYTES * 2];
+PcmConverter playbackConverter;
+// volume of devices without hasVolumeControl
+VolumeRamp playbackVolume;
+// While the stream runs dry, I2Stask plays UNDERRUN_CONCEAL_FRAMES of fill at a time, 8 ms at 16 kHz
+const int UNDERRUN_CONCEAL_FRAMES = 128;
+UnderrunConcealer playbackConcealer;
+// played when a session starts, so the wake sound does not wait for the network
+const char *HOTWORD_SOUND = "hotword";
+// While it plays a sound, I2Stask reads the samples from the sound bank instead of audioData
+SoundBank soundBank;
+// Sound uploads are copied out of the MQTT callback part by part, SoundTask writes them to
+// SPIFFS. Writing the flash can take long enough to stall the MQTT connection
+struct SoundUploadPart {
+    char name[SOUND_NAME_MAX_LENGTH + 1];
+    uint8_t *data; // copy of the payload, SoundTask frees it
+    size_t len;
+    size_t index;
+    size_t total;
+};
+const int SOUND_UPLOAD_QUEUE_SIZE = 16;
+QueueHandle_t soundUploadParts;
 static EventGroupHandle_t audioGroup;
 SemaphoreHandle_t wbSemaphore;
 TaskHandle_t i2sHandle;
+TaskHandle_t captureHandle;
+TaskHandle_t publishHandle;
+TaskHandle_t soundHandle;
 
 struct WifiDisconnected;
 struct MQTTDisconnected;
@@ -96,7 +336,9 @@ struct MQTTDisconnectedEvent : tinyfsm::Event { };
 struct MQTTConnectedEvent : tinyfsm::Event { };
 struct IdleEvent : tinyfsm::Event { };
 struct StreamAudioEvent : tinyfsm::Event { };
-struct PlayAudioEvent : tinyfsm::Event {};
+struct PlayAudioEvent : tinyfsm::Event {
+    bool *accepted = NULL; // set to true if the state plays
+};
 struct HotwordDetectedEvent : tinyfsm::Event { };
 
 void onMqttConnect(bool sessionPresent);
@@ -106,8 +348,25 @@ void publishDebug(const char* message);
 void InitI2SSpeakerOrMic(int mode);
 void WiFiEvent(WiFiEvent_t event);
 void initHeader(int readSize, int width, int rate);
+void initReferenceHeader(int rate, int bits, int channels);
+void queueReference(const uint8_t *data, size_t len);
+void flushReference();
+bool publishReferenceFrame(const ReferenceFrame &frame);
+bool publishAudioFrame(const AudioFrame &frame, size_t offset, size_t len);
+bool publishText(const std::string &topic, const std::string &message);
+void publishAudioStats(const AudioFrame &frame, int messages);
+int64_t wallClockMicros();
+bool playSound(const std::string &name);
+void audioDataFilled();
+void audioDataDrained();
 void MQTTtask(void *p);
 void I2Stask(void *p);
+void CaptureTask(void *p);
+void PublishTask(void *p);
+void SoundTask(void *p);
+void prepareAudioFrame(AudioFrame *frame);
+void encodeAudioFrame(AudioFrame *frame, const int16_t *samples, size_t count);
+void queueAudioFrame(AudioFrame *frame, const int16_t *samples, size_t count);
 void loadConfiguration(const char *filename, Config &config);
 void saveConfiguration(const char *filename, Config &config);
 
@@ -168,6 +427,22 @@ const std::map<const std::string, String (*)()> processor_values = {
     {"HW_REMOTE",           []() -> String { return (config.hotword_detection == HW_REMOTE) ? "selected" : ""; } },
     {"VOLUME",              []() { return String(config.volume); } },
     {"GAIN",                []() { return String(config.gain); } },
+    {"VAD",                 []() -> String { return (config.vad) ? "checked" : ""; } },
+    {"VAD_PREROLL_MS",      []() { return String(config.vad_preroll_ms); } },
+    {"FRAME_MS_16",         []() -> String { return (config.frame_ms == 16) ? "selected" : ""; } },
+    {"FRAME_MS_32",         []() -> String { return (config.frame_ms == 32) ? "selected" : ""; } },
+    {"FRAME_MS_64",         []() -> String { return (config.frame_ms == 64) ? "selected" : ""; } },
+    {"FRAME_MS_128",        []() -> String { return (config.frame_ms == 128) ? "selected" : ""; } },
+    {"ADPCM",               []() -> String { return (config.adpcm) ? "checked" : ""; } },
+    {"DROP_NEWEST",         []() -> String { return (config.drop_policy == DROP_NEWEST) ? "selected" : ""; } },
+    {"DROP_OLDEST",         []() -> String { return (config.drop_policy == DROP_OLDEST) ? "selected" : ""; } },
+    {"DROP_BLOCK",          []() -> String { return (config.drop_policy == DROP_BLOCK) ? "selected" : ""; } },
+    {"DROP_MS",             []() { return String(config.drop_ms); } },
+    {"RESAMPLER_QUALITY",   []() { return String(config.resampler_quality); } },
+    {"FULL_DUPLEX",         []() -> String { return !device->isFullDuplex() ? "disabled" : (config.full_duplex) ? "checked" : ""; } },
+    {"PLAY_START_MS",       []() { return String(config.play_start_ms); } },
+    {"AUDIO_STATS",         []() -> String { return captureStatsJson().c_str(); } },
+    {"PLAYBACK_STATS",      []() -> String { return playbackStatsJson().c_str(); } },
     {"SITEID",              []() -> String { return config.siteid.c_str(); } },
 };
 
@@ -203,6 +478,34 @@ template <typename T> bool processParam(AsyncWebParameter *p, const char* p_name
     return retval;
 }
 
+// as above, for numbers which have to stay within min and max, like the MQTT commands keep them
+template <typename T> bool processParam(AsyncWebParameter *p, const char* p_name, T& p_val, T min, T max)
+{
+    T new_p_val = p_val;
+    if (processParam(p, p_name, new_p_val))
+    {
+        new_p_val = std::max(std::min(new_p_val, max), min);
+        if (p_val != new_p_val)
+        {
+            p_val = new_p_val;
+            return true;
+        }
+    }
+    return false;
+}
+
+// as above, for values isValid has to accept, others keep the setting as it was
+template <typename T> bool processParam(AsyncWebParameter *p, const char* p_name, T& p_val, bool (*isValid)(T))
+{
+    T new_p_val = p_val;
+    if (processParam(p, p_name, new_p_val) && isValid(new_p_val))
+    {
+        p_val = new_p_val;
+        return true;
+    }
+    return false;
+}
+
 void handleFSf ( AsyncWebServerRequest* request, const String& route ) {
     AsyncWebServerResponse *response ;
     bool saveNeeded = false;
@@ -213,6 +516,9 @@ void handleFSf ( AsyncWebServerRequest* request, const String& route ) {
             int params = request->params();
             bool mi_found = false;
             bool mo_found = false;
+            bool vad_found = false;
+            bool adpcm_found = false;
+            bool fd_found = false;
             for(int i=0;i<params;i++){
                 AsyncWebParameter* p = request->getParam(i);
                 Serial.printf("Parameter %s, value %s\r\n", p->name().c_str(), p->value().c_str());
@@ -230,9 +536,21 @@ void handleFSf ( AsyncWebServerRequest* request, const String& route ) {
                 saveNeeded |= processParam(p, "hotword_detection", config.hotword_detection);
                 saveNeeded |= processParam(p, "gain", config.gain);
                 saveNeeded |= processParam(p, "volume", config.volume);
+                saveNeeded |= processParam(p, "frame_ms", config.frame_ms, isValidFrameMs);
+                saveNeeded |= processParam(p, "vad", config.vad);
+                saveNeeded |= processParam(p, "vad_preroll_ms", config.vad_preroll_ms, 0, VAD_PREROLL_MAX_MS);
+                saveNeeded |= processParam(p, "adpcm", config.adpcm);
+                saveNeeded |= processParam(p, "drop_policy", config.drop_policy, isValidDropPolicy);
+                saveNeeded |= processParam(p, "drop_ms", config.drop_ms, 0, INT_MAX);
+                saveNeeded |= processParam(p, "play_start_ms", config.play_start_ms, 0, INT_MAX);
+                saveNeeded |= processParam(p, "full_duplex", config.full_duplex);
+                saveNeeded |= processParam(p, "resampler_quality", config.resampler_quality, -1, 10);
 
                 mi_found |= (p->name() == "mute_input");
                 mo_found |= (p->name() == "mute_output");
+                vad_found |= (p->name() == "vad");
+                adpcm_found |= (p->name() == "adpcm");
+                fd_found |= (p->name() == "full_duplex");
 
             }
 
@@ -246,6 +564,21 @@ void handleFSf ( AsyncWebServerRequest* request, const String& route ) {
                 config.mute_output = false;
                 saveNeeded = true;
             }
+            if (!vad_found && config.vad) {
+                Serial.println("Voice activity gate not found, value = off");
+                config.vad = false;
+                saveNeeded = true;
+            }
+            if (!fd_found && config.full_duplex) {
+                Serial.println("Full duplex not found, value = off");
+                config.full_duplex = false;
+                saveNeeded = true;
+            }
+            if (!adpcm_found && config.adpcm) {
+                Serial.println("ADPCM not found, value = off");
+                config.adpcm = false;
+                saveNeeded = true;
+            }
             if (saveNeeded) {
                 Serial.println("Settings changed, saving configuration");
                 saveConfiguration(configfile, config);
@@ -285,7 +618,7 @@ void publishDebug(const char* message) {
 
 void loadConfiguration(const char *filename, Config &config) {
   File file = SPIFFS.open(filename);
-  StaticJsonDocument<512> doc;
+  StaticJsonDocument<1024> doc;
   // Deserialize the JSON document
   DeserializationError error = deserializeJson(doc, file);
   if (error) {
@@ -310,15 +643,35 @@ void loadConfiguration(const char *filename, Config &config) {
     config.hotword_detection = 1;
     config.volume = doc.getMember("volume").as<int>();
     device->setVolume(config.volume);
+    playbackVolume.setVolume(config.volume);
     config.gain = doc.getMember("gain").as<int>();
     device->setGain(config.gain);
+    config.frame_ms = doc.getMember("frame_ms") | config.frame_ms;
+    config.vad = doc.getMember("vad") | config.vad;
+    config.vad_preroll_ms = doc.getMember("vad_preroll_ms") | config.vad_preroll_ms;
+    config.adpcm = doc.getMember("adpcm") | config.adpcm;
+    config.beam = doc.getMember("beam") | config.beam;
+    config.audio_stats = doc.getMember("audio_stats") | config.audio_stats;
+    config.drop_policy = doc.getMember("drop_policy") | config.drop_policy;
+    config.drop_ms = doc.getMember("drop_ms") | config.drop_ms;
+    config.play_start_ms = doc.getMember("play_start_ms") | config.play_start_ms;
+    config.full_duplex = doc.getMember("full_duplex") | config.full_duplex;
+    config.resampler_quality = doc.getMember("resampler_quality") | config.resampler_quality;
+    device->setBeamDirection(config.beam);
+    device->setResamplerQuality(config.resampler_quality);
     audioFrameTopic = std::string("hermes/audioServer/") + config.siteid + std::string("/audioFrame");
     playBytesTopic = std::string("hermes/audioServer/") + config.siteid + std::string("/playBytes/#");
     playFinishedTopic = std::string("hermes/audioServer/") + config.siteid + std::string("/playFinished");
+    playBytesStreamingTopic = std::string("hermes/audioServer/") + config.siteid + std::string("/playBytesStreaming/#");
     audioTopic = config.siteid + std::string("/audio");
     ledTopic = config.siteid + std::string("/led");
     debugTopic = config.siteid + std::string("/debug");
     restartTopic = config.siteid + std::string("/restart");
+    audioStatsTopic = config.siteid + std::string("/audioStats");
+    captureStatsTopic = config.siteid + std::string("/captureStats");
+    playbackStatsTopic = config.siteid + std::string("/playbackStats");
+    audioReferenceTopic = config.siteid + std::string("/audioReference");
+    soundsTopic = config.siteid + std::string("/sounds/");
   }
   file.close();
 }
@@ -333,7 +686,7 @@ void saveConfiguration(const char *filename, Config &config) {
         Serial.println(F("Failed to create file"));
         return;
     }
-    StaticJsonDocument<256> doc;
+    StaticJsonDocument<1024> doc;
     doc["siteid"] = config.siteid;
     doc["mqtt_host"] = config.mqtt_host;
     doc["mqtt_port"] = config.mqtt_port;
@@ -347,6 +700,17 @@ void saveConfiguration(const char *filename, Config &config) {
     doc["hotword_detection"] = config.hotword_detection;
     doc["volume"] = config.volume;
     doc["gain"] = config.gain;
+    doc["frame_ms"] = config.frame_ms;
+    doc["vad"] = config.vad;
+    doc["vad_preroll_ms"] = config.vad_preroll_ms;
+    doc["adpcm"] = config.adpcm;
+    doc["beam"] = config.beam;
+    doc["audio_stats"] = config.audio_stats;
+    doc["drop_policy"] = config.drop_policy;
+    doc["drop_ms"] = config.drop_ms;
+    doc["play_start_ms"] = config.play_start_ms;
+    doc["full_duplex"] = config.full_duplex;
+    doc["resampler_quality"] = config.resampler_quality;
     if (serializeJson(doc, file) == 0) {
         Serial.println(F("Failed to write to file"));
     }
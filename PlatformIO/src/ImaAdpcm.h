@@ -0,0 +1,132 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+static const int16_t imaStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+static const int8_t imaIndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8};
+
+/**
+ * @brief Streaming IMA-ADPCM encoder for 16 bit mono audio
+ *
+ * Produces the blocks of a WAV file with format 0x11 (IMA ADPCM), 4 bits per sample.
+ * The step index carries over from block to block, so consecutive blocks form one
+ * continuous stream, while every block still starts with the state a decoder needs.
+ */
+class ImaAdpcmEncoder
+{
+    int32_t predictor = 0;
+    int index = 0;
+    int16_t previous = 0; // last sample of the block before, the header of the next
+    bool started = false;
+
+    /* Quantise one sample to a 4 bit code, updating the state exactly as the decoder will */
+    uint8_t encodeSample(int16_t sample)
+    {
+        int32_t step = imaStepTable[index];
+        int32_t diff = sample - predictor;
+        uint8_t code = 0;
+        if (diff < 0)
+        {
+            code = 8;
+            diff = -diff;
+        }
+        int32_t delta = step >> 3;
+        if (diff >= step)
+        {
+            code |= 4;
+            diff -= step;
+            delta += step;
+        }
+        step >>= 1;
+        if (diff >= step)
+        {
+            code |= 2;
+            diff -= step;
+            delta += step;
+        }
+        step >>= 1;
+        if (diff >= step)
+        {
+            code |= 1;
+            delta += step;
+        }
+        predictor += (code & 8) ? -delta : delta;
+        if (predictor > 32767)
+        {
+            predictor = 32767;
+        }
+        else if (predictor < -32768)
+        {
+            predictor = -32768;
+        }
+        index += imaIndexTable[code];
+        if (index < 0)
+        {
+            index = 0;
+        }
+        else if (index > 88)
+        {
+            index = 88;
+        }
+        return code;
+    }
+
+public:
+    /* Bytes of the block holding count samples (count must be even) */
+    static size_t blockSize(size_t count) { return 4 + count / 2; }
+
+    /* Samples a decoder gets out of that block, (blockSize - 4) * 2 + 1 as IMA has it: the
+     * header sample and the count samples of the codes */
+    static size_t samplesPerBlock(size_t count) { return count + 1; }
+
+    /* Start a new stream */
+    void reset()
+    {
+        predictor = 0;
+        index = 0;
+        started = false;
+    }
+
+    /**
+     * Encode count samples (even) into one block of blockSize(count) bytes.
+     *
+     * IMA blocks hold an odd number of samples, the header sample which decoders output as
+     * it is, and the codes, two per byte. The header repeats the last sample of the block
+     * before (the first sample of the stream for the first block), so every code carries a
+     * sample of this block and decoders get samplesPerBlock(count) samples, the repeated
+     * one first.
+     */
+    size_t encodeBlock(const int16_t *samples, size_t count, uint8_t *block)
+    {
+        if (!started)
+        {
+            previous = samples[0];
+            started = true;
+        }
+        predictor = previous;
+        block[0] = (uint8_t)(predictor & 0xff);
+        block[1] = (uint8_t)((predictor >> 8) & 0xff);
+        block[2] = (uint8_t)index;
+        block[3] = 0;
+        uint8_t *out = &block[4];
+        for (size_t i = 0; i + 1 < count; i += 2)
+        {
+            // the first sample of a pair goes into the low nibble
+            const uint8_t low = encodeSample(samples[i]);
+            *out++ = low | (encodeSample(samples[i + 1]) << 4);
+        }
+        previous = samples[count - 1];
+        return blockSize(count);
+    }
+};
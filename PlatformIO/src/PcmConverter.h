@@ -0,0 +1,148 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Streaming conversion of WAV PCM to the 16 bit samples a device plays
+ *
+ * Takes little endian PCM of 8 (unsigned), 16, 24 or 32 bits with any number of channels
+ * and writes 16 bit samples with one or two channels. Sample width and channel mapping are
+ * done in one pass over the input, a mono stream is duplicated to both outputs and a stereo
+ * stream is averaged down to mono. Channels beyond the second are skipped. Input can be
+ * split at any byte, an incomplete frame is carried over to the next call.
+ * The sample rate is left alone, devices either clock their I2S at the stream rate or
+ * resample in writeAudio.
+ */
+class PcmConverter
+{
+    uint8_t carry[32];
+    size_t carryLength = 0;
+    int bytesPerSample = 2;
+    int inChannels = 1;
+    int outChannels = 1;
+
+    template <int BYTES>
+    static inline int16_t sample(const uint8_t *p)
+    {
+        switch (BYTES)
+        {
+        case 1:
+            return (int16_t)((p[0] - 128) << 8);
+        case 2:
+            return (int16_t)(p[0] | (p[1] << 8));
+        case 3:
+            return (int16_t)(p[1] | (p[2] << 8));
+        default:
+            return (int16_t)(p[2] | (p[3] << 8));
+        }
+    }
+
+    template <int BYTES>
+    size_t convertFrames(const uint8_t *in, size_t frames, int16_t *out)
+    {
+        const size_t frameBytes = BYTES * inChannels;
+        if (inChannels == 1 && outChannels == 2)
+        {
+            for (size_t f = 0; f < frames; f++, in += frameBytes)
+            {
+                out[2 * f] = out[2 * f + 1] = sample<BYTES>(in);
+            }
+        }
+        else if (inChannels > 1 && outChannels == 1)
+        {
+            for (size_t f = 0; f < frames; f++, in += frameBytes)
+            {
+                out[f] = (int16_t)(((int32_t)sample<BYTES>(in) + sample<BYTES>(in + BYTES)) >> 1);
+            }
+        }
+        else if (outChannels == 2)
+        {
+            for (size_t f = 0; f < frames; f++, in += frameBytes)
+            {
+                out[2 * f] = sample<BYTES>(in);
+                out[2 * f + 1] = sample<BYTES>(in + BYTES);
+            }
+        }
+        else
+        {
+            for (size_t f = 0; f < frames; f++, in += frameBytes)
+            {
+                out[f] = sample<BYTES>(in);
+            }
+        }
+        return frames * outChannels;
+    }
+
+    size_t convertFrames(const uint8_t *in, size_t frames, int16_t *out)
+    {
+        switch (bytesPerSample)
+        {
+        case 1:
+            return convertFrames<1>(in, frames, out);
+        case 2:
+            if (inChannels == outChannels)
+            {
+                // already in the output format
+                memcpy(out, in, frames * 2 * outChannels);
+                return frames * outChannels;
+            }
+            return convertFrames<2>(in, frames, out);
+        case 3:
+            return convertFrames<3>(in, frames, out);
+        default:
+            return convertFrames<4>(in, frames, out);
+        }
+    }
+
+public:
+    /**
+     * Set the input format and the number of output channels, 0 keeps the channels of
+     * the input (at most 2). Returns false for a format that can not be converted.
+     */
+    bool configure(int bitDepth, int numChannels, int outputChannels)
+    {
+        carryLength = 0;
+        if ((bitDepth != 8 && bitDepth != 16 && bitDepth != 24 && bitDepth != 32) || numChannels < 1 || numChannels * bitDepth / 8 > (int)sizeof(carry))
+        {
+            bytesPerSample = 2;
+            inChannels = outChannels = 1;
+            return false;
+        }
+        bytesPerSample = bitDepth / 8;
+        inChannels = numChannels;
+        outChannels = outputChannels > 0 ? outputChannels : numChannels;
+        outChannels = outChannels > 2 ? 2 : outChannels;
+        return true;
+    }
+
+    int outputChannels() { return outChannels; }
+
+    /* Convert length bytes of input, returns the number of 16 bit samples written to out */
+    size_t convert(const uint8_t *in, size_t length, int16_t *out)
+    {
+        const size_t frameBytes = bytesPerSample * inChannels;
+        size_t produced = 0;
+        if (carryLength > 0)
+        {
+            // complete the frame left over from the previous call
+            const size_t missing = frameBytes - carryLength;
+            const size_t taken = length < missing ? length : missing;
+            memcpy(&carry[carryLength], in, taken);
+            carryLength += taken;
+            in += taken;
+            length -= taken;
+            if (carryLength < frameBytes)
+            {
+                return 0;
+            }
+            produced = convertFrames(carry, 1, out);
+            carryLength = 0;
+        }
+        const size_t frames = length / frameBytes;
+        produced += convertFrames(in, frames, &out[produced]);
+        carryLength = length - frames * frameBytes;
+        memcpy(carry, &in[frames * frameBytes], carryLength);
+        return produced;
+    }
+};
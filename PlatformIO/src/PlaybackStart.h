@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Bytes to buffer before playback starts: play_start_ms of audio in the format of the
+ * utterance, never more than half the buffer, so the start does not depend on the buffer
+ * running full. Computed in 64 bit, 48 kHz stereo 32 bit times a few seconds overflows
+ * size_t. Plain C++, so the host tests compute the same threshold.
+ */
+inline size_t playStartBytes(uint32_t sampleRate, int numChannels, int bitsPerSample, int play_start_ms, size_t bufferSize)
+{
+    const uint64_t bytesPerSecond = (uint64_t)sampleRate * numChannels * bitsPerSample / 8;
+    const uint64_t startBytes = bytesPerSecond * (play_start_ms > 0 ? play_start_ms : 0) / 1000;
+    return (size_t)(startBytes < bufferSize / 2 ? startBytes : bufferSize / 2);
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "PolyphaseTables.h"
+
+/**
+ * @brief Fixed ratio polyphase resampler with precomputed filters
+ *
+ * The filters for the rates TTS engines deliver are generated by tools/gen_polyphase.py into
+ * PolyphaseTables.h, they are const and stay in flash. Switching the rate only looks up a
+ * table, nothing is designed at runtime. Output sample n sits at n * down in the rate of up
+ * times the input, its phase picks one row of Q15 coefficients, which runs over the newest
+ * input samples. Each block is appended to the last POLYPHASE_MAX_TAPS - 1 input frames, so
+ * the filter runs over contiguous memory across block borders. The same works for
+ * decimation, the capture tables take the mic down to 16 kHz.
+ *
+ * MAX_FRAMES is the most input frames process takes per call, at most 2 channels. Mono input
+ * can be written as stereo right away, both channels get the same sample.
+ */
+template <int MAX_FRAMES>
+class PolyphaseResampler
+{
+    static const int HISTORY = POLYPHASE_MAX_TAPS - 1;
+    static const int MAX_CHANNELS = 2;
+
+    const PolyphaseTable *table = NULL;
+    int16_t work[(HISTORY + MAX_FRAMES) * MAX_CHANNELS];
+    int channels = 1;
+    // position of the next output sample, input frame relative to the block start and phase
+    size_t position = 0;
+    int phase = 0;
+
+    static const PolyphaseTable *findTable(int inRate, int outRate)
+    {
+        for (size_t i = 0; i < sizeof(polyphaseTables) / sizeof(polyphaseTables[0]); i++)
+        {
+            if (polyphaseTables[i].inRate == inRate && polyphaseTables[i].outRate == outRate)
+            {
+                return &polyphaseTables[i];
+            }
+        }
+        return NULL;
+    }
+
+public:
+    static bool hasTable(int inRate, int outRate) { return findTable(inRate, outRate) != NULL; }
+
+    /* true if there is a table for the rates, the resampler starts from silence then */
+    bool setRates(int inRate, int outRate, int numChannels)
+    {
+        table = findTable(inRate, outRate);
+        channels = numChannels < 1 ? 1 : (numChannels > MAX_CHANNELS ? MAX_CHANNELS : numChannels);
+        memset(work, 0, sizeof(work));
+        position = 0;
+        phase = 0;
+        return table != NULL;
+    }
+
+    bool isActive() { return table != NULL; }
+
+    /* Leave resampling to someone else until the next setRates */
+    void disable() { table = NULL; }
+
+    /* Most output frames for frames of input */
+    size_t maxOutput(size_t frames) { return table == NULL ? 0 : (frames * table->up) / table->down + 1; }
+
+    /**
+     * Resamples frames of interleaved input (at most MAX_FRAMES) into out, which must hold
+     * maxOutput(frames) frames of outChannels. outChannels is the input channels, or 2 to
+     * write mono input as stereo. All input is taken, returns the number of frames written.
+     */
+    size_t process(const int16_t *in, size_t frames, int16_t *out, int outChannels)
+    {
+        if (table == NULL)
+        {
+            return 0;
+        }
+        frames = frames > MAX_FRAMES ? MAX_FRAMES : frames;
+        memcpy(&work[HISTORY * channels], in, frames * channels * sizeof(int16_t));
+        const int up = table->up;
+        const int down = table->down;
+        const int taps = table->taps;
+        size_t produced = 0;
+        while (position < frames)
+        {
+            const int16_t *coefficients = &table->coefficients[phase * taps];
+            // newest input frame of this output sample
+            const int16_t *x = &work[(HISTORY + position) * channels];
+            for (int c = 0; c < channels; c++)
+            {
+                int32_t sum = 0;
+                for (int k = 0; k < taps; k++)
+                {
+                    sum += coefficients[k] * x[c - k * channels];
+                }
+                sum = (sum + (1 << 14)) >> 15;
+                out[produced * outChannels + c] = sum > 32767 ? 32767 : (sum < -32768 ? -32768 : sum);
+            }
+            if (outChannels > channels)
+            {
+                out[produced * outChannels + 1] = out[produced * outChannels];
+            }
+            produced++;
+            phase += down;
+            position += phase / up;
+            phase %= up;
+        }
+        position -= frames;
+        // keep the newest frames for the next block
+        memmove(work, &work[frames * channels], HISTORY * channels * sizeof(int16_t));
+        return produced;
+    }
+};
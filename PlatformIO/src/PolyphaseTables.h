@@ -0,0 +1,1131 @@
+#pragma once
+// Generated by tools/gen_polyphase.py, do not edit
+#include <stdint.h>
+
+const int POLYPHASE_MAX_TAPS = 80;
+
+// 16000 Hz to 44100 Hz, 441 phases of 16 taps
+const int16_t polyphase_16000_44100[441][16] = {
+    {-5, 48, -192, 512, -1048, 1761, -2509, 3097, 29484, 3029, -2482, 1750, -1044, 511, -192, 48},
+    {-5, 48, -192, 513, -1052, 1771, -2535, 3165, 29485, 2961, -2456, 1739, -1040, 510, -192, 48},
+    {-5, 48, -192, 514, -1056, 1782, -2560, 3234, 29484, 2893, -2430, 1728, -1037, 509, -192, 48},
+    {-4, 48, -192, 514, -1060, 1793, -2586, 3302, 29483, 2826, -2404, 1717, -1033, 508, -192, 48},
+    {-4, 48, -192, 515, -1063, 1803, -2612, 3371, 29481, 2759, -2378, 1706, -1029, 507, -192, 48},
+    {-4, 48, -192, 516, -1067, 1814, -2638, 3441, 29478, 2692, -2352, 1695, -1025, 506, -192, 48},
+    {-4, 48, -192, 517, -1071, 1824, -2664, 3510, 29476, 2625, -2326, 1684, -1020, 505, -192, 48},
+    {-4, 47, -192, 518, -1074, 1835, -2690, 3579, 29474, 2558, -2300, 1673, -1016, 503, -191, 48},
+    {-4, 47, -192, 519, -1078, 1845, -2716, 3649, 29470, 2492, -2273, 1662, -1012, 502, -191, 48},
+    {-4, 47, -192, 519, -1081, 1856, -2742, 3719, 29466, 2426, -2247, 1651, -1008, 501, -191, 48},
+    {-4, 47, -192, 520, -1085, 1866, -2767, 3789, 29462, 2360, -2221, 1640, -1004, 500, -191, 48},
+    {-4, 47, -192, 521, -1088, 1876, -2793, 3859, 29458, 2294, -2195, 1628, -1000, 499, -191, 49},
+    {-4, 47, -192, 522, -1092, 1887, -2819, 3930, 29451, 2229, -2169, 1617, -995, 498, -191, 49},
+    {-4, 47, -192, 522, -1095, 1897, -2844, 4001, 29446, 2163, -2142, 1606, -991, 496, -191, 49},
+    {-4, 47, -192, 523, -1099, 1907, -2870, 4072, 29441, 2098, -2116, 1594, -987, 495, -190, 49},
+    {-4, 47, -192, 524, -1102, 1917, -2895, 4143, 29433, 2033, -2090, 1583, -982, 494, -190, 49},
+    {-4, 47, -192, 524, -1105, 1927, -2921, 4214, 29427, 1969, -2064, 1572, -978, 493, -190, 49},
+    {-4, 46, -192, 525, -1109, 1937, -2946, 4285, 29423, 1904, -2037, 1560, -974, 491, -190, 49},
+    {-4, 46, -192, 526, -1112, 1947, -2972, 4357, 29414, 1840, -2011, 1549, -969, 490, -190, 49},
+    {-4, 46, -191, 526, -1115, 1957, -2997, 4429, 29405, 1776, -1985, 1537, -965, 489, -189, 49},
+    {-4, 46, -191, 527, -1118, 1967, -3023, 4501, 29397, 1713, -1959, 1525, -960, 487, -189, 49},
+    {-4, 46, -191, 527, -1121, 1976, -3048, 4573, 29389, 1649, -1932, 1514, -956, 486, -189, 49},
+    {-4, 46, -191, 528, -1124, 1986, -3073, 4646, 29378, 1586, -1906, 1502, -951, 485, -189, 49},
+    {-4, 46, -191, 528, -1127, 1996, -3098, 4718, 29369, 1523, -1880, 1491, -947, 483, -188, 49},
+    {-4, 45, -191, 529, -1130, 2005, -3123, 4791, 29359, 1460, -1853, 1479, -942, 482, -188, 49},
+    {-4, 45, -190, 529, -1133, 2015, -3148, 4864, 29347, 1398, -1827, 1467, -937, 481, -188, 49},
+    {-4, 45, -190, 530, -1136, 2024, -3173, 4937, 29337, 1336, -1801, 1456, -933, 479, -188, 49},
+    {-4, 45, -190, 530, -1139, 2034, -3198, 5010, 29325, 1274, -1775, 1444, -928, 478, -187, 49},
+    {-4, 45, -190, 530, -1142, 2043, -3223, 5084, 29314, 1212, -1748, 1432, -923, 476, -187, 49},
+    {-4, 45, -190, 531, -1145, 2052, -3248, 5157, 29304, 1150, -1722, 1420, -919, 475, -187, 49},
+    {-4, 45, -189, 531, -1147, 2061, -3273, 5231, 29290, 1089, -1696, 1408, -914, 473, -186, 49},
+    {-4, 44, -189, 531, -1150, 2070, -3298, 5305, 29279, 1028, -1670, 1396, -909, 472, -186, 49},
+    {-4, 44, -189, 532, -1153, 2080, -3322, 5379, 29264, 967, -1644, 1385, -904, 470, -186, 49},
+    {-4, 44, -189, 532, -1155, 2089, -3347, 5453, 29250, 907, -1617, 1373, -900, 469, -186, 49},
+    {-4, 44, -188, 532, -1158, 2098, -3372, 5528, 29237, 846, -1591, 1361, -895, 467, -185, 48},
+    {-4, 44, -188, 532, -1160, 2106, -3396, 5602, 29224, 786, -1565, 1349, -890, 465, -185, 48},
+    {-4, 43, -188, 532, -1163, 2115, -3420, 5677, 29209, 726, -1539, 1337, -885, 464, -184, 48},
+    {-4, 43, -187, 533, -1165, 2124, -3445, 5752, 29192, 667, -1513, 1325, -880, 462, -184, 48},
+    {-4, 43, -187, 533, -1168, 2133, -3469, 5827, 29176, 608, -1487, 1313, -875, 461, -184, 48},
+    {-4, 43, -187, 533, -1170, 2141, -3493, 5902, 29160, 548, -1460, 1301, -870, 459, -183, 48},
+    {-4, 43, -186, 533, -1172, 2150, -3517, 5978, 29141, 490, -1434, 1289, -865, 457, -183, 48},
+    {-4, 43, -186, 533, -1175, 2158, -3541, 6053, 29127, 431, -1408, 1276, -860, 456, -183, 48},
+    {-4, 42, -186, 533, -1177, 2167, -3565, 6129, 29109, 373, -1382, 1264, -855, 454, -182, 48},
+    {-4, 42, -185, 533, -1179, 2175, -3589, 6205, 29091, 315, -1356, 1252, -850, 452, -182, 48},
+    {-3, 42, -185, 533, -1181, 2184, -3613, 6281, 29070, 257, -1330, 1240, -845, 451, -181, 48},
+    {-3, 42, -185, 533, -1183, 2192, -3637, 6357, 29053, 199, -1304, 1228, -840, 449, -181, 48},
+    {-3, 41, -184, 533, -1185, 2200, -3661, 6433, 29035, 142, -1278, 1216, -835, 447, -181, 48},
+    {-3, 41, -184, 533, -1187, 2208, -3684, 6510, 29015, 85, -1252, 1203, -830, 445, -180, 48},
+    {-3, 41, -183, 533, -1189, 2216, -3708, 6586, 28996, 28, -1227, 1191, -825, 444, -180, 48},
+    {-3, 41, -183, 533, -1191, 2224, -3731, 6663, 28973, -28, -1201, 1179, -819, 442, -179, 48},
+    {-3, 41, -183, 533, -1193, 2232, -3755, 6740, 28953, -84, -1175, 1167, -814, 440, -179, 48},
+    {-3, 40, -182, 532, -1195, 2240, -3778, 6817, 28933, -140, -1149, 1154, -809, 438, -178, 48},
+    {-3, 40, -182, 532, -1196, 2247, -3801, 6894, 28913, -196, -1123, 1142, -804, 436, -178, 47},
+    {-3, 40, -181, 532, -1198, 2255, -3824, 6971, 28889, -252, -1098, 1130, -798, 435, -177, 47},
+    {-3, 40, -181, 532, -1200, 2263, -3847, 7049, 28866, -307, -1072, 1118, -793, 433, -177, 47},
+    {-3, 39, -180, 532, -1201, 2270, -3870, 7126, 28845, -362, -1046, 1105, -788, 431, -177, 47},
+    {-3, 39, -180, 531, -1203, 2277, -3893, 7204, 28823, -416, -1021, 1093, -783, 429, -176, 47},
+    {-3, 39, -179, 531, -1204, 2285, -3916, 7282, 28797, -471, -995, 1081, -777, 427, -176, 47},
+    {-3, 39, -179, 531, -1206, 2292, -3938, 7360, 28773, -525, -969, 1068, -772, 425, -175, 47},
+    {-3, 38, -178, 530, -1207, 2299, -3961, 7438, 28751, -579, -944, 1056, -767, 423, -175, 47},
+    {-3, 38, -178, 530, -1209, 2306, -3983, 7516, 28725, -633, -918, 1044, -761, 421, -174, 47},
+    {-3, 38, -177, 529, -1210, 2313, -4006, 7594, 28701, -686, -893, 1031, -756, 420, -174, 47},
+    {-3, 37, -176, 529, -1211, 2320, -4028, 7673, 28673, -739, -868, 1019, -750, 418, -173, 47},
+    {-3, 37, -176, 528, -1213, 2327, -4050, 7751, 28650, -792, -842, 1006, -745, 416, -173, 47},
+    {-3, 37, -175, 528, -1214, 2334, -4072, 7830, 28622, -844, -817, 994, -740, 414, -172, 46},
+    {-2, 37, -175, 527, -1215, 2341, -4094, 7909, 28594, -897, -792, 982, -734, 412, -171, 46},
+    {-2, 36, -174, 527, -1216, 2347, -4116, 7987, 28569, -949, -766, 969, -729, 410, -171, 46},
+    {-2, 36, -173, 526, -1217, 2354, -4138, 8066, 28539, -1000, -741, 957, -723, 408, -170, 46},
+    {-2, 36, -173, 526, -1218, 2360, -4160, 8145, 28514, -1052, -716, 944, -718, 406, -170, 46},
+    {-2, 35, -172, 525, -1219, 2367, -4181, 8225, 28483, -1103, -691, 932, -712, 404, -169, 46},
+    {-2, 35, -171, 524, -1220, 2373, -4203, 8304, 28456, -1154, -666, 920, -707, 402, -169, 46},
+    {-2, 35, -171, 524, -1221, 2379, -4224, 8383, 28426, -1204, -641, 907, -701, 400, -168, 46},
+    {-2, 34, -170, 523, -1221, 2385, -4245, 8463, 28397, -1255, -616, 895, -696, 398, -168, 46},
+    {-2, 34, -169, 522, -1222, 2391, -4266, 8543, 28367, -1305, -591, 882, -690, 396, -167, 45},
+    {-2, 34, -169, 521, -1223, 2397, -4287, 8622, 28338, -1355, -566, 870, -684, 393, -166, 45},
+    {-2, 33, -168, 521, -1223, 2403, -4308, 8702, 28308, -1404, -542, 857, -679, 391, -166, 45},
+    {-2, 33, -167, 520, -1224, 2409, -4329, 8782, 28275, -1453, -517, 845, -673, 389, -165, 45},
+    {-2, 33, -166, 519, -1224, 2415, -4350, 8862, 28243, -1502, -492, 833, -668, 387, -165, 45},
+    {-2, 32, -166, 518, -1225, 2420, -4370, 8942, 28214, -1551, -468, 820, -662, 385, -164, 45},
+    {-2, 32, -165, 517, -1225, 2426, -4391, 9022, 28179, -1599, -443, 808, -656, 383, -163, 45},
+    {-1, 32, -164, 516, -1226, 2431, -4411, 9102, 28148, -1647, -419, 795, -651, 381, -163, 45},
+    {-1, 31, -163, 515, -1226, 2437, -4431, 9183, 28113, -1695, -394, 783, -645, 379, -162, 44},
+    {-1, 31, -163, 514, -1226, 2442, -4451, 9263, 28082, -1743, -370, 771, -640, 377, -162, 44},
+    {-1, 31, -162, 513, -1226, 2447, -4471, 9344, 28047, -1790, -345, 758, -634, 374, -161, 44},
+    {-1, 30, -161, 512, -1226, 2452, -4491, 9424, 28013, -1837, -321, 746, -628, 372, -160, 44},
+    {-1, 30, -160, 511, -1227, 2457, -4511, 9505, 27981, -1884, -297, 733, -623, 370, -160, 44},
+    {-1, 30, -159, 510, -1227, 2462, -4530, 9586, 27943, -1930, -273, 721, -617, 368, -159, 44},
+    {-1, 29, -158, 509, -1227, 2467, -4549, 9667, 27907, -1976, -249, 708, -611, 366, -158, 44},
+    {-1, 29, -158, 508, -1226, 2471, -4569, 9748, 27872, -2022, -225, 696, -605, 364, -158, 44},
+    {-1, 28, -157, 507, -1226, 2476, -4588, 9829, 27838, -2068, -201, 684, -600, 361, -157, 43},
+    {-1, 28, -156, 506, -1226, 2481, -4607, 9910, 27800, -2113, -177, 671, -594, 359, -156, 43},
+    {-1, 28, -155, 504, -1226, 2485, -4626, 9991, 27764, -2158, -153, 659, -588, 357, -156, 43},
+    {0, 27, -154, 503, -1226, 2489, -4645, 10072, 27727, -2203, -129, 647, -583, 355, -155, 43},
+    {0, 27, -153, 502, -1225, 2493, -4663, 10153, 27689, -2247, -106, 634, -577, 352, -154, 43},
+    {0, 26, -152, 501, -1225, 2498, -4682, 10235, 27650, -2291, -82, 622, -571, 350, -154, 43},
+    {0, 26, -151, 499, -1224, 2502, -4700, 10316, 27612, -2335, -59, 610, -565, 348, -153, 42},
+    {0, 26, -150, 498, -1224, 2506, -4718, 10397, 27573, -2379, -35, 597, -559, 346, -152, 42},
+    {0, 25, -149, 497, -1223, 2509, -4736, 10479, 27536, -2422, -12, 585, -554, 343, -152, 42},
+    {0, 25, -148, 495, -1223, 2513, -4754, 10561, 27495, -2465, 12, 573, -548, 341, -151, 42},
+    {0, 24, -147, 494, -1222, 2517, -4772, 10642, 27456, -2508, 35, 560, -542, 339, -150, 42},
+    {0, 24, -146, 492, -1221, 2520, -4790, 10724, 27415, -2550, 58, 548, -536, 337, -149, 42},
+    {0, 24, -145, 491, -1221, 2524, -4807, 10806, 27375, -2592, 81, 536, -531, 334, -149, 42},
+    {0, 23, -144, 489, -1220, 2527, -4825, 10887, 27337, -2634, 104, 524, -525, 332, -148, 41},
+    {1, 23, -143, 488, -1219, 2530, -4842, 10969, 27294, -2676, 127, 511, -519, 330, -147, 41},
+    {1, 22, -142, 486, -1218, 2534, -4859, 11051, 27253, -2717, 150, 499, -513, 327, -147, 41},
+    {1, 22, -141, 484, -1217, 2537, -4876, 11133, 27210, -2758, 173, 487, -507, 325, -146, 41},
+    {1, 21, -140, 483, -1216, 2540, -4892, 11215, 27167, -2799, 196, 475, -502, 323, -145, 41},
+    {1, 21, -139, 481, -1215, 2543, -4909, 11297, 27125, -2839, 218, 463, -496, 320, -144, 41},
+    {1, 20, -138, 480, -1213, 2545, -4925, 11379, 27082, -2879, 241, 451, -490, 318, -144, 40},
+    {1, 20, -137, 478, -1212, 2548, -4942, 11461, 27040, -2919, 263, 438, -484, 316, -143, 40},
+    {1, 19, -136, 476, -1211, 2550, -4958, 11543, 26997, -2958, 286, 426, -478, 313, -142, 40},
+    {1, 19, -134, 474, -1210, 2553, -4974, 11625, 26952, -2998, 308, 414, -472, 311, -141, 40},
+    {1, 19, -133, 472, -1208, 2555, -4990, 11707, 26909, -3037, 330, 402, -467, 309, -141, 40},
+    {2, 18, -132, 471, -1207, 2557, -5005, 11790, 26862, -3075, 352, 390, -461, 306, -140, 40},
+    {2, 18, -131, 469, -1205, 2560, -5021, 11872, 26817, -3114, 374, 378, -455, 304, -139, 39},
+    {2, 17, -130, 467, -1204, 2562, -5036, 11954, 26772, -3152, 396, 366, -449, 302, -138, 39},
+    {2, 17, -129, 465, -1202, 2564, -5051, 12036, 26726, -3189, 418, 354, -443, 299, -138, 39},
+    {2, 16, -127, 463, -1200, 2565, -5066, 12119, 26680, -3227, 440, 342, -438, 297, -137, 39},
+    {2, 16, -126, 461, -1198, 2567, -5081, 12201, 26632, -3264, 462, 330, -432, 295, -136, 39},
+    {2, 15, -125, 459, -1197, 2569, -5096, 12283, 26588, -3301, 484, 318, -426, 292, -135, 38},
+    {2, 15, -124, 457, -1195, 2570, -5110, 12366, 26540, -3337, 505, 306, -420, 290, -135, 38},
+    {2, 14, -123, 455, -1193, 2572, -5124, 12448, 26493, -3374, 527, 294, -414, 287, -134, 38},
+    {3, 14, -121, 453, -1191, 2573, -5139, 12530, 26444, -3410, 548, 282, -408, 285, -133, 38},
+    {3, 13, -120, 451, -1189, 2574, -5153, 12613, 26395, -3445, 569, 271, -403, 283, -132, 38},
+    {3, 13, -119, 449, -1187, 2575, -5166, 12695, 26347, -3481, 591, 259, -397, 280, -132, 38},
+    {3, 12, -117, 447, -1184, 2576, -5180, 12777, 26298, -3516, 612, 247, -391, 278, -131, 37},
+    {3, 12, -116, 444, -1182, 2577, -5193, 12860, 26249, -3551, 633, 235, -385, 275, -130, 37},
+    {3, 11, -115, 442, -1180, 2578, -5207, 12942, 26200, -3585, 654, 223, -379, 273, -129, 37},
+    {3, 10, -114, 440, -1178, 2578, -5220, 13025, 26151, -3619, 674, 212, -374, 271, -128, 37},
+    {3, 10, -112, 438, -1175, 2579, -5233, 13107, 26100, -3653, 695, 200, -368, 268, -128, 37},
+    {3, 9, -111, 435, -1173, 2579, -5246, 13189, 26053, -3687, 716, 188, -362, 266, -127, 36},
+    {4, 9, -110, 433, -1170, 2580, -5258, 13272, 25998, -3720, 736, 177, -356, 263, -126, 36},
+    {4, 8, -108, 431, -1168, 2580, -5270, 13354, 25946, -3753, 757, 165, -350, 261, -125, 36},
+    {4, 8, -107, 428, -1165, 2580, -5283, 13437, 25897, -3786, 777, 153, -345, 258, -124, 36},
+    {4, 7, -105, 426, -1162, 2580, -5295, 13519, 25845, -3819, 797, 142, -339, 256, -124, 36},
+    {4, 7, -104, 423, -1159, 2580, -5307, 13601, 25793, -3851, 818, 130, -333, 254, -123, 35},
+    {4, 6, -103, 421, -1157, 2579, -5318, 13684, 25741, -3883, 838, 119, -327, 251, -122, 35},
+    {4, 6, -101, 418, -1154, 2579, -5330, 13766, 25687, -3914, 858, 107, -321, 249, -121, 35},
+    {5, 5, -100, 416, -1151, 2579, -5341, 13848, 25634, -3946, 878, 96, -316, 246, -120, 35},
+    {5, 4, -98, 413, -1148, 2578, -5352, 13930, 25581, -3976, 897, 85, -310, 244, -120, 35},
+    {5, 4, -97, 411, -1145, 2577, -5363, 14013, 25527, -4007, 917, 73, -304, 241, -119, 35},
+    {5, 3, -95, 408, -1142, 2577, -5373, 14095, 25472, -4038, 937, 62, -298, 239, -118, 34},
+    {5, 3, -94, 406, -1138, 2576, -5384, 14177, 25417, -4068, 956, 51, -293, 237, -117, 34},
+    {5, 2, -92, 403, -1135, 2575, -5394, 14259, 25362, -4097, 976, 39, -287, 234, -116, 34},
+    {5, 1, -91, 400, -1132, 2573, -5404, 14341, 25310, -4127, 995, 28, -281, 232, -116, 34},
+    {5, 1, -89, 398, -1128, 2572, -5414, 14423, 25252, -4156, 1014, 17, -275, 229, -115, 34},
+    {6, 0, -88, 395, -1125, 2571, -5424, 14505, 25198, -4185, 1033, 6, -270, 227, -114, 33},
+    {6, 0, -86, 392, -1122, 2569, -5434, 14587, 25144, -4214, 1052, -6, -264, 224, -113, 33},
+    {6, -1, -85, 389, -1118, 2568, -5443, 14669, 25086, -4242, 1071, -17, -258, 222, -112, 33},
+    {6, -2, -83, 386, -1114, 2566, -5452, 14751, 25030, -4270, 1090, -28, -253, 219, -111, 33},
+    {6, -2, -82, 384, -1111, 2564, -5461, 14833, 24974, -4298, 1108, -39, -247, 217, -111, 33},
+    {6, -3, -80, 381, -1107, 2562, -5470, 14915, 24916, -4325, 1127, -50, -241, 215, -110, 32},
+    {6, -3, -79, 378, -1103, 2560, -5478, 14997, 24858, -4352, 1145, -61, -235, 212, -109, 32},
+    {7, -4, -77, 375, -1099, 2558, -5486, 15079, 24798, -4379, 1164, -72, -230, 210, -108, 32},
+    {7, -5, -75, 372, -1095, 2555, -5494, 15160, 24742, -4406, 1182, -83, -224, 207, -107, 32},
+    {7, -5, -74, 369, -1092, 2553, -5502, 15242, 24684, -4432, 1200, -94, -219, 205, -106, 32},
+    {7, -6, -72, 366, -1087, 2550, -5510, 15324, 24626, -4458, 1218, -104, -213, 202, -106, 31},
+    {7, -6, -70, 363, -1083, 2548, -5517, 15405, 24565, -4484, 1236, -115, -207, 200, -105, 31},
+    {7, -7, -69, 360, -1079, 2545, -5525, 15487, 24508, -4509, 1254, -126, -202, 197, -104, 31},
+    {7, -8, -67, 357, -1075, 2542, -5532, 15568, 24448, -4534, 1272, -137, -196, 195, -103, 31},
+    {8, -8, -66, 353, -1071, 2539, -5539, 15650, 24387, -4559, 1289, -147, -190, 193, -102, 31},
+    {8, -9, -64, 350, -1066, 2536, -5545, 15731, 24327, -4583, 1307, -158, -185, 190, -101, 30},
+    {8, -10, -62, 347, -1062, 2533, -5552, 15812, 24269, -4608, 1324, -169, -179, 188, -101, 30},
+    {8, -10, -60, 344, -1058, 2529, -5558, 15893, 24209, -4632, 1341, -179, -174, 185, -100, 30},
+    {8, -11, -59, 341, -1053, 2526, -5564, 15974, 24146, -4655, 1359, -190, -168, 183, -99, 30},
+    {8, -12, -57, 337, -1049, 2522, -5569, 16055, 24087, -4678, 1376, -200, -163, 180, -98, 29},
+    {9, -12, -55, 334, -1044, 2518, -5575, 16136, 24024, -4702, 1393, -211, -157, 178, -97, 29},
+    {9, -13, -54, 331, -1039, 2514, -5580, 16217, 23963, -4724, 1409, -221, -152, 175, -96, 29},
+    {9, -14, -52, 328, -1034, 2510, -5585, 16298, 23900, -4747, 1426, -231, -146, 173, -96, 29},
+    {9, -14, -50, 324, -1030, 2506, -5590, 16379, 23838, -4769, 1443, -242, -141, 171, -95, 29},
+    {9, -15, -48, 321, -1025, 2502, -5595, 16459, 23777, -4791, 1459, -252, -135, 168, -94, 28},
+    {9, -16, -47, 317, -1020, 2498, -5599, 16540, 23713, -4812, 1476, -262, -130, 166, -93, 28},
+    {10, -16, -45, 314, -1015, 2493, -5604, 16620, 23650, -4834, 1492, -272, -124, 163, -92, 28},
+    {10, -17, -43, 310, -1010, 2489, -5607, 16701, 23586, -4855, 1508, -283, -119, 161, -91, 28},
+    {10, -18, -41, 307, -1005, 2484, -5611, 16781, 23522, -4875, 1524, -293, -113, 158, -90, 28},
+    {10, -18, -39, 303, -1000, 2479, -5615, 16861, 23461, -4896, 1540, -303, -108, 156, -90, 27},
+    {10, -19, -37, 300, -994, 2474, -5618, 16941, 23394, -4916, 1556, -313, -102, 154, -89, 27},
+    {10, -20, -36, 296, -989, 2469, -5621, 17021, 23333, -4936, 1571, -323, -97, 151, -88, 27},
+    {11, -21, -34, 293, -984, 2464, -5624, 17101, 23266, -4955, 1587, -333, -92, 149, -87, 27},
+    {11, -21, -32, 289, -978, 2459, -5627, 17181, 23201, -4975, 1602, -343, -86, 146, -86, 27},
+    {11, -22, -30, 285, -973, 2453, -5629, 17261, 23136, -4994, 1618, -352, -81, 144, -85, 26},
+    {11, -23, -28, 282, -967, 2448, -5631, 17340, 23070, -5012, 1633, -362, -76, 142, -85, 26},
+    {11, -23, -26, 278, -962, 2442, -5633, 17420, 23005, -5031, 1648, -372, -70, 139, -84, 26},
+    {11, -24, -24, 274, -956, 2436, -5635, 17499, 22940, -5049, 1663, -382, -65, 137, -83, 26},
+    {12, -25, -23, 270, -950, 2430, -5636, 17578, 22874, -5067, 1678, -391, -60, 134, -82, 26},
+    {12, -26, -21, 267, -945, 2424, -5637, 17658, 22806, -5084, 1693, -401, -54, 132, -81, 25},
+    {12, -26, -19, 263, -939, 2418, -5638, 17737, 22739, -5102, 1707, -410, -49, 130, -80, 25},
+    {12, -27, -17, 259, -933, 2412, -5639, 17815, 22675, -5119, 1722, -420, -44, 127, -80, 25},
+    {12, -28, -15, 255, -927, 2405, -5639, 17894, 22607, -5135, 1736, -429, -39, 125, -79, 25},
+    {12, -28, -13, 251, -921, 2399, -5640, 17973, 22538, -5152, 1751, -439, -33, 123, -78, 25},
+    {13, -29, -11, 247, -915, 2392, -5640, 18052, 22471, -5168, 1765, -448, -28, 120, -77, 24},
+    {13, -30, -9, 243, -909, 2385, -5639, 18130, 22404, -5184, 1779, -458, -23, 118, -76, 24},
+    {13, -31, -7, 240, -903, 2378, -5639, 18208, 22336, -5199, 1793, -467, -18, 115, -75, 24},
+    {13, -31, -5, 236, -896, 2371, -5638, 18287, 22265, -5215, 1807, -476, -13, 113, -74, 24},
+    {13, -32, -3, 232, -890, 2364, -5637, 18365, 22199, -5230, 1820, -485, -8, 111, -74, 23},
+    {14, -33, -1, 228, -884, 2357, -5636, 18443, 22129, -5244, 1834, -494, -3, 108, -73, 23},
+    {14, -34, 1, 223, -877, 2349, -5634, 18520, 22062, -5259, 1847, -504, 3, 106, -72, 23},
+    {14, -34, 3, 219, -871, 2342, -5633, 18598, 21991, -5273, 1861, -513, 8, 104, -71, 23},
+    {14, -35, 5, 215, -864, 2334, -5631, 18676, 21922, -5287, 1874, -522, 13, 101, -70, 23},
+    {14, -36, 7, 211, -858, 2326, -5628, 18753, 21852, -5300, 1887, -530, 18, 99, -69, 22},
+    {14, -37, 9, 207, -851, 2318, -5626, 18830, 21784, -5314, 1900, -539, 23, 97, -69, 22},
+    {15, -37, 11, 203, -844, 2310, -5623, 18907, 21712, -5327, 1913, -548, 28, 94, -68, 22},
+    {15, -38, 13, 199, -838, 2302, -5620, 18984, 21642, -5340, 1926, -557, 33, 92, -67, 22},
+    {15, -39, 15, 194, -831, 2294, -5617, 19061, 21572, -5352, 1938, -566, 38, 90, -66, 22},
+    {15, -40, 17, 190, -824, 2285, -5614, 19138, 21501, -5364, 1951, -574, 43, 88, -65, 21},
+    {15, -40, 19, 186, -817, 2277, -5610, 19214, 21431, -5376, 1963, -583, 48, 85, -65, 21},
+    {16, -41, 22, 182, -810, 2268, -5606, 19291, 21359, -5388, 1975, -592, 52, 83, -64, 21},
+    {16, -42, 24, 177, -803, 2259, -5602, 19367, 21288, -5399, 1987, -600, 57, 81, -63, 21},
+    {16, -43, 26, 173, -796, 2250, -5597, 19443, 21218, -5411, 1999, -609, 62, 78, -62, 21},
+    {16, -44, 28, 169, -789, 2241, -5592, 19519, 21145, -5421, 2011, -617, 67, 76, -61, 20},
+    {16, -44, 30, 164, -781, 2232, -5587, 19594, 21072, -5432, 2023, -625, 72, 74, -60, 20},
+    {16, -45, 32, 160, -774, 2223, -5582, 19670, 21000, -5442, 2035, -634, 77, 72, -60, 20},
+    {17, -46, 34, 155, -767, 2214, -5577, 19745, 20929, -5452, 2046, -642, 82, 69, -59, 20},
+    {17, -47, 36, 151, -759, 2204, -5571, 19821, 20855, -5462, 2058, -650, 86, 67, -58, 20},
+    {17, -48, 39, 146, -752, 2194, -5565, 19896, 20784, -5472, 2069, -658, 91, 65, -57, 19},
+    {17, -48, 41, 142, -744, 2185, -5558, 19971, 20707, -5481, 2080, -666, 96, 63, -56, 19},
+    {17, -49, 43, 137, -737, 2175, -5552, 20045, 20639, -5490, 2091, -674, 100, 60, -56, 19},
+    {18, -50, 45, 133, -729, 2165, -5545, 20120, 20562, -5498, 2102, -682, 105, 58, -55, 19},
+    {18, -51, 47, 128, -722, 2154, -5538, 20194, 20491, -5507, 2113, -690, 110, 56, -54, 19},
+    {18, -52, 49, 124, -714, 2144, -5531, 20269, 20418, -5515, 2123, -698, 114, 54, -53, 18},
+    {18, -52, 52, 119, -706, 2134, -5523, 20341, 20343, -5523, 2134, -706, 119, 52, -52, 18},
+    {18, -53, 54, 114, -698, 2123, -5515, 20418, 20269, -5531, 2144, -714, 124, 49, -52, 18},
+    {19, -54, 56, 110, -690, 2113, -5507, 20491, 20194, -5538, 2154, -722, 128, 47, -51, 18},
+    {19, -55, 58, 105, -682, 2102, -5498, 20562, 20120, -5545, 2165, -729, 133, 45, -50, 18},
+    {19, -56, 60, 100, -674, 2091, -5490, 20639, 20045, -5552, 2175, -737, 137, 43, -49, 17},
+    {19, -56, 63, 96, -666, 2080, -5481, 20707, 19971, -5558, 2185, -744, 142, 41, -48, 17},
+    {19, -57, 65, 91, -658, 2069, -5472, 20784, 19896, -5565, 2194, -752, 146, 39, -48, 17},
+    {20, -58, 67, 86, -650, 2058, -5462, 20855, 19821, -5571, 2204, -759, 151, 36, -47, 17},
+    {20, -59, 69, 82, -642, 2046, -5452, 20929, 19745, -5577, 2214, -767, 155, 34, -46, 17},
+    {20, -60, 72, 77, -634, 2035, -5442, 21000, 19670, -5582, 2223, -774, 160, 32, -45, 16},
+    {20, -60, 74, 72, -625, 2023, -5432, 21072, 19594, -5587, 2232, -781, 164, 30, -44, 16},
+    {20, -61, 76, 67, -617, 2011, -5421, 21145, 19519, -5592, 2241, -789, 169, 28, -44, 16},
+    {21, -62, 78, 62, -609, 1999, -5411, 21218, 19443, -5597, 2250, -796, 173, 26, -43, 16},
+    {21, -63, 81, 57, -600, 1987, -5399, 21288, 19367, -5602, 2259, -803, 177, 24, -42, 16},
+    {21, -64, 83, 52, -592, 1975, -5388, 21359, 19291, -5606, 2268, -810, 182, 22, -41, 16},
+    {21, -65, 85, 48, -583, 1963, -5376, 21431, 19214, -5610, 2277, -817, 186, 19, -40, 15},
+    {21, -65, 88, 43, -574, 1951, -5364, 21501, 19138, -5614, 2285, -824, 190, 17, -40, 15},
+    {22, -66, 90, 38, -566, 1938, -5352, 21572, 19061, -5617, 2294, -831, 194, 15, -39, 15},
+    {22, -67, 92, 33, -557, 1926, -5340, 21642, 18984, -5620, 2302, -838, 199, 13, -38, 15},
+    {22, -68, 94, 28, -548, 1913, -5327, 21712, 18907, -5623, 2310, -844, 203, 11, -37, 15},
+    {22, -69, 97, 23, -539, 1900, -5314, 21784, 18830, -5626, 2318, -851, 207, 9, -37, 14},
+    {22, -69, 99, 18, -530, 1887, -5300, 21852, 18753, -5628, 2326, -858, 211, 7, -36, 14},
+    {23, -70, 101, 13, -522, 1874, -5287, 21922, 18676, -5631, 2334, -864, 215, 5, -35, 14},
+    {23, -71, 104, 8, -513, 1861, -5273, 21991, 18598, -5633, 2342, -871, 219, 3, -34, 14},
+    {23, -72, 106, 3, -504, 1847, -5259, 22062, 18520, -5634, 2349, -877, 223, 1, -34, 14},
+    {23, -73, 108, -3, -494, 1834, -5244, 22129, 18443, -5636, 2357, -884, 228, -1, -33, 14},
+    {23, -74, 111, -8, -485, 1820, -5230, 22199, 18365, -5637, 2364, -890, 232, -3, -32, 13},
+    {24, -74, 113, -13, -476, 1807, -5215, 22265, 18287, -5638, 2371, -896, 236, -5, -31, 13},
+    {24, -75, 115, -18, -467, 1793, -5199, 22336, 18208, -5639, 2378, -903, 240, -7, -31, 13},
+    {24, -76, 118, -23, -458, 1779, -5184, 22404, 18130, -5639, 2385, -909, 243, -9, -30, 13},
+    {24, -77, 120, -28, -448, 1765, -5168, 22471, 18052, -5640, 2392, -915, 247, -11, -29, 13},
+    {25, -78, 123, -33, -439, 1751, -5152, 22538, 17973, -5640, 2399, -921, 251, -13, -28, 12},
+    {25, -79, 125, -39, -429, 1736, -5135, 22607, 17894, -5639, 2405, -927, 255, -15, -28, 12},
+    {25, -80, 127, -44, -420, 1722, -5119, 22675, 17815, -5639, 2412, -933, 259, -17, -27, 12},
+    {25, -80, 130, -49, -410, 1707, -5102, 22739, 17737, -5638, 2418, -939, 263, -19, -26, 12},
+    {25, -81, 132, -54, -401, 1693, -5084, 22806, 17658, -5637, 2424, -945, 267, -21, -26, 12},
+    {26, -82, 134, -60, -391, 1678, -5067, 22874, 17578, -5636, 2430, -950, 270, -23, -25, 12},
+    {26, -83, 137, -65, -382, 1663, -5049, 22940, 17499, -5635, 2436, -956, 274, -24, -24, 11},
+    {26, -84, 139, -70, -372, 1648, -5031, 23005, 17420, -5633, 2442, -962, 278, -26, -23, 11},
+    {26, -85, 142, -76, -362, 1633, -5012, 23070, 17340, -5631, 2448, -967, 282, -28, -23, 11},
+    {26, -85, 144, -81, -352, 1618, -4994, 23136, 17261, -5629, 2453, -973, 285, -30, -22, 11},
+    {27, -86, 146, -86, -343, 1602, -4975, 23201, 17181, -5627, 2459, -978, 289, -32, -21, 11},
+    {27, -87, 149, -92, -333, 1587, -4955, 23266, 17101, -5624, 2464, -984, 293, -34, -21, 11},
+    {27, -88, 151, -97, -323, 1571, -4936, 23333, 17021, -5621, 2469, -989, 296, -36, -20, 10},
+    {27, -89, 154, -102, -313, 1556, -4916, 23394, 16941, -5618, 2474, -994, 300, -37, -19, 10},
+    {27, -90, 156, -108, -303, 1540, -4896, 23461, 16861, -5615, 2479, -1000, 303, -39, -18, 10},
+    {28, -90, 158, -113, -293, 1524, -4875, 23522, 16781, -5611, 2484, -1005, 307, -41, -18, 10},
+    {28, -91, 161, -119, -283, 1508, -4855, 23586, 16701, -5607, 2489, -1010, 310, -43, -17, 10},
+    {28, -92, 163, -124, -272, 1492, -4834, 23650, 16620, -5604, 2493, -1015, 314, -45, -16, 10},
+    {28, -93, 166, -130, -262, 1476, -4812, 23713, 16540, -5599, 2498, -1020, 317, -47, -16, 9},
+    {28, -94, 168, -135, -252, 1459, -4791, 23777, 16459, -5595, 2502, -1025, 321, -48, -15, 9},
+    {29, -95, 171, -141, -242, 1443, -4769, 23838, 16379, -5590, 2506, -1030, 324, -50, -14, 9},
+    {29, -96, 173, -146, -231, 1426, -4747, 23900, 16298, -5585, 2510, -1034, 328, -52, -14, 9},
+    {29, -96, 175, -152, -221, 1409, -4724, 23963, 16217, -5580, 2514, -1039, 331, -54, -13, 9},
+    {29, -97, 178, -157, -211, 1393, -4702, 24024, 16136, -5575, 2518, -1044, 334, -55, -12, 9},
+    {29, -98, 180, -163, -200, 1376, -4678, 24087, 16055, -5569, 2522, -1049, 337, -57, -12, 8},
+    {30, -99, 183, -168, -190, 1359, -4655, 24146, 15974, -5564, 2526, -1053, 341, -59, -11, 8},
+    {30, -100, 185, -174, -179, 1341, -4632, 24209, 15893, -5558, 2529, -1058, 344, -60, -10, 8},
+    {30, -101, 188, -179, -169, 1324, -4608, 24269, 15812, -5552, 2533, -1062, 347, -62, -10, 8},
+    {30, -101, 190, -185, -158, 1307, -4583, 24327, 15731, -5545, 2536, -1066, 350, -64, -9, 8},
+    {31, -102, 193, -190, -147, 1289, -4559, 24387, 15650, -5539, 2539, -1071, 353, -66, -8, 8},
+    {31, -103, 195, -196, -137, 1272, -4534, 24448, 15568, -5532, 2542, -1075, 357, -67, -8, 7},
+    {31, -104, 197, -202, -126, 1254, -4509, 24508, 15487, -5525, 2545, -1079, 360, -69, -7, 7},
+    {31, -105, 200, -207, -115, 1236, -4484, 24565, 15405, -5517, 2548, -1083, 363, -70, -6, 7},
+    {31, -106, 202, -213, -104, 1218, -4458, 24626, 15324, -5510, 2550, -1087, 366, -72, -6, 7},
+    {32, -106, 205, -219, -94, 1200, -4432, 24684, 15242, -5502, 2553, -1092, 369, -74, -5, 7},
+    {32, -107, 207, -224, -83, 1182, -4406, 24742, 15160, -5494, 2555, -1095, 372, -75, -5, 7},
+    {32, -108, 210, -230, -72, 1164, -4379, 24798, 15079, -5486, 2558, -1099, 375, -77, -4, 7},
+    {32, -109, 212, -235, -61, 1145, -4352, 24858, 14997, -5478, 2560, -1103, 378, -79, -3, 6},
+    {32, -110, 215, -241, -50, 1127, -4325, 24916, 14915, -5470, 2562, -1107, 381, -80, -3, 6},
+    {33, -111, 217, -247, -39, 1108, -4298, 24974, 14833, -5461, 2564, -1111, 384, -82, -2, 6},
+    {33, -111, 219, -253, -28, 1090, -4270, 25030, 14751, -5452, 2566, -1114, 386, -83, -2, 6},
+    {33, -112, 222, -258, -17, 1071, -4242, 25086, 14669, -5443, 2568, -1118, 389, -85, -1, 6},
+    {33, -113, 224, -264, -6, 1052, -4214, 25144, 14587, -5434, 2569, -1122, 392, -86, 0, 6},
+    {33, -114, 227, -270, 6, 1033, -4185, 25198, 14505, -5424, 2571, -1125, 395, -88, 0, 6},
+    {34, -115, 229, -275, 17, 1014, -4156, 25252, 14423, -5414, 2572, -1128, 398, -89, 1, 5},
+    {34, -116, 232, -281, 28, 995, -4127, 25310, 14341, -5404, 2573, -1132, 400, -91, 1, 5},
+    {34, -116, 234, -287, 39, 976, -4097, 25362, 14259, -5394, 2575, -1135, 403, -92, 2, 5},
+    {34, -117, 237, -293, 51, 956, -4068, 25417, 14177, -5384, 2576, -1138, 406, -94, 3, 5},
+    {34, -118, 239, -298, 62, 937, -4038, 25472, 14095, -5373, 2577, -1142, 408, -95, 3, 5},
+    {35, -119, 241, -304, 73, 917, -4007, 25527, 14013, -5363, 2577, -1145, 411, -97, 4, 5},
+    {35, -120, 244, -310, 85, 897, -3976, 25581, 13930, -5352, 2578, -1148, 413, -98, 4, 5},
+    {35, -120, 246, -316, 96, 878, -3946, 25634, 13848, -5341, 2579, -1151, 416, -100, 5, 5},
+    {35, -121, 249, -321, 107, 858, -3914, 25687, 13766, -5330, 2579, -1154, 418, -101, 6, 4},
+    {35, -122, 251, -327, 119, 838, -3883, 25741, 13684, -5318, 2579, -1157, 421, -103, 6, 4},
+    {35, -123, 254, -333, 130, 818, -3851, 25793, 13601, -5307, 2580, -1159, 423, -104, 7, 4},
+    {36, -124, 256, -339, 142, 797, -3819, 25845, 13519, -5295, 2580, -1162, 426, -105, 7, 4},
+    {36, -124, 258, -345, 153, 777, -3786, 25897, 13437, -5283, 2580, -1165, 428, -107, 8, 4},
+    {36, -125, 261, -350, 165, 757, -3753, 25946, 13354, -5270, 2580, -1168, 431, -108, 8, 4},
+    {36, -126, 263, -356, 177, 736, -3720, 25998, 13272, -5258, 2580, -1170, 433, -110, 9, 4},
+    {36, -127, 266, -362, 188, 716, -3687, 26053, 13189, -5246, 2579, -1173, 435, -111, 9, 3},
+    {37, -128, 268, -368, 200, 695, -3653, 26100, 13107, -5233, 2579, -1175, 438, -112, 10, 3},
+    {37, -128, 271, -374, 212, 674, -3619, 26151, 13025, -5220, 2578, -1178, 440, -114, 10, 3},
+    {37, -129, 273, -379, 223, 654, -3585, 26200, 12942, -5207, 2578, -1180, 442, -115, 11, 3},
+    {37, -130, 275, -385, 235, 633, -3551, 26249, 12860, -5193, 2577, -1182, 444, -116, 12, 3},
+    {37, -131, 278, -391, 247, 612, -3516, 26298, 12777, -5180, 2576, -1184, 447, -117, 12, 3},
+    {38, -132, 280, -397, 259, 591, -3481, 26347, 12695, -5166, 2575, -1187, 449, -119, 13, 3},
+    {38, -132, 283, -403, 271, 569, -3445, 26395, 12613, -5153, 2574, -1189, 451, -120, 13, 3},
+    {38, -133, 285, -408, 282, 548, -3410, 26444, 12530, -5139, 2573, -1191, 453, -121, 14, 3},
+    {38, -134, 287, -414, 294, 527, -3374, 26493, 12448, -5124, 2572, -1193, 455, -123, 14, 2},
+    {38, -135, 290, -420, 306, 505, -3337, 26540, 12366, -5110, 2570, -1195, 457, -124, 15, 2},
+    {38, -135, 292, -426, 318, 484, -3301, 26588, 12283, -5096, 2569, -1197, 459, -125, 15, 2},
+    {39, -136, 295, -432, 330, 462, -3264, 26632, 12201, -5081, 2567, -1198, 461, -126, 16, 2},
+    {39, -137, 297, -438, 342, 440, -3227, 26680, 12119, -5066, 2565, -1200, 463, -127, 16, 2},
+    {39, -138, 299, -443, 354, 418, -3189, 26726, 12036, -5051, 2564, -1202, 465, -129, 17, 2},
+    {39, -138, 302, -449, 366, 396, -3152, 26772, 11954, -5036, 2562, -1204, 467, -130, 17, 2},
+    {39, -139, 304, -455, 378, 374, -3114, 26817, 11872, -5021, 2560, -1205, 469, -131, 18, 2},
+    {40, -140, 306, -461, 390, 352, -3075, 26862, 11790, -5005, 2557, -1207, 471, -132, 18, 2},
+    {40, -141, 309, -467, 402, 330, -3037, 26909, 11707, -4990, 2555, -1208, 472, -133, 19, 1},
+    {40, -141, 311, -472, 414, 308, -2998, 26952, 11625, -4974, 2553, -1210, 474, -134, 19, 1},
+    {40, -142, 313, -478, 426, 286, -2958, 26997, 11543, -4958, 2550, -1211, 476, -136, 19, 1},
+    {40, -143, 316, -484, 438, 263, -2919, 27040, 11461, -4942, 2548, -1212, 478, -137, 20, 1},
+    {40, -144, 318, -490, 451, 241, -2879, 27082, 11379, -4925, 2545, -1213, 480, -138, 20, 1},
+    {41, -144, 320, -496, 463, 218, -2839, 27125, 11297, -4909, 2543, -1215, 481, -139, 21, 1},
+    {41, -145, 323, -502, 475, 196, -2799, 27167, 11215, -4892, 2540, -1216, 483, -140, 21, 1},
+    {41, -146, 325, -507, 487, 173, -2758, 27210, 11133, -4876, 2537, -1217, 484, -141, 22, 1},
+    {41, -147, 327, -513, 499, 150, -2717, 27253, 11051, -4859, 2534, -1218, 486, -142, 22, 1},
+    {41, -147, 330, -519, 511, 127, -2676, 27294, 10969, -4842, 2530, -1219, 488, -143, 23, 1},
+    {41, -148, 332, -525, 524, 104, -2634, 27337, 10887, -4825, 2527, -1220, 489, -144, 23, 0},
+    {42, -149, 334, -531, 536, 81, -2592, 27375, 10806, -4807, 2524, -1221, 491, -145, 24, 0},
+    {42, -149, 337, -536, 548, 58, -2550, 27415, 10724, -4790, 2520, -1221, 492, -146, 24, 0},
+    {42, -150, 339, -542, 560, 35, -2508, 27456, 10642, -4772, 2517, -1222, 494, -147, 24, 0},
+    {42, -151, 341, -548, 573, 12, -2465, 27495, 10561, -4754, 2513, -1223, 495, -148, 25, 0},
+    {42, -152, 343, -554, 585, -12, -2422, 27536, 10479, -4736, 2509, -1223, 497, -149, 25, 0},
+    {42, -152, 346, -559, 597, -35, -2379, 27573, 10397, -4718, 2506, -1224, 498, -150, 26, 0},
+    {42, -153, 348, -565, 610, -59, -2335, 27612, 10316, -4700, 2502, -1224, 499, -151, 26, 0},
+    {43, -154, 350, -571, 622, -82, -2291, 27650, 10235, -4682, 2498, -1225, 501, -152, 26, 0},
+    {43, -154, 352, -577, 634, -106, -2247, 27689, 10153, -4663, 2493, -1225, 502, -153, 27, 0},
+    {43, -155, 355, -583, 647, -129, -2203, 27727, 10072, -4645, 2489, -1226, 503, -154, 27, 0},
+    {43, -156, 357, -588, 659, -153, -2158, 27764, 9991, -4626, 2485, -1226, 504, -155, 28, -1},
+    {43, -156, 359, -594, 671, -177, -2113, 27800, 9910, -4607, 2481, -1226, 506, -156, 28, -1},
+    {43, -157, 361, -600, 684, -201, -2068, 27838, 9829, -4588, 2476, -1226, 507, -157, 28, -1},
+    {44, -158, 364, -605, 696, -225, -2022, 27872, 9748, -4569, 2471, -1226, 508, -158, 29, -1},
+    {44, -158, 366, -611, 708, -249, -1976, 27907, 9667, -4549, 2467, -1227, 509, -158, 29, -1},
+    {44, -159, 368, -617, 721, -273, -1930, 27943, 9586, -4530, 2462, -1227, 510, -159, 30, -1},
+    {44, -160, 370, -623, 733, -297, -1884, 27981, 9505, -4511, 2457, -1227, 511, -160, 30, -1},
+    {44, -160, 372, -628, 746, -321, -1837, 28013, 9424, -4491, 2452, -1226, 512, -161, 30, -1},
+    {44, -161, 374, -634, 758, -345, -1790, 28047, 9344, -4471, 2447, -1226, 513, -162, 31, -1},
+    {44, -162, 377, -640, 771, -370, -1743, 28082, 9263, -4451, 2442, -1226, 514, -163, 31, -1},
+    {44, -162, 379, -645, 783, -394, -1695, 28113, 9183, -4431, 2437, -1226, 515, -163, 31, -1},
+    {45, -163, 381, -651, 795, -419, -1647, 28148, 9102, -4411, 2431, -1226, 516, -164, 32, -1},
+    {45, -163, 383, -656, 808, -443, -1599, 28179, 9022, -4391, 2426, -1225, 517, -165, 32, -2},
+    {45, -164, 385, -662, 820, -468, -1551, 28214, 8942, -4370, 2420, -1225, 518, -166, 32, -2},
+    {45, -165, 387, -668, 833, -492, -1502, 28243, 8862, -4350, 2415, -1224, 519, -166, 33, -2},
+    {45, -165, 389, -673, 845, -517, -1453, 28275, 8782, -4329, 2409, -1224, 520, -167, 33, -2},
+    {45, -166, 391, -679, 857, -542, -1404, 28308, 8702, -4308, 2403, -1223, 521, -168, 33, -2},
+    {45, -166, 393, -684, 870, -566, -1355, 28338, 8622, -4287, 2397, -1223, 521, -169, 34, -2},
+    {45, -167, 396, -690, 882, -591, -1305, 28367, 8543, -4266, 2391, -1222, 522, -169, 34, -2},
+    {46, -168, 398, -696, 895, -616, -1255, 28397, 8463, -4245, 2385, -1221, 523, -170, 34, -2},
+    {46, -168, 400, -701, 907, -641, -1204, 28426, 8383, -4224, 2379, -1221, 524, -171, 35, -2},
+    {46, -169, 402, -707, 920, -666, -1154, 28456, 8304, -4203, 2373, -1220, 524, -171, 35, -2},
+    {46, -169, 404, -712, 932, -691, -1103, 28483, 8225, -4181, 2367, -1219, 525, -172, 35, -2},
+    {46, -170, 406, -718, 944, -716, -1052, 28514, 8145, -4160, 2360, -1218, 526, -173, 36, -2},
+    {46, -170, 408, -723, 957, -741, -1000, 28539, 8066, -4138, 2354, -1217, 526, -173, 36, -2},
+    {46, -171, 410, -729, 969, -766, -949, 28569, 7987, -4116, 2347, -1216, 527, -174, 36, -2},
+    {46, -171, 412, -734, 982, -792, -897, 28594, 7909, -4094, 2341, -1215, 527, -175, 37, -2},
+    {46, -172, 414, -740, 994, -817, -844, 28622, 7830, -4072, 2334, -1214, 528, -175, 37, -3},
+    {47, -173, 416, -745, 1006, -842, -792, 28650, 7751, -4050, 2327, -1213, 528, -176, 37, -3},
+    {47, -173, 418, -750, 1019, -868, -739, 28673, 7673, -4028, 2320, -1211, 529, -176, 37, -3},
+    {47, -174, 420, -756, 1031, -893, -686, 28701, 7594, -4006, 2313, -1210, 529, -177, 38, -3},
+    {47, -174, 421, -761, 1044, -918, -633, 28725, 7516, -3983, 2306, -1209, 530, -178, 38, -3},
+    {47, -175, 423, -767, 1056, -944, -579, 28751, 7438, -3961, 2299, -1207, 530, -178, 38, -3},
+    {47, -175, 425, -772, 1068, -969, -525, 28773, 7360, -3938, 2292, -1206, 531, -179, 39, -3},
+    {47, -176, 427, -777, 1081, -995, -471, 28797, 7282, -3916, 2285, -1204, 531, -179, 39, -3},
+    {47, -176, 429, -783, 1093, -1021, -416, 28823, 7204, -3893, 2277, -1203, 531, -180, 39, -3},
+    {47, -177, 431, -788, 1105, -1046, -362, 28845, 7126, -3870, 2270, -1201, 532, -180, 39, -3},
+    {47, -177, 433, -793, 1118, -1072, -307, 28866, 7049, -3847, 2263, -1200, 532, -181, 40, -3},
+    {47, -177, 435, -798, 1130, -1098, -252, 28889, 6971, -3824, 2255, -1198, 532, -181, 40, -3},
+    {47, -178, 436, -804, 1142, -1123, -196, 28913, 6894, -3801, 2247, -1196, 532, -182, 40, -3},
+    {48, -178, 438, -809, 1154, -1149, -140, 28933, 6817, -3778, 2240, -1195, 532, -182, 40, -3},
+    {48, -179, 440, -814, 1167, -1175, -84, 28953, 6740, -3755, 2232, -1193, 533, -183, 41, -3},
+    {48, -179, 442, -819, 1179, -1201, -28, 28973, 6663, -3731, 2224, -1191, 533, -183, 41, -3},
+    {48, -180, 444, -825, 1191, -1227, 28, 28996, 6586, -3708, 2216, -1189, 533, -183, 41, -3},
+    {48, -180, 445, -830, 1203, -1252, 85, 29015, 6510, -3684, 2208, -1187, 533, -184, 41, -3},
+    {48, -181, 447, -835, 1216, -1278, 142, 29035, 6433, -3661, 2200, -1185, 533, -184, 41, -3},
+    {48, -181, 449, -840, 1228, -1304, 199, 29053, 6357, -3637, 2192, -1183, 533, -185, 42, -3},
+    {48, -181, 451, -845, 1240, -1330, 257, 29070, 6281, -3613, 2184, -1181, 533, -185, 42, -3},
+    {48, -182, 452, -850, 1252, -1356, 315, 29091, 6205, -3589, 2175, -1179, 533, -185, 42, -4},
+    {48, -182, 454, -855, 1264, -1382, 373, 29109, 6129, -3565, 2167, -1177, 533, -186, 42, -4},
+    {48, -183, 456, -860, 1276, -1408, 431, 29127, 6053, -3541, 2158, -1175, 533, -186, 43, -4},
+    {48, -183, 457, -865, 1289, -1434, 490, 29141, 5978, -3517, 2150, -1172, 533, -186, 43, -4},
+    {48, -183, 459, -870, 1301, -1460, 548, 29160, 5902, -3493, 2141, -1170, 533, -187, 43, -4},
+    {48, -184, 461, -875, 1313, -1487, 608, 29176, 5827, -3469, 2133, -1168, 533, -187, 43, -4},
+    {48, -184, 462, -880, 1325, -1513, 667, 29192, 5752, -3445, 2124, -1165, 533, -187, 43, -4},
+    {48, -184, 464, -885, 1337, -1539, 726, 29209, 5677, -3420, 2115, -1163, 532, -188, 43, -4},
+    {48, -185, 465, -890, 1349, -1565, 786, 29224, 5602, -3396, 2106, -1160, 532, -188, 44, -4},
+    {48, -185, 467, -895, 1361, -1591, 846, 29237, 5528, -3372, 2098, -1158, 532, -188, 44, -4},
+    {49, -186, 469, -900, 1373, -1617, 907, 29250, 5453, -3347, 2089, -1155, 532, -189, 44, -4},
+    {49, -186, 470, -904, 1385, -1644, 967, 29264, 5379, -3322, 2080, -1153, 532, -189, 44, -4},
+    {49, -186, 472, -909, 1396, -1670, 1028, 29279, 5305, -3298, 2070, -1150, 531, -189, 44, -4},
+    {49, -186, 473, -914, 1408, -1696, 1089, 29290, 5231, -3273, 2061, -1147, 531, -189, 45, -4},
+    {49, -187, 475, -919, 1420, -1722, 1150, 29304, 5157, -3248, 2052, -1145, 531, -190, 45, -4},
+    {49, -187, 476, -923, 1432, -1748, 1212, 29314, 5084, -3223, 2043, -1142, 530, -190, 45, -4},
+    {49, -187, 478, -928, 1444, -1775, 1274, 29325, 5010, -3198, 2034, -1139, 530, -190, 45, -4},
+    {49, -188, 479, -933, 1456, -1801, 1336, 29337, 4937, -3173, 2024, -1136, 530, -190, 45, -4},
+    {49, -188, 481, -937, 1467, -1827, 1398, 29347, 4864, -3148, 2015, -1133, 529, -190, 45, -4},
+    {49, -188, 482, -942, 1479, -1853, 1460, 29359, 4791, -3123, 2005, -1130, 529, -191, 45, -4},
+    {49, -188, 483, -947, 1491, -1880, 1523, 29369, 4718, -3098, 1996, -1127, 528, -191, 46, -4},
+    {49, -189, 485, -951, 1502, -1906, 1586, 29378, 4646, -3073, 1986, -1124, 528, -191, 46, -4},
+    {49, -189, 486, -956, 1514, -1932, 1649, 29389, 4573, -3048, 1976, -1121, 527, -191, 46, -4},
+    {49, -189, 487, -960, 1525, -1959, 1713, 29397, 4501, -3023, 1967, -1118, 527, -191, 46, -4},
+    {49, -189, 489, -965, 1537, -1985, 1776, 29405, 4429, -2997, 1957, -1115, 526, -191, 46, -4},
+    {49, -190, 490, -969, 1549, -2011, 1840, 29414, 4357, -2972, 1947, -1112, 526, -192, 46, -4},
+    {49, -190, 491, -974, 1560, -2037, 1904, 29423, 4285, -2946, 1937, -1109, 525, -192, 46, -4},
+    {49, -190, 493, -978, 1572, -2064, 1969, 29427, 4214, -2921, 1927, -1105, 524, -192, 47, -4},
+    {49, -190, 494, -982, 1583, -2090, 2033, 29433, 4143, -2895, 1917, -1102, 524, -192, 47, -4},
+    {49, -190, 495, -987, 1594, -2116, 2098, 29441, 4072, -2870, 1907, -1099, 523, -192, 47, -4},
+    {49, -191, 496, -991, 1606, -2142, 2163, 29446, 4001, -2844, 1897, -1095, 522, -192, 47, -4},
+    {49, -191, 498, -995, 1617, -2169, 2229, 29451, 3930, -2819, 1887, -1092, 522, -192, 47, -4},
+    {49, -191, 499, -1000, 1628, -2195, 2294, 29458, 3859, -2793, 1876, -1088, 521, -192, 47, -4},
+    {48, -191, 500, -1004, 1640, -2221, 2360, 29462, 3789, -2767, 1866, -1085, 520, -192, 47, -4},
+    {48, -191, 501, -1008, 1651, -2247, 2426, 29466, 3719, -2742, 1856, -1081, 519, -192, 47, -4},
+    {48, -191, 502, -1012, 1662, -2273, 2492, 29470, 3649, -2716, 1845, -1078, 519, -192, 47, -4},
+    {48, -191, 503, -1016, 1673, -2300, 2558, 29474, 3579, -2690, 1835, -1074, 518, -192, 47, -4},
+    {48, -192, 505, -1020, 1684, -2326, 2625, 29476, 3510, -2664, 1824, -1071, 517, -192, 48, -4},
+    {48, -192, 506, -1025, 1695, -2352, 2692, 29478, 3441, -2638, 1814, -1067, 516, -192, 48, -4},
+    {48, -192, 507, -1029, 1706, -2378, 2759, 29481, 3371, -2612, 1803, -1063, 515, -192, 48, -4},
+    {48, -192, 508, -1033, 1717, -2404, 2826, 29483, 3302, -2586, 1793, -1060, 514, -192, 48, -4},
+    {48, -192, 509, -1037, 1728, -2430, 2893, 29484, 3234, -2560, 1782, -1056, 514, -192, 48, -5},
+    {48, -192, 510, -1040, 1739, -2456, 2961, 29485, 3165, -2535, 1771, -1052, 513, -192, 48, -5},
+    {48, -192, 511, -1044, 1750, -2482, 3029, 29484, 3097, -2509, 1761, -1048, 512, -192, 48, -5},
+};
+
+// 22050 Hz to 44100 Hz, 2 phases of 16 taps
+const int16_t polyphase_22050_44100[2][16] = {
+    {1, 15, -117, 435, -1150, 2483, -4903, 11502, 27006, -2934, 275, 413, -447, 279, -117, 27},
+    {27, -117, 279, -447, 413, 275, -2934, 27006, 11502, -4903, 2483, -1150, 435, -117, 15, 1},
+};
+
+// 24000 Hz to 44100 Hz, 147 phases of 16 taps
+const int16_t polyphase_24000_44100[147][16] = {
+    {-4, 48, -192, 512, -1051, 1771, -2534, 3165, 29485, 2961, -2456, 1738, -1040, 509, -192, 48},
+    {-4, 48, -192, 515, -1063, 1803, -2612, 3371, 29480, 2759, -2378, 1706, -1028, 506, -191, 48},
+    {-4, 47, -192, 517, -1074, 1834, -2690, 3579, 29475, 2558, -2299, 1673, -1016, 503, -191, 48},
+    {-4, 47, -192, 520, -1084, 1866, -2767, 3789, 29461, 2360, -2221, 1639, -1003, 500, -191, 48},
+    {-4, 47, -192, 522, -1095, 1896, -2844, 4001, 29448, 2163, -2142, 1605, -991, 496, -190, 48},
+    {-4, 46, -191, 524, -1105, 1926, -2921, 4214, 29429, 1969, -2063, 1571, -978, 492, -190, 49},
+    {-4, 46, -191, 526, -1114, 1956, -2997, 4429, 29405, 1776, -1985, 1537, -964, 488, -189, 49},
+    {-4, 46, -191, 527, -1124, 1985, -3073, 4645, 29381, 1586, -1906, 1502, -951, 484, -188, 49},
+    {-4, 45, -190, 529, -1133, 2014, -3148, 4864, 29349, 1398, -1827, 1467, -937, 480, -188, 49},
+    {-4, 45, -190, 530, -1141, 2042, -3223, 5083, 29316, 1212, -1748, 1432, -923, 476, -187, 48},
+    {-4, 44, -189, 531, -1149, 2070, -3297, 5305, 29279, 1028, -1670, 1396, -909, 471, -186, 48},
+    {-4, 44, -188, 532, -1157, 2097, -3371, 5528, 29236, 846, -1591, 1360, -894, 467, -185, 48},
+    {-4, 43, -187, 532, -1165, 2124, -3444, 5752, 29192, 667, -1512, 1324, -880, 462, -184, 48},
+    {-4, 43, -186, 533, -1172, 2149, -3517, 5978, 29143, 490, -1434, 1288, -865, 457, -183, 48},
+    {-4, 42, -185, 533, -1178, 2175, -3589, 6205, 29090, 315, -1356, 1252, -850, 452, -182, 48},
+    {-3, 41, -184, 533, -1185, 2199, -3660, 6433, 29034, 142, -1278, 1215, -834, 447, -180, 48},
+    {-3, 41, -183, 532, -1190, 2223, -3731, 6663, 28975, -28, -1201, 1179, -819, 441, -179, 48},
+    {-3, 40, -181, 532, -1196, 2247, -3801, 6894, 28911, -196, -1123, 1142, -803, 436, -178, 47},
+    {-3, 39, -180, 531, -1201, 2269, -3870, 7126, 28845, -362, -1046, 1105, -787, 431, -176, 47},
+    {-3, 38, -178, 530, -1205, 2291, -3938, 7360, 28774, -525, -969, 1068, -772, 425, -175, 47},
+    {-3, 38, -177, 529, -1209, 2313, -4005, 7594, 28698, -686, -893, 1031, -755, 419, -173, 47},
+    {-2, 37, -175, 527, -1213, 2333, -4072, 7830, 28622, -844, -817, 994, -739, 413, -172, 46},
+    {-2, 36, -173, 526, -1216, 2353, -4138, 8066, 28540, -1000, -741, 957, -723, 407, -170, 46},
+    {-2, 35, -171, 524, -1219, 2372, -4202, 8304, 28455, -1154, -666, 919, -706, 401, -168, 46},
+    {-2, 34, -169, 522, -1221, 2391, -4266, 8542, 28368, -1305, -591, 882, -690, 395, -167, 45},
+    {-2, 33, -167, 519, -1223, 2408, -4329, 8782, 28276, -1453, -517, 845, -673, 389, -165, 45},
+    {-2, 32, -165, 517, -1225, 2425, -4390, 9022, 28179, -1599, -443, 808, -656, 383, -163, 45},
+    {-1, 31, -162, 514, -1226, 2441, -4451, 9263, 28082, -1743, -370, 770, -639, 376, -161, 44},
+    {-1, 30, -160, 511, -1226, 2456, -4510, 9505, 27978, -1884, -297, 733, -622, 370, -159, 44},
+    {-1, 29, -157, 508, -1226, 2471, -4568, 9747, 27872, -2022, -225, 696, -605, 363, -157, 43},
+    {-1, 28, -155, 504, -1225, 2484, -4625, 9991, 27762, -2158, -153, 659, -588, 357, -155, 43},
+    {0, 26, -152, 500, -1224, 2497, -4681, 10234, 27650, -2291, -82, 622, -571, 350, -153, 43},
+    {0, 25, -149, 496, -1223, 2509, -4736, 10479, 27535, -2422, -12, 585, -553, 343, -151, 42},
+    {0, 24, -146, 492, -1221, 2520, -4789, 10724, 27415, -2550, 58, 548, -536, 336, -149, 42},
+    {1, 23, -143, 487, -1218, 2530, -4841, 10969, 27294, -2676, 127, 511, -519, 329, -147, 41},
+    {1, 21, -140, 482, -1215, 2539, -4892, 11215, 27168, -2799, 196, 475, -501, 322, -145, 41},
+    {1, 20, -137, 477, -1212, 2547, -4941, 11461, 27042, -2919, 263, 438, -484, 315, -143, 40},
+    {1, 19, -133, 472, -1208, 2555, -4989, 11707, 26907, -3036, 330, 402, -466, 308, -141, 40},
+    {2, 17, -130, 467, -1203, 2561, -5036, 11954, 26772, -3151, 396, 366, -449, 301, -138, 39},
+    {2, 16, -126, 461, -1198, 2567, -5081, 12201, 26632, -3264, 462, 330, -431, 294, -136, 39},
+    {2, 14, -122, 455, -1192, 2571, -5124, 12448, 26492, -3374, 527, 294, -414, 287, -134, 38},
+    {3, 13, -119, 448, -1186, 2575, -5166, 12695, 26348, -3481, 590, 259, -397, 280, -131, 37},
+    {3, 11, -115, 442, -1179, 2577, -5206, 12942, 26200, -3585, 653, 223, -379, 273, -129, 37},
+    {3, 9, -111, 435, -1172, 2579, -5245, 13189, 26052, -3687, 716, 188, -362, 265, -127, 36},
+    {4, 8, -107, 428, -1164, 2579, -5282, 13436, 25896, -3786, 777, 153, -344, 258, -124, 36},
+    {4, 6, -102, 421, -1156, 2579, -5318, 13683, 25739, -3882, 838, 119, -327, 251, -122, 35},
+    {5, 4, -98, 413, -1147, 2577, -5351, 13930, 25579, -3976, 897, 85, -310, 244, -119, 35},
+    {5, 3, -94, 405, -1138, 2575, -5384, 14177, 25418, -4067, 956, 51, -292, 236, -117, 34},
+    {5, 1, -89, 397, -1128, 2572, -5414, 14423, 25253, -4156, 1014, 17, -275, 229, -114, 33},
+    {6, -1, -85, 389, -1118, 2567, -5442, 14669, 25086, -4242, 1071, -17, -258, 222, -112, 33},
+    {6, -3, -80, 380, -1107, 2561, -5469, 14915, 24918, -4325, 1127, -50, -241, 214, -110, 32},
+    {7, -5, -75, 372, -1095, 2555, -5494, 15160, 24742, -4406, 1182, -83, -224, 207, -107, 32},
+    {7, -6, -70, 363, -1083, 2547, -5517, 15405, 24565, -4483, 1236, -115, -207, 200, -105, 31},
+    {8, -8, -65, 353, -1070, 2538, -5538, 15649, 24388, -4559, 1289, -147, -190, 192, -102, 30},
+    {8, -10, -60, 344, -1057, 2529, -5557, 15893, 24206, -4631, 1341, -179, -174, 185, -100, 30},
+    {9, -12, -55, 334, -1043, 2518, -5575, 16136, 24023, -4701, 1392, -211, -157, 178, -97, 29},
+    {9, -14, -50, 324, -1029, 2506, -5590, 16379, 23838, -4769, 1442, -242, -140, 170, -95, 29},
+    {9, -16, -45, 314, -1014, 2493, -5603, 16620, 23648, -4833, 1492, -272, -124, 163, -92, 28},
+    {10, -18, -39, 303, -999, 2479, -5614, 16861, 23458, -4896, 1540, -303, -108, 156, -89, 27},
+    {10, -21, -34, 292, -983, 2463, -5623, 17101, 23267, -4955, 1587, -333, -92, 149, -87, 27},
+    {11, -23, -28, 281, -967, 2447, -5631, 17340, 23072, -5012, 1633, -362, -76, 141, -84, 26},
+    {12, -25, -22, 270, -950, 2430, -5636, 17578, 22873, -5066, 1678, -391, -60, 134, -82, 25},
+    {12, -27, -17, 259, -932, 2411, -5638, 17815, 22672, -5118, 1722, -420, -44, 127, -79, 25},
+    {13, -29, -11, 247, -914, 2391, -5639, 18051, 22471, -5168, 1765, -448, -28, 120, -77, 24},
+    {13, -31, -5, 235, -896, 2371, -5638, 18286, 22267, -5214, 1806, -476, -13, 113, -74, 24},
+    {14, -34, 1, 223, -877, 2349, -5634, 18520, 22060, -5258, 1847, -503, 3, 106, -72, 23},
+    {14, -36, 7, 211, -857, 2326, -5628, 18753, 21851, -5300, 1887, -530, 18, 99, -69, 22},
+    {15, -38, 13, 198, -837, 2302, -5620, 18984, 21642, -5339, 1925, -557, 33, 92, -67, 22},
+    {15, -40, 19, 186, -817, 2276, -5609, 19214, 21430, -5376, 1963, -583, 48, 85, -64, 21},
+    {16, -43, 26, 173, -795, 2250, -5597, 19443, 21215, -5410, 1999, -608, 62, 78, -62, 21},
+    {16, -45, 32, 160, -774, 2223, -5582, 19670, 20999, -5442, 2034, -633, 77, 72, -59, 20},
+    {17, -47, 39, 146, -752, 2194, -5564, 19896, 20782, -5471, 2068, -658, 91, 65, -57, 19},
+    {18, -50, 45, 133, -729, 2164, -5545, 20120, 20564, -5498, 2101, -682, 105, 58, -55, 19},
+    {18, -52, 52, 119, -706, 2133, -5523, 20344, 20342, -5523, 2133, -706, 119, 52, -52, 18},
+    {19, -55, 58, 105, -682, 2101, -5498, 20564, 20120, -5545, 2164, -729, 133, 45, -50, 18},
+    {19, -57, 65, 91, -658, 2068, -5471, 20782, 19896, -5564, 2194, -752, 146, 39, -47, 17},
+    {20, -59, 72, 77, -633, 2034, -5442, 20999, 19670, -5582, 2223, -774, 160, 32, -45, 16},
+    {21, -62, 78, 62, -608, 1999, -5410, 21215, 19443, -5597, 2250, -795, 173, 26, -43, 16},
+    {21, -64, 85, 48, -583, 1963, -5376, 21430, 19214, -5609, 2276, -817, 186, 19, -40, 15},
+    {22, -67, 92, 33, -557, 1925, -5339, 21642, 18984, -5620, 2302, -837, 198, 13, -38, 15},
+    {22, -69, 99, 18, -530, 1887, -5300, 21851, 18753, -5628, 2326, -857, 211, 7, -36, 14},
+    {23, -72, 106, 3, -503, 1847, -5258, 22060, 18520, -5634, 2349, -877, 223, 1, -34, 14},
+    {24, -74, 113, -13, -476, 1806, -5214, 22267, 18286, -5638, 2371, -896, 235, -5, -31, 13},
+    {24, -77, 120, -28, -448, 1765, -5168, 22471, 18051, -5639, 2391, -914, 247, -11, -29, 13},
+    {25, -79, 127, -44, -420, 1722, -5118, 22672, 17815, -5638, 2411, -932, 259, -17, -27, 12},
+    {25, -82, 134, -60, -391, 1678, -5066, 22873, 17578, -5636, 2430, -950, 270, -22, -25, 12},
+    {26, -84, 141, -76, -362, 1633, -5012, 23072, 17340, -5631, 2447, -967, 281, -28, -23, 11},
+    {27, -87, 149, -92, -333, 1587, -4955, 23267, 17101, -5623, 2463, -983, 292, -34, -21, 10},
+    {27, -89, 156, -108, -303, 1540, -4896, 23458, 16861, -5614, 2479, -999, 303, -39, -18, 10},
+    {28, -92, 163, -124, -272, 1492, -4833, 23648, 16620, -5603, 2493, -1014, 314, -45, -16, 9},
+    {29, -95, 170, -140, -242, 1442, -4769, 23838, 16379, -5590, 2506, -1029, 324, -50, -14, 9},
+    {29, -97, 178, -157, -211, 1392, -4701, 24023, 16136, -5575, 2518, -1043, 334, -55, -12, 9},
+    {30, -100, 185, -174, -179, 1341, -4631, 24206, 15893, -5557, 2529, -1057, 344, -60, -10, 8},
+    {30, -102, 192, -190, -147, 1289, -4559, 24388, 15649, -5538, 2538, -1070, 353, -65, -8, 8},
+    {31, -105, 200, -207, -115, 1236, -4483, 24565, 15405, -5517, 2547, -1083, 363, -70, -6, 7},
+    {32, -107, 207, -224, -83, 1182, -4406, 24742, 15160, -5494, 2555, -1095, 372, -75, -5, 7},
+    {32, -110, 214, -241, -50, 1127, -4325, 24918, 14915, -5469, 2561, -1107, 380, -80, -3, 6},
+    {33, -112, 222, -258, -17, 1071, -4242, 25086, 14669, -5442, 2567, -1118, 389, -85, -1, 6},
+    {33, -114, 229, -275, 17, 1014, -4156, 25253, 14423, -5414, 2572, -1128, 397, -89, 1, 5},
+    {34, -117, 236, -292, 51, 956, -4067, 25418, 14177, -5384, 2575, -1138, 405, -94, 3, 5},
+    {35, -119, 244, -310, 85, 897, -3976, 25579, 13930, -5351, 2577, -1147, 413, -98, 4, 5},
+    {35, -122, 251, -327, 119, 838, -3882, 25739, 13683, -5318, 2579, -1156, 421, -102, 6, 4},
+    {36, -124, 258, -344, 153, 777, -3786, 25896, 13436, -5282, 2579, -1164, 428, -107, 8, 4},
+    {36, -127, 265, -362, 188, 716, -3687, 26052, 13189, -5245, 2579, -1172, 435, -111, 9, 3},
+    {37, -129, 273, -379, 223, 653, -3585, 26200, 12942, -5206, 2577, -1179, 442, -115, 11, 3},
+    {37, -131, 280, -397, 259, 590, -3481, 26348, 12695, -5166, 2575, -1186, 448, -119, 13, 3},
+    {38, -134, 287, -414, 294, 527, -3374, 26492, 12448, -5124, 2571, -1192, 455, -122, 14, 2},
+    {39, -136, 294, -431, 330, 462, -3264, 26632, 12201, -5081, 2567, -1198, 461, -126, 16, 2},
+    {39, -138, 301, -449, 366, 396, -3151, 26772, 11954, -5036, 2561, -1203, 467, -130, 17, 2},
+    {40, -141, 308, -466, 402, 330, -3036, 26907, 11707, -4989, 2555, -1208, 472, -133, 19, 1},
+    {40, -143, 315, -484, 438, 263, -2919, 27042, 11461, -4941, 2547, -1212, 477, -137, 20, 1},
+    {41, -145, 322, -501, 475, 196, -2799, 27168, 11215, -4892, 2539, -1215, 482, -140, 21, 1},
+    {41, -147, 329, -519, 511, 127, -2676, 27294, 10969, -4841, 2530, -1218, 487, -143, 23, 1},
+    {42, -149, 336, -536, 548, 58, -2550, 27415, 10724, -4789, 2520, -1221, 492, -146, 24, 0},
+    {42, -151, 343, -553, 585, -12, -2422, 27535, 10479, -4736, 2509, -1223, 496, -149, 25, 0},
+    {43, -153, 350, -571, 622, -82, -2291, 27650, 10234, -4681, 2497, -1224, 500, -152, 26, 0},
+    {43, -155, 357, -588, 659, -153, -2158, 27762, 9991, -4625, 2484, -1225, 504, -155, 28, -1},
+    {43, -157, 363, -605, 696, -225, -2022, 27872, 9747, -4568, 2471, -1226, 508, -157, 29, -1},
+    {44, -159, 370, -622, 733, -297, -1884, 27978, 9505, -4510, 2456, -1226, 511, -160, 30, -1},
+    {44, -161, 376, -639, 770, -370, -1743, 28082, 9263, -4451, 2441, -1226, 514, -162, 31, -1},
+    {45, -163, 383, -656, 808, -443, -1599, 28179, 9022, -4390, 2425, -1225, 517, -165, 32, -2},
+    {45, -165, 389, -673, 845, -517, -1453, 28276, 8782, -4329, 2408, -1223, 519, -167, 33, -2},
+    {45, -167, 395, -690, 882, -591, -1305, 28368, 8542, -4266, 2391, -1221, 522, -169, 34, -2},
+    {46, -168, 401, -706, 919, -666, -1154, 28455, 8304, -4202, 2372, -1219, 524, -171, 35, -2},
+    {46, -170, 407, -723, 957, -741, -1000, 28540, 8066, -4138, 2353, -1216, 526, -173, 36, -2},
+    {46, -172, 413, -739, 994, -817, -844, 28622, 7830, -4072, 2333, -1213, 527, -175, 37, -2},
+    {47, -173, 419, -755, 1031, -893, -686, 28698, 7594, -4005, 2313, -1209, 529, -177, 38, -3},
+    {47, -175, 425, -772, 1068, -969, -525, 28774, 7360, -3938, 2291, -1205, 530, -178, 38, -3},
+    {47, -176, 431, -787, 1105, -1046, -362, 28845, 7126, -3870, 2269, -1201, 531, -180, 39, -3},
+    {47, -178, 436, -803, 1142, -1123, -196, 28911, 6894, -3801, 2247, -1196, 532, -181, 40, -3},
+    {48, -179, 441, -819, 1179, -1201, -28, 28975, 6663, -3731, 2223, -1190, 532, -183, 41, -3},
+    {48, -180, 447, -834, 1215, -1278, 142, 29034, 6433, -3660, 2199, -1185, 533, -184, 41, -3},
+    {48, -182, 452, -850, 1252, -1356, 315, 29090, 6205, -3589, 2175, -1178, 533, -185, 42, -4},
+    {48, -183, 457, -865, 1288, -1434, 490, 29143, 5978, -3517, 2149, -1172, 533, -186, 43, -4},
+    {48, -184, 462, -880, 1324, -1512, 667, 29192, 5752, -3444, 2124, -1165, 532, -187, 43, -4},
+    {48, -185, 467, -894, 1360, -1591, 846, 29236, 5528, -3371, 2097, -1157, 532, -188, 44, -4},
+    {48, -186, 471, -909, 1396, -1670, 1028, 29279, 5305, -3297, 2070, -1149, 531, -189, 44, -4},
+    {48, -187, 476, -923, 1432, -1748, 1212, 29316, 5083, -3223, 2042, -1141, 530, -190, 45, -4},
+    {49, -188, 480, -937, 1467, -1827, 1398, 29349, 4864, -3148, 2014, -1133, 529, -190, 45, -4},
+    {49, -188, 484, -951, 1502, -1906, 1586, 29381, 4645, -3073, 1985, -1124, 527, -191, 46, -4},
+    {49, -189, 488, -964, 1537, -1985, 1776, 29405, 4429, -2997, 1956, -1114, 526, -191, 46, -4},
+    {49, -190, 492, -978, 1571, -2063, 1969, 29429, 4214, -2921, 1926, -1105, 524, -191, 46, -4},
+    {48, -190, 496, -991, 1605, -2142, 2163, 29448, 4001, -2844, 1896, -1095, 522, -192, 47, -4},
+    {48, -191, 500, -1003, 1639, -2221, 2360, 29461, 3789, -2767, 1866, -1084, 520, -192, 47, -4},
+    {48, -191, 503, -1016, 1673, -2299, 2558, 29475, 3579, -2690, 1834, -1074, 517, -192, 47, -4},
+    {48, -191, 506, -1028, 1706, -2378, 2759, 29480, 3371, -2612, 1803, -1063, 515, -192, 48, -4},
+    {48, -192, 509, -1040, 1738, -2456, 2961, 29485, 3165, -2534, 1771, -1051, 512, -192, 48, -4},
+};
+
+// 22050 Hz to 16000 Hz, 320 phases of 40 taps
+const int16_t polyphase_22050_16000[320][40] = {
+    {-3, 6, 4, -30, 38, 17, -114, 131, 40, -306, 347, 72, -697, 806, 106, -1526, 1918, 127, -4438, 8916, 21993, 8853, -4446, 149, 1908, -1529, 114, 802, -698, 76, 345, -307, 42, 131, -114, 17, 38, -30, 4, 6},
+    {-3, 6, 4, -30, 38, 16, -114, 132, 39, -306, 349, 69, -695, 811, 98, -1522, 1928, 106, -4429, 8979, 21989, 8790, -4454, 170, 1898, -1533, 123, 797, -700, 80, 343, -307, 43, 130, -114, 18, 38, -30, 5, 6},
+    {-3, 6, 4, -30, 39, 16, -114, 133, 37, -305, 351, 65, -694, 815, 89, -1519, 1938, 85, -4420, 9043, 21989, 8727, -4462, 191, 1887, -1536, 131, 793, -701, 84, 341, -308, 45, 129, -114, 18, 37, -30, 5, 6},
+    {-3, 6, 4, -30, 39, 15, -114, 134, 36, -305, 353, 61, -692, 819, 81, -1515, 1948, 64, -4411, 9106, 21989, 8664, -4470, 212, 1877, -1540, 139, 788, -702, 87, 339, -308, 46, 128, -114, 19, 37, -30, 5, 6},
+    {-3, 6, 4, -30, 39, 15, -113, 135, 34, -304, 355, 57, -691, 824, 72, -1511, 1958, 43, -4402, 9169, 21989, 8601, -4478, 232, 1866, -1543, 148, 783, -704, 91, 337, -309, 48, 127, -114, 19, 37, -30, 5, 6},
+    {-3, 6, 4, -30, 40, 14, -113, 136, 33, -304, 357, 54, -689, 828, 64, -1507, 1968, 21, -4392, 9232, 21986, 8538, -4485, 253, 1856, -1546, 156, 779, -705, 95, 334, -309, 49, 126, -115, 20, 36, -30, 5, 6},
+    {-3, 6, 4, -30, 40, 14, -113, 137, 31, -303, 359, 50, -688, 832, 55, -1503, 1977, 0, -4383, 9295, 21988, 8475, -4492, 274, 1845, -1549, 164, 774, -706, 98, 332, -310, 51, 125, -115, 20, 36, -30, 5, 6},
+    {-3, 6, 4, -30, 40, 13, -113, 138, 29, -303, 361, 46, -686, 837, 47, -1499, 1987, -22, -4373, 9358, 21984, 8412, -4499, 295, 1835, -1552, 172, 770, -707, 102, 330, -310, 52, 124, -115, 21, 36, -30, 5, 6},
+    {-3, 6, 4, -30, 40, 13, -113, 138, 28, -302, 363, 42, -684, 841, 38, -1495, 1997, -43, -4362, 9422, 21980, 8349, -4505, 315, 1824, -1555, 181, 765, -708, 106, 328, -310, 54, 123, -115, 21, 35, -30, 5, 5},
+    {-3, 6, 3, -30, 41, 12, -113, 139, 26, -301, 365, 38, -683, 845, 30, -1491, 2006, -65, -4352, 9485, 21982, 8286, -4512, 336, 1814, -1558, 189, 760, -710, 109, 326, -311, 55, 122, -115, 22, 35, -30, 5, 5},
+    {-3, 7, 3, -30, 41, 12, -112, 140, 25, -301, 367, 35, -681, 849, 21, -1486, 2016, -87, -4341, 9548, 21975, 8223, -4518, 356, 1803, -1561, 197, 755, -711, 113, 323, -311, 57, 122, -115, 22, 35, -30, 5, 5},
+    {-3, 7, 3, -30, 41, 11, -112, 141, 23, -300, 369, 31, -679, 853, 13, -1482, 2025, -108, -4330, 9611, 21968, 8160, -4524, 377, 1792, -1563, 205, 751, -712, 117, 321, -311, 58, 121, -115, 23, 35, -30, 6, 5},
+    {-3, 7, 3, -30, 41, 11, -112, 142, 22, -299, 371, 27, -677, 857, 4, -1478, 2035, -130, -4319, 9674, 21967, 8097, -4530, 397, 1781, -1566, 213, 746, -713, 120, 319, -312, 60, 120, -115, 23, 34, -30, 6, 5},
+    {-3, 7, 3, -30, 42, 10, -112, 143, 20, -299, 373, 23, -675, 862, -5, -1473, 2044, -152, -4308, 9737, 21962, 8034, -4535, 418, 1770, -1569, 221, 741, -714, 124, 317, -312, 61, 119, -115, 24, 34, -30, 6, 5},
+    {-3, 7, 3, -30, 42, 10, -112, 143, 18, -298, 375, 19, -674, 866, -13, -1469, 2053, -174, -4296, 9801, 21959, 7971, -4541, 438, 1759, -1571, 230, 736, -715, 127, 314, -312, 63, 118, -115, 24, 34, -30, 6, 5},
+    {-3, 7, 3, -30, 42, 9, -111, 144, 17, -297, 377, 15, -672, 870, -22, -1464, 2062, -195, -4285, 9864, 21955, 7908, -4546, 458, 1748, -1574, 238, 731, -716, 131, 312, -313, 64, 117, -115, 25, 33, -30, 6, 5},
+    {-3, 7, 3, -30, 43, 9, -111, 145, 15, -297, 379, 11, -670, 874, -30, -1459, 2071, -217, -4273, 9927, 21947, 7846, -4551, 478, 1737, -1576, 246, 726, -716, 135, 310, -313, 65, 116, -115, 25, 33, -30, 6, 5},
+    {-3, 7, 3, -30, 43, 8, -111, 146, 14, -296, 381, 8, -668, 878, -39, -1454, 2080, -239, -4260, 9990, 21937, 7783, -4555, 498, 1726, -1578, 254, 722, -717, 138, 308, -313, 67, 115, -115, 26, 33, -30, 6, 5},
+    {-3, 7, 2, -30, 43, 8, -111, 147, 12, -295, 383, 4, -666, 882, -48, -1450, 2089, -261, -4248, 10053, 21937, 7720, -4560, 518, 1715, -1581, 262, 717, -718, 142, 305, -313, 68, 114, -115, 26, 32, -30, 6, 5},
+    {-3, 7, 2, -30, 43, 7, -111, 147, 10, -294, 385, 0, -664, 885, -56, -1445, 2098, -283, -4235, 10116, 21933, 7657, -4564, 538, 1703, -1583, 270, 712, -719, 145, 303, -313, 70, 113, -115, 26, 32, -30, 6, 5},
+    {-3, 7, 2, -30, 44, 7, -110, 148, 9, -294, 387, -4, -662, 889, -65, -1440, 2107, -305, -4222, 10179, 21923, 7595, -4568, 558, 1692, -1585, 278, 707, -720, 149, 301, -314, 71, 112, -115, 27, 32, -30, 6, 5},
+    {-3, 7, 2, -30, 44, 6, -110, 149, 7, -293, 388, -8, -660, 893, -74, -1435, 2116, -327, -4209, 10242, 21919, 7532, -4572, 578, 1681, -1587, 285, 702, -720, 152, 298, -314, 73, 111, -115, 27, 32, -30, 6, 5},
+    {-3, 7, 2, -30, 44, 5, -110, 150, 6, -292, 390, -12, -657, 897, -83, -1429, 2124, -350, -4196, 10305, 21912, 7470, -4576, 597, 1669, -1589, 293, 697, -721, 156, 296, -314, 74, 110, -115, 28, 31, -30, 7, 5},
+    {-3, 7, 2, -30, 44, 5, -110, 151, 4, -291, 392, -16, -655, 901, -91, -1424, 2133, -372, -4182, 10368, 21903, 7407, -4579, 617, 1658, -1591, 301, 692, -722, 159, 294, -314, 75, 109, -115, 28, 31, -30, 7, 5},
+    {-3, 7, 2, -30, 45, 4, -109, 151, 2, -290, 394, -20, -653, 904, -100, -1419, 2141, -394, -4168, 10431, 21894, 7345, -4582, 636, 1646, -1592, 309, 687, -722, 163, 291, -314, 77, 108, -115, 29, 31, -30, 7, 5},
+    {-3, 7, 2, -30, 45, 4, -109, 152, 1, -290, 396, -24, -651, 908, -109, -1414, 2150, -416, -4154, 10494, 21888, 7282, -4585, 656, 1635, -1594, 317, 681, -723, 166, 289, -314, 78, 107, -115, 29, 30, -30, 7, 5},
+    {-3, 7, 2, -30, 45, 3, -109, 153, -1, -289, 397, -28, -648, 912, -117, -1408, 2158, -439, -4140, 10557, 21882, 7220, -4588, 675, 1623, -1596, 325, 676, -724, 170, 287, -315, 79, 106, -115, 30, 30, -30, 7, 4},
+    {-3, 7, 1, -29, 46, 3, -109, 154, -3, -288, 399, -32, -646, 915, -126, -1403, 2166, -461, -4125, 10620, 21873, 7158, -4591, 695, 1611, -1597, 332, 671, -724, 173, 284, -315, 81, 105, -115, 30, 30, -30, 7, 4},
+    {-3, 7, 1, -29, 46, 2, -108, 154, -4, -287, 401, -35, -644, 919, -135, -1397, 2174, -483, -4110, 10683, 21864, 7095, -4593, 714, 1600, -1599, 340, 666, -725, 176, 282, -315, 82, 104, -115, 30, 29, -30, 7, 4},
+    {-3, 8, 1, -29, 46, 2, -108, 155, -6, -286, 402, -39, -641, 923, -144, -1391, 2182, -506, -4095, 10746, 21850, 7033, -4595, 733, 1588, -1600, 348, 661, -725, 180, 280, -315, 84, 103, -115, 31, 29, -30, 7, 4},
+    {-3, 8, 1, -29, 46, 1, -108, 156, -7, -285, 404, -43, -639, 926, -153, -1386, 2190, -528, -4080, 10809, 21842, 6971, -4597, 752, 1576, -1601, 355, 656, -725, 183, 277, -315, 85, 103, -115, 31, 29, -30, 7, 4},
+    {-3, 8, 1, -29, 47, 1, -108, 157, -9, -284, 406, -47, -637, 930, -161, -1380, 2198, -551, -4064, 10871, 21833, 6909, -4599, 771, 1564, -1603, 363, 650, -726, 186, 275, -315, 86, 102, -115, 32, 28, -30, 7, 4},
+    {-3, 8, 1, -29, 47, 0, -107, 157, -11, -283, 408, -51, -634, 933, -170, -1374, 2206, -573, -4049, 10934, 21821, 6847, -4600, 790, 1552, -1604, 371, 645, -726, 190, 272, -315, 88, 101, -115, 32, 28, -30, 7, 4},
+    {-3, 8, 1, -29, 47, -1, -107, 158, -12, -282, 409, -55, -632, 936, -179, -1368, 2214, -596, -4033, 10997, 21813, 6785, -4602, 809, 1540, -1605, 378, 640, -727, 193, 270, -315, 89, 100, -115, 33, 28, -30, 7, 4},
+    {-3, 8, 1, -29, 47, -1, -107, 159, -14, -281, 411, -59, -629, 940, -188, -1362, 2221, -618, -4017, 11059, 21799, 6723, -4603, 828, 1528, -1606, 386, 635, -727, 197, 268, -315, 90, 99, -115, 33, 28, -30, 8, 4},
+    {-3, 8, 0, -29, 48, -2, -106, 159, -16, -280, 412, -63, -627, 943, -197, -1356, 2229, -641, -4000, 11122, 21793, 6661, -4604, 846, 1516, -1607, 393, 629, -727, 200, 265, -315, 92, 98, -115, 33, 27, -30, 8, 4},
+    {-3, 8, 0, -29, 48, -2, -106, 160, -17, -279, 414, -67, -624, 946, -205, -1350, 2237, -664, -3983, 11184, 21777, 6599, -4604, 865, 1504, -1608, 401, 624, -727, 203, 263, -315, 93, 97, -115, 34, 27, -30, 8, 4},
+    {-3, 8, 0, -29, 48, -3, -106, 161, -19, -278, 416, -71, -621, 950, -214, -1344, 2244, -686, -3967, 11247, 21767, 6538, -4605, 883, 1492, -1609, 408, 619, -728, 206, 260, -315, 94, 96, -115, 34, 27, -29, 8, 4},
+    {-3, 8, 0, -29, 48, -3, -105, 162, -21, -277, 417, -75, -619, 953, -223, -1337, 2251, -709, -3949, 11309, 21754, 6476, -4605, 902, 1480, -1610, 416, 613, -728, 210, 258, -315, 95, 95, -115, 35, 26, -29, 8, 4},
+    {-3, 8, 0, -29, 49, -4, -105, 162, -22, -276, 419, -79, -616, 956, -232, -1331, 2259, -732, -3932, 11372, 21740, 6414, -4605, 920, 1468, -1610, 423, 608, -728, 213, 255, -315, 97, 94, -114, 35, 26, -29, 8, 4},
+    {-3, 8, 0, -29, 49, -5, -105, 163, -24, -275, 420, -83, -613, 959, -241, -1325, 2266, -754, -3915, 11434, 21729, 6353, -4605, 939, 1455, -1611, 431, 603, -728, 216, 253, -315, 98, 93, -114, 35, 26, -29, 8, 4},
+    {-3, 8, 0, -29, 49, -5, -104, 164, -26, -274, 422, -87, -611, 962, -250, -1318, 2273, -777, -3897, 11497, 21717, 6291, -4605, 957, 1443, -1611, 438, 597, -728, 219, 250, -315, 99, 92, -114, 36, 25, -29, 8, 4},
+    {-3, 8, 0, -29, 49, -6, -104, 164, -27, -273, 423, -91, -608, 966, -259, -1312, 2280, -800, -3879, 11559, 21702, 6230, -4604, 975, 1431, -1612, 445, 592, -728, 223, 248, -314, 101, 91, -114, 36, 25, -29, 8, 4},
+    {-3, 8, -1, -28, 49, -6, -104, 165, -29, -272, 425, -95, -605, 969, -267, -1305, 2287, -823, -3860, 11621, 21687, 6169, -4603, 993, 1418, -1612, 452, 586, -728, 226, 245, -314, 102, 90, -114, 37, 25, -29, 8, 4},
+    {-3, 8, -1, -28, 50, -7, -103, 166, -31, -271, 426, -99, -602, 972, -276, -1298, 2294, -845, -3842, 11683, 21674, 6108, -4603, 1011, 1406, -1613, 460, 581, -728, 229, 243, -314, 103, 89, -114, 37, 24, -29, 8, 3},
+    {-3, 8, -1, -28, 50, -7, -103, 166, -32, -269, 428, -103, -599, 975, -285, -1292, 2300, -868, -3823, 11745, 21662, 6046, -4601, 1029, 1393, -1613, 467, 575, -728, 232, 240, -314, 104, 88, -114, 37, 24, -29, 8, 3},
+    {-3, 8, -1, -28, 50, -8, -103, 167, -34, -268, 429, -107, -596, 977, -294, -1285, 2307, -891, -3804, 11807, 21647, 5985, -4600, 1047, 1381, -1613, 474, 570, -728, 235, 238, -314, 106, 87, -114, 38, 24, -29, 8, 3},
+    {-3, 8, -1, -28, 50, -9, -102, 168, -36, -267, 431, -111, -593, 980, -303, -1278, 2313, -914, -3785, 11869, 21636, 5924, -4599, 1064, 1368, -1613, 481, 564, -728, 238, 235, -314, 107, 86, -114, 38, 23, -29, 9, 3},
+    {-3, 9, -1, -28, 51, -9, -102, 168, -37, -266, 432, -115, -590, 983, -312, -1271, 2320, -937, -3765, 11931, 21614, 5863, -4597, 1082, 1356, -1613, 488, 559, -728, 242, 233, -314, 108, 85, -113, 39, 23, -29, 9, 3},
+    {-3, 9, -1, -28, 51, -10, -101, 169, -39, -265, 434, -119, -587, 986, -321, -1264, 2326, -960, -3746, 11993, 21601, 5802, -4595, 1099, 1343, -1613, 495, 553, -727, 245, 230, -313, 109, 83, -113, 39, 23, -29, 9, 3},
+    {-3, 9, -1, -28, 51, -10, -101, 170, -41, -264, 435, -123, -584, 989, -330, -1257, 2333, -983, -3726, 12055, 21582, 5742, -4593, 1117, 1331, -1613, 502, 548, -727, 248, 228, -313, 111, 82, -113, 39, 23, -29, 9, 3},
+    {-3, 9, -2, -28, 51, -11, -101, 170, -43, -262, 436, -127, -581, 992, -338, -1249, 2339, -1006, -3706, 12117, 21569, 5681, -4591, 1134, 1318, -1613, 510, 542, -727, 251, 225, -313, 112, 81, -113, 40, 22, -29, 9, 3},
+    {-3, 9, -2, -28, 52, -11, -100, 171, -44, -261, 438, -131, -578, 994, -347, -1242, 2345, -1029, -3685, 12178, 21552, 5620, -4588, 1151, 1305, -1613, 516, 537, -727, 254, 223, -313, 113, 80, -113, 40, 22, -29, 9, 3},
+    {-3, 9, -2, -28, 52, -12, -100, 171, -46, -260, 439, -135, -575, 997, -356, -1235, 2351, -1051, -3664, 12240, 21533, 5560, -4585, 1169, 1293, -1612, 523, 531, -726, 257, 220, -312, 114, 79, -113, 40, 22, -29, 9, 3},
+    {-3, 9, -2, -28, 52, -13, -99, 172, -48, -259, 440, -139, -572, 1000, -365, -1228, 2357, -1074, -3644, 12302, 21520, 5499, -4583, 1186, 1280, -1612, 530, 525, -726, 260, 218, -312, 115, 78, -113, 41, 21, -29, 9, 3},
+    {-3, 9, -2, -28, 52, -13, -99, 173, -49, -257, 442, -143, -569, 1002, -374, -1220, 2363, -1097, -3622, 12363, 21497, 5439, -4579, 1203, 1267, -1611, 537, 520, -726, 263, 215, -312, 116, 77, -112, 41, 21, -28, 9, 3},
+    {-3, 9, -2, -27, 52, -14, -99, 173, -51, -256, 443, -147, -565, 1005, -383, -1213, 2368, -1120, -3601, 12424, 21483, 5379, -4576, 1219, 1254, -1611, 544, 514, -725, 266, 212, -312, 118, 76, -112, 41, 21, -28, 9, 3},
+    {-3, 9, -2, -27, 53, -14, -98, 174, -53, -255, 444, -151, -562, 1007, -392, -1205, 2374, -1143, -3579, 12486, 21462, 5319, -4573, 1236, 1241, -1610, 551, 508, -725, 269, 210, -311, 119, 75, -112, 42, 20, -28, 9, 3},
+    {-3, 9, -3, -27, 53, -15, -98, 174, -54, -253, 445, -155, -559, 1010, -401, -1197, 2380, -1166, -3558, 12547, 21444, 5259, -4569, 1253, 1229, -1610, 558, 503, -724, 272, 207, -311, 120, 74, -112, 42, 20, -28, 9, 3},
+    {-3, 9, -3, -27, 53, -15, -97, 175, -56, -252, 447, -159, -556, 1012, -409, -1190, 2385, -1189, -3536, 12608, 21425, 5199, -4565, 1270, 1216, -1609, 564, 497, -724, 275, 205, -311, 121, 73, -112, 43, 20, -28, 9, 3},
+    {-3, 9, -3, -27, 53, -16, -97, 175, -58, -251, 448, -164, -552, 1014, -418, -1182, 2391, -1212, -3513, 12669, 21409, 5139, -4561, 1286, 1203, -1608, 571, 491, -723, 278, 202, -310, 122, 72, -112, 43, 19, -28, 9, 3},
+    {-3, 9, -3, -27, 53, -17, -96, 176, -59, -249, 449, -168, -549, 1017, -427, -1174, 2396, -1235, -3491, 12730, 21388, 5079, -4557, 1302, 1190, -1607, 578, 486, -723, 281, 200, -310, 123, 71, -111, 43, 19, -28, 9, 3},
+    {-3, 9, -3, -27, 54, -17, -96, 177, -61, -248, 450, -172, -546, 1019, -436, -1166, 2401, -1258, -3468, 12791, 21368, 5019, -4553, 1319, 1177, -1606, 584, 480, -722, 283, 197, -309, 124, 70, -111, 44, 19, -28, 10, 3},
+    {-3, 9, -3, -27, 54, -18, -95, 177, -63, -247, 451, -176, -542, 1021, -445, -1158, 2406, -1281, -3445, 12852, 21349, 4960, -4548, 1335, 1164, -1605, 591, 474, -721, 286, 194, -309, 126, 69, -111, 44, 18, -28, 10, 3},
+    {-3, 9, -3, -27, 54, -18, -95, 178, -65, -245, 453, -180, -539, 1024, -454, -1150, 2411, -1304, -3422, 12913, 21329, 4900, -4543, 1351, 1151, -1604, 597, 469, -721, 289, 192, -309, 127, 68, -111, 44, 18, -28, 10, 2},
+    {-3, 9, -3, -27, 54, -19, -94, 178, -66, -244, 454, -184, -535, 1026, -463, -1142, 2416, -1327, -3398, 12973, 21307, 4841, -4538, 1367, 1138, -1603, 604, 463, -720, 292, 189, -308, 128, 67, -111, 45, 18, -28, 10, 2},
+    {-3, 9, -4, -26, 54, -20, -94, 179, -68, -242, 455, -188, -532, 1028, -471, -1134, 2421, -1351, -3375, 13034, 21289, 4781, -4533, 1383, 1124, -1602, 610, 457, -719, 295, 187, -308, 129, 66, -110, 45, 18, -28, 10, 2},
+    {-3, 9, -4, -26, 55, -20, -93, 179, -70, -241, 456, -192, -528, 1030, -480, -1125, 2425, -1374, -3351, 13094, 21269, 4722, -4528, 1399, 1111, -1601, 617, 451, -719, 298, 184, -307, 130, 65, -110, 45, 17, -28, 10, 2},
+    {-3, 9, -4, -26, 55, -21, -93, 180, -71, -239, 457, -196, -525, 1032, -489, -1117, 2430, -1397, -3326, 13155, 21246, 4663, -4522, 1415, 1098, -1599, 623, 445, -718, 300, 181, -307, 131, 64, -110, 46, 17, -28, 10, 2},
+    {-3, 10, -4, -26, 55, -21, -93, 180, -73, -238, 458, -200, -521, 1034, -498, -1109, 2435, -1420, -3302, 13215, 21223, 4604, -4517, 1430, 1085, -1598, 630, 440, -717, 303, 179, -306, 132, 63, -110, 46, 17, -27, 10, 2},
+    {-3, 10, -4, -26, 55, -22, -92, 181, -75, -236, 459, -204, -517, 1036, -507, -1100, 2439, -1443, -3277, 13275, 21200, 4545, -4511, 1446, 1072, -1596, 636, 434, -716, 306, 176, -306, 133, 62, -109, 46, 16, -27, 10, 2},
+    {-3, 10, -4, -26, 55, -23, -92, 181, -76, -235, 460, -208, -514, 1038, -516, -1092, 2443, -1466, -3252, 13335, 21180, 4487, -4505, 1461, 1059, -1595, 642, 428, -715, 309, 173, -305, 134, 61, -109, 47, 16, -27, 10, 2},
+    {-3, 10, -4, -26, 56, -23, -91, 182, -78, -233, 461, -212, -510, 1040, -524, -1083, 2448, -1489, -3227, 13395, 21153, 4428, -4499, 1477, 1045, -1593, 649, 422, -714, 311, 171, -305, 135, 60, -109, 47, 16, -27, 10, 2},
+    {-3, 10, -5, -26, 56, -24, -90, 182, -80, -232, 462, -216, -506, 1042, -533, -1075, 2452, -1512, -3202, 13455, 21135, 4369, -4492, 1492, 1032, -1592, 655, 416, -713, 314, 168, -304, 136, 59, -109, 47, 15, -27, 10, 2},
+    {-3, 10, -5, -25, 56, -24, -90, 183, -82, -230, 463, -220, -502, 1043, -542, -1066, 2456, -1535, -3176, 13515, 21109, 4311, -4486, 1507, 1019, -1590, 661, 411, -713, 317, 166, -304, 137, 58, -108, 47, 15, -27, 10, 2},
+    {-3, 10, -5, -25, 56, -25, -89, 183, -83, -229, 464, -224, -499, 1045, -551, -1057, 2460, -1558, -3151, 13575, 21086, 4253, -4479, 1522, 1006, -1588, 667, 405, -712, 319, 163, -303, 138, 57, -108, 48, 15, -27, 10, 2},
+    {-3, 10, -5, -25, 56, -26, -89, 183, -85, -227, 465, -228, -495, 1047, -559, -1048, 2463, -1581, -3124, 13634, 21066, 4194, -4472, 1537, 992, -1586, 673, 399, -711, 322, 160, -303, 139, 56, -108, 48, 14, -27, 10, 2},
+    {-3, 10, -5, -25, 56, -26, -88, 184, -87, -226, 466, -232, -491, 1049, -568, -1040, 2467, -1603, -3098, 13694, 21039, 4136, -4465, 1552, 979, -1584, 679, 393, -709, 324, 158, -302, 140, 55, -108, 48, 14, -27, 10, 2},
+    {-3, 10, -5, -25, 57, -27, -88, 184, -88, -224, 467, -236, -487, 1050, -577, -1031, 2471, -1626, -3072, 13753, 21014, 4078, -4458, 1567, 966, -1582, 685, 387, -708, 327, 155, -302, 141, 54, -107, 49, 14, -27, 10, 2},
+    {-3, 10, -5, -25, 57, -27, -87, 185, -90, -223, 467, -240, -483, 1052, -586, -1022, 2474, -1649, -3045, 13813, 20991, 4021, -4450, 1581, 952, -1580, 691, 381, -707, 330, 152, -301, 142, 52, -107, 49, 13, -27, 10, 2},
+    {-3, 10, -6, -25, 57, -28, -87, 185, -92, -221, 468, -244, -479, 1053, -594, -1013, 2478, -1672, -3018, 13872, 20968, 3963, -4443, 1596, 939, -1578, 697, 375, -706, 332, 150, -300, 143, 51, -107, 49, 13, -27, 10, 2},
+    {-3, 10, -6, -25, 57, -29, -86, 186, -94, -219, 469, -248, -475, 1055, -603, -1003, 2481, -1695, -2991, 13931, 20941, 3905, -4435, 1610, 925, -1576, 703, 369, -705, 335, 147, -300, 144, 50, -107, 50, 13, -26, 11, 2},
+    {-3, 10, -6, -24, 57, -29, -86, 186, -95, -218, 470, -252, -471, 1056, -612, -994, 2484, -1718, -2963, 13990, 20912, 3848, -4427, 1625, 912, -1573, 709, 364, -704, 337, 144, -299, 145, 49, -106, 50, 13, -26, 11, 2},
+    {-3, 10, -6, -24, 57, -30, -85, 186, -97, -216, 471, -256, -467, 1058, -621, -985, 2487, -1741, -2935, 14049, 20888, 3790, -4419, 1639, 899, -1571, 715, 358, -703, 340, 142, -299, 146, 48, -106, 50, 12, -26, 11, 2},
+    {-3, 10, -6, -24, 58, -30, -84, 187, -99, -214, 471, -260, -463, 1059, -629, -976, 2490, -1764, -2908, 14107, 20864, 3733, -4410, 1653, 885, -1569, 720, 352, -701, 342, 139, -298, 147, 47, -106, 50, 12, -26, 11, 1},
+    {-3, 10, -6, -24, 58, -31, -84, 187, -100, -213, 472, -264, -459, 1060, -638, -966, 2493, -1787, -2879, 14166, 20835, 3676, -4402, 1667, 872, -1566, 726, 346, -700, 345, 136, -297, 148, 46, -105, 51, 12, -26, 11, 1},
+    {-3, 10, -6, -24, 58, -32, -83, 188, -102, -211, 473, -267, -455, 1062, -647, -957, 2496, -1809, -2851, 14225, 20808, 3619, -4393, 1681, 858, -1564, 732, 340, -699, 347, 134, -297, 149, 45, -105, 51, 11, -26, 11, 1},
+    {-3, 10, -7, -24, 58, -32, -83, 188, -104, -209, 474, -271, -451, 1063, -655, -947, 2499, -1832, -2822, 14283, 20781, 3562, -4384, 1695, 845, -1561, 737, 334, -697, 349, 131, -296, 150, 44, -105, 51, 11, -26, 11, 1},
+    {-3, 10, -7, -24, 58, -33, -82, 188, -105, -208, 474, -275, -447, 1064, -664, -938, 2501, -1855, -2793, 14341, 20756, 3505, -4375, 1709, 831, -1558, 743, 328, -696, 352, 129, -295, 151, 43, -105, 51, 11, -26, 11, 1},
+    {-3, 10, -7, -23, 58, -33, -81, 189, -107, -206, 475, -279, -443, 1065, -672, -928, 2504, -1878, -2764, 14399, 20725, 3449, -4366, 1722, 818, -1556, 749, 322, -695, 354, 126, -294, 152, 42, -104, 52, 10, -26, 11, 1},
+    {-3, 10, -7, -23, 58, -34, -81, 189, -109, -204, 476, -283, -439, 1066, -681, -919, 2506, -1900, -2735, 14457, 20701, 3392, -4357, 1736, 804, -1553, 754, 316, -693, 357, 123, -294, 153, 41, -104, 52, 10, -26, 11, 1},
+    {-3, 10, -7, -23, 59, -35, -80, 189, -110, -202, 476, -287, -435, 1067, -690, -909, 2508, -1923, -2705, 14515, 20672, 3336, -4348, 1749, 791, -1550, 760, 310, -692, 359, 121, -293, 153, 40, -104, 52, 10, -25, 11, 1},
+    {-3, 10, -7, -23, 59, -35, -80, 190, -112, -201, 477, -291, -430, 1068, -698, -899, 2511, -1946, -2676, 14573, 20643, 3280, -4338, 1762, 777, -1547, 765, 304, -690, 361, 118, -292, 154, 39, -103, 52, 9, -25, 11, 1},
+    {-3, 10, -7, -23, 59, -36, -79, 190, -114, -199, 477, -295, -426, 1069, -707, -889, 2513, -1968, -2646, 14631, 20613, 3224, -4328, 1776, 764, -1544, 770, 298, -689, 364, 115, -291, 155, 38, -103, 53, 9, -25, 11, 1},
+    {-3, 11, -8, -23, 59, -36, -78, 190, -116, -197, 478, -299, -422, 1070, -715, -879, 2515, -1991, -2615, 14688, 20583, 3168, -4318, 1789, 750, -1541, 776, 292, -687, 366, 113, -291, 156, 37, -103, 53, 9, -25, 11, 1},
+    {-3, 11, -8, -23, 59, -37, -78, 191, -117, -195, 479, -303, -417, 1071, -724, -869, 2516, -2014, -2585, 14745, 20555, 3112, -4308, 1802, 737, -1538, 781, 286, -686, 368, 110, -290, 157, 36, -102, 53, 9, -25, 11, 1},
+    {-3, 11, -8, -22, 59, -37, -77, 191, -119, -193, 479, -307, -413, 1072, -732, -859, 2518, -2036, -2554, 14803, 20525, 3057, -4298, 1814, 723, -1535, 786, 280, -684, 370, 107, -289, 158, 35, -102, 53, 8, -25, 11, 1},
+    {-3, 11, -8, -22, 59, -38, -77, 191, -121, -192, 480, -311, -409, 1073, -741, -849, 2520, -2059, -2523, 14860, 20494, 3001, -4287, 1827, 709, -1531, 792, 274, -682, 373, 105, -288, 159, 34, -102, 54, 8, -25, 11, 1},
+    {-3, 11, -8, -22, 60, -39, -76, 191, -122, -190, 480, -315, -404, 1073, -749, -839, 2521, -2081, -2492, 14917, 20464, 2946, -4277, 1840, 696, -1528, 797, 268, -681, 375, 102, -287, 159, 33, -101, 54, 8, -25, 11, 1},
+    {-3, 11, -8, -22, 60, -39, -75, 192, -124, -188, 481, -318, -400, 1074, -758, -829, 2523, -2104, -2460, 14973, 20436, 2890, -4266, 1852, 682, -1525, 802, 262, -679, 377, 99, -287, 160, 32, -101, 54, 7, -25, 11, 1},
+    {-3, 11, -8, -22, 60, -40, -75, 192, -126, -186, 481, -322, -395, 1075, -766, -819, 2524, -2126, -2429, 15030, 20404, 2835, -4255, 1865, 669, -1521, 807, 256, -677, 379, 97, -286, 161, 31, -101, 54, 7, -25, 11, 1},
+    {-3, 11, -9, -22, 60, -40, -74, 192, -127, -184, 481, -326, -391, 1075, -774, -809, 2525, -2149, -2397, 15087, 20373, 2780, -4244, 1877, 655, -1518, 812, 251, -676, 381, 94, -285, 162, 30, -100, 55, 7, -24, 11, 1},
+    {-3, 11, -9, -21, 60, -41, -73, 192, -129, -182, 482, -330, -386, 1076, -783, -798, 2526, -2171, -2365, 15143, 20340, 2726, -4233, 1889, 642, -1514, 817, 245, -674, 383, 91, -284, 163, 29, -100, 55, 6, -24, 11, 1},
+    {-3, 11, -9, -21, 60, -42, -73, 193, -131, -180, 482, -334, -382, 1076, -791, -788, 2527, -2193, -2332, 15199, 20310, 2671, -4221, 1901, 628, -1511, 822, 239, -672, 385, 89, -283, 163, 28, -99, 55, 6, -24, 11, 1},
+    {-3, 11, -9, -21, 60, -42, -72, 193, -132, -178, 483, -338, -377, 1077, -799, -777, 2528, -2216, -2300, 15256, 20274, 2617, -4210, 1913, 614, -1507, 827, 233, -670, 388, 86, -282, 164, 27, -99, 55, 6, -24, 11, 1},
+    {-3, 11, -9, -21, 60, -43, -71, 193, -134, -177, 483, -341, -373, 1077, -808, -767, 2529, -2238, -2267, 15311, 20246, 2562, -4198, 1925, 601, -1503, 832, 227, -668, 390, 83, -281, 165, 26, -99, 55, 5, -24, 11, 1},
+    {-3, 11, -9, -21, 60, -43, -71, 193, -136, -175, 483, -345, -368, 1078, -816, -756, 2530, -2260, -2234, 15367, 20213, 2508, -4186, 1937, 587, -1499, 837, 221, -667, 392, 81, -281, 166, 24, -98, 56, 5, -24, 11, 0},
+    {-3, 11, -9, -21, 61, -44, -70, 194, -137, -173, 484, -349, -364, 1078, -824, -746, 2530, -2282, -2201, 15423, 20182, 2454, -4175, 1949, 574, -1496, 841, 215, -665, 394, 78, -280, 166, 23, -98, 56, 5, -24, 11, 0},
+    {-3, 11, -10, -20, 61, -45, -69, 194, -139, -171, 484, -353, -359, 1078, -833, -735, 2531, -2304, -2167, 15478, 20149, 2400, -4162, 1960, 560, -1492, 846, 209, -663, 396, 75, -279, 167, 22, -98, 56, 5, -24, 12, 0},
+    {-3, 11, -10, -20, 61, -45, -68, 194, -140, -169, 484, -357, -354, 1078, -841, -724, 2531, -2326, -2134, 15534, 20114, 2346, -4150, 1972, 546, -1488, 851, 203, -661, 398, 73, -278, 168, 21, -97, 56, 4, -24, 12, 0},
+    {-3, 11, -10, -20, 61, -46, -68, 194, -142, -167, 484, -360, -350, 1078, -849, -714, 2531, -2348, -2100, 15589, 20083, 2293, -4138, 1983, 533, -1484, 855, 197, -659, 400, 70, -277, 169, 20, -97, 56, 4, -23, 12, 0},
+    {-3, 11, -10, -20, 61, -46, -67, 194, -144, -165, 485, -364, -345, 1079, -857, -703, 2531, -2370, -2066, 15644, 20048, 2239, -4125, 1994, 519, -1480, 860, 191, -657, 401, 67, -276, 169, 19, -96, 57, 4, -23, 12, 0},
+    {-3, 11, -10, -20, 61, -47, -66, 195, -145, -163, 485, -368, -340, 1079, -865, -692, 2531, -2392, -2031, 15699, 20011, 2186, -4112, 2005, 506, -1476, 865, 185, -655, 403, 65, -275, 170, 18, -96, 57, 3, -23, 12, 0},
+    {-3, 11, -10, -20, 61, -48, -66, 195, -147, -161, 485, -372, -335, 1079, -873, -681, 2531, -2414, -1997, 15754, 19980, 2133, -4100, 2016, 492, -1471, 869, 179, -653, 405, 62, -274, 171, 17, -96, 57, 3, -23, 12, 0},
+    {-3, 11, -10, -19, 61, -48, -65, 195, -149, -159, 485, -375, -331, 1079, -882, -670, 2531, -2436, -1962, 15808, 19946, 2080, -4087, 2027, 478, -1467, 874, 173, -651, 407, 59, -273, 171, 16, -95, 57, 3, -23, 12, 0},
+    {-3, 11, -11, -19, 61, -49, -64, 195, -150, -157, 485, -379, -326, 1079, -890, -659, 2531, -2458, -1927, 15863, 19911, 2027, -4074, 2038, 465, -1463, 878, 167, -649, 409, 57, -272, 172, 15, -95, 57, 3, -23, 12, 0},
+    {-3, 11, -11, -19, 61, -49, -63, 195, -152, -155, 485, -383, -321, 1078, -898, -648, 2530, -2480, -1891, 15917, 19875, 1975, -4060, 2048, 451, -1458, 882, 161, -646, 411, 54, -271, 173, 14, -94, 58, 2, -23, 12, 0},
+    {-2, 11, -11, -19, 61, -50, -63, 195, -154, -153, 485, -387, -316, 1078, -906, -637, 2530, -2501, -1856, 15971, 19840, 1922, -4047, 2059, 438, -1454, 887, 155, -644, 413, 52, -270, 173, 13, -94, 58, 2, -23, 12, 0},
+    {-2, 11, -11, -19, 62, -51, -62, 195, -155, -151, 485, -390, -311, 1078, -914, -626, 2529, -2523, -1820, 16025, 19804, 1870, -4033, 2069, 424, -1450, 891, 149, -642, 414, 49, -269, 174, 12, -94, 58, 2, -22, 12, 0},
+    {-2, 11, -11, -18, 62, -51, -61, 195, -157, -149, 485, -394, -306, 1078, -922, -615, 2528, -2544, -1784, 16079, 19766, 1818, -4020, 2080, 411, -1445, 895, 143, -640, 416, 46, -268, 175, 11, -93, 58, 1, -22, 12, 0},
+    {-2, 11, -11, -18, 62, -52, -60, 196, -158, -146, 485, -398, -302, 1078, -930, -603, 2527, -2566, -1748, 16133, 19729, 1766, -4006, 2090, 397, -1440, 899, 137, -638, 418, 44, -267, 175, 10, -93, 58, 1, -22, 12, 0},
+    {-2, 11, -11, -18, 62, -52, -60, 196, -160, -144, 485, -401, -297, 1077, -938, -592, 2526, -2587, -1711, 16186, 19693, 1714, -3992, 2100, 384, -1436, 903, 131, -636, 420, 41, -266, 176, 9, -92, 58, 1, -22, 12, 0},
+    {-2, 11, -12, -18, 62, -53, -59, 196, -162, -142, 485, -405, -292, 1077, -946, -581, 2525, -2609, -1675, 16239, 19660, 1662, -3978, 2110, 370, -1431, 908, 125, -633, 421, 38, -265, 176, 8, -92, 59, 1, -22, 12, 0},
+    {-2, 11, -12, -18, 62, -53, -58, 196, -163, -140, 485, -409, -287, 1076, -953, -569, 2524, -2630, -1638, 16292, 19619, 1611, -3964, 2120, 356, -1426, 912, 119, -631, 423, 36, -263, 177, 7, -91, 59, 0, -22, 12, 0},
+    {-2, 11, -12, -17, 62, -54, -57, 196, -165, -138, 485, -412, -282, 1076, -961, -558, 2523, -2652, -1601, 16345, 19582, 1559, -3949, 2129, 343, -1421, 916, 113, -629, 425, 33, -262, 178, 6, -91, 59, 0, -22, 12, 0},
+    {-2, 11, -12, -17, 62, -55, -57, 196, -166, -136, 485, -416, -277, 1075, -969, -546, 2521, -2673, -1564, 16398, 19549, 1508, -3935, 2139, 329, -1417, 919, 107, -626, 426, 31, -261, 178, 5, -91, 59, 0, -22, 12, 0},
+    {-2, 12, -12, -17, 62, -55, -56, 196, -168, -134, 485, -420, -272, 1075, -977, -535, 2519, -2694, -1526, 16451, 19508, 1457, -3920, 2149, 316, -1412, 923, 101, -624, 428, 28, -260, 179, 4, -90, 59, -1, -21, 12, 0},
+    {-2, 12, -12, -17, 62, -56, -55, 196, -170, -132, 485, -423, -267, 1074, -985, -523, 2518, -2715, -1488, 16503, 19472, 1406, -3905, 2158, 303, -1407, 927, 95, -622, 429, 25, -259, 179, 3, -90, 59, -1, -21, 12, 0},
+    {-2, 12, -12, -17, 62, -56, -54, 196, -171, -129, 485, -427, -262, 1073, -992, -512, 2516, -2736, -1450, 16555, 19429, 1356, -3890, 2167, 289, -1402, 931, 90, -619, 431, 23, -258, 180, 2, -89, 59, -1, -21, 12, 0},
+    {-2, 12, -13, -16, 62, -57, -54, 196, -173, -127, 485, -430, -256, 1073, -1000, -500, 2514, -2757, -1412, 16607, 19392, 1305, -3875, 2176, 276, -1397, 935, 84, -617, 432, 20, -257, 180, 1, -89, 60, -1, -21, 12, 0},
+    {-2, 12, -13, -16, 62, -58, -53, 196, -174, -125, 485, -434, -251, 1072, -1008, -488, 2512, -2778, -1374, 16659, 19352, 1255, -3860, 2185, 262, -1391, 939, 78, -614, 434, 18, -256, 181, 0, -88, 60, -2, -21, 12, 0},
+    {-2, 12, -13, -16, 62, -58, -52, 196, -176, -123, 484, -437, -246, 1071, -1015, -477, 2510, -2799, -1335, 16711, 19316, 1205, -3845, 2194, 249, -1386, 942, 72, -612, 436, 15, -255, 181, -1, -88, 60, -2, -21, 12, -1},
+    {-2, 12, -13, -16, 62, -59, -51, 196, -177, -121, 484, -441, -241, 1070, -1023, -465, 2508, -2820, -1296, 16762, 19277, 1155, -3830, 2203, 235, -1381, 946, 66, -609, 437, 12, -253, 182, -2, -87, 60, -2, -21, 12, -1},
+    {-2, 12, -13, -16, 62, -59, -50, 196, -179, -118, 484, -444, -236, 1069, -1030, -453, 2505, -2840, -1257, 16814, 19237, 1105, -3814, 2212, 222, -1376, 949, 60, -607, 438, 10, -252, 182, -3, -87, 60, -3, -21, 12, -1},
+    {-2, 12, -13, -15, 62, -60, -50, 196, -180, -116, 484, -448, -231, 1068, -1038, -441, 2503, -2861, -1218, 16865, 19195, 1056, -3799, 2220, 209, -1370, 953, 54, -604, 440, 7, -251, 183, -4, -86, 60, -3, -20, 12, -1},
+    {-2, 12, -13, -15, 62, -60, -49, 196, -182, -114, 483, -451, -226, 1067, -1046, -429, 2500, -2882, -1179, 16916, 19160, 1006, -3783, 2229, 195, -1365, 956, 48, -602, 441, 5, -250, 183, -5, -86, 60, -3, -20, 12, -1},
+    {-2, 12, -14, -15, 62, -61, -48, 196, -184, -112, 483, -455, -220, 1066, -1053, -417, 2497, -2902, -1139, 16967, 19119, 957, -3767, 2237, 182, -1360, 960, 42, -599, 443, 2, -249, 184, -6, -86, 60, -3, -20, 12, -1},
+    {-2, 12, -14, -15, 62, -61, -47, 196, -185, -110, 483, -458, -215, 1065, -1060, -405, 2494, -2923, -1099, 17017, 19076, 908, -3751, 2245, 169, -1354, 963, 37, -596, 444, -1, -247, 184, -7, -85, 61, -4, -20, 12, -1},
+    {-2, 12, -14, -15, 62, -62, -46, 196, -187, -107, 482, -462, -210, 1064, -1068, -393, 2491, -2943, -1059, 17068, 19037, 859, -3735, 2254, 155, -1349, 967, 31, -594, 445, -3, -246, 185, -8, -85, 61, -4, -20, 12, -1},
+    {-2, 12, -14, -14, 63, -63, -45, 196, -188, -105, 482, -465, -204, 1062, -1075, -381, 2488, -2963, -1019, 17118, 18991, 811, -3719, 2262, 142, -1343, 970, 25, -591, 447, -6, -245, 185, -8, -84, 61, -4, -20, 12, -1},
+    {-2, 12, -14, -14, 63, -63, -45, 196, -190, -103, 481, -469, -199, 1061, -1083, -369, 2485, -2984, -978, 17168, 18953, 762, -3702, 2269, 129, -1337, 973, 19, -588, 448, -8, -244, 186, -9, -84, 61, -4, -20, 12, -1},
+    {-2, 12, -14, -14, 63, -64, -44, 196, -191, -100, 481, -472, -194, 1060, -1090, -357, 2482, -3004, -937, 17218, 18912, 714, -3686, 2277, 115, -1332, 976, 13, -586, 449, -11, -242, 186, -10, -83, 61, -5, -20, 12, -1},
+    {-2, 12, -15, -14, 63, -64, -43, 196, -193, -98, 481, -475, -189, 1058, -1097, -345, 2478, -3024, -896, 17267, 18869, 666, -3669, 2285, 102, -1326, 979, 7, -583, 451, -13, -241, 187, -11, -83, 61, -5, -19, 12, -1},
+    {-2, 12, -15, -13, 63, -65, -42, 195, -194, -96, 480, -479, -183, 1057, -1104, -333, 2475, -3044, -855, 17317, 18826, 618, -3652, 2292, 89, -1320, 982, 2, -580, 452, -16, -240, 187, -12, -82, 61, -5, -19, 12, -1},
+    {-2, 12, -15, -13, 63, -65, -41, 195, -196, -94, 480, -482, -178, 1056, -1111, -320, 2471, -3064, -814, 17366, 18785, 570, -3636, 2300, 76, -1314, 985, -4, -577, 453, -18, -239, 187, -13, -82, 61, -6, -19, 12, -1},
+    {-2, 12, -15, -13, 63, -66, -40, 195, -197, -91, 479, -485, -172, 1054, -1119, -308, 2467, -3083, -772, 17415, 18742, 522, -3619, 2307, 63, -1308, 988, -10, -575, 454, -21, -237, 188, -14, -81, 61, -6, -19, 12, -1},
+    {-2, 12, -15, -13, 63, -67, -40, 195, -199, -89, 478, -489, -167, 1052, -1126, -296, 2464, -3103, -730, 17464, 18705, 475, -3602, 2314, 49, -1303, 991, -16, -572, 455, -23, -236, 188, -15, -81, 61, -6, -19, 12, -1},
+    {-2, 12, -15, -12, 63, -67, -39, 195, -200, -87, 478, -492, -162, 1051, -1133, -283, 2460, -3123, -688, 17512, 18657, 428, -3584, 2321, 36, -1297, 994, -21, -569, 456, -26, -235, 189, -16, -80, 61, -6, -19, 12, -1},
+    {-2, 12, -15, -12, 63, -68, -38, 195, -202, -84, 477, -495, -156, 1049, -1140, -271, 2455, -3142, -646, 17561, 18614, 381, -3567, 2328, 23, -1291, 997, -27, -566, 458, -28, -234, 189, -17, -80, 62, -7, -19, 12, -1},
+    {-2, 12, -16, -12, 63, -68, -37, 195, -203, -82, 477, -499, -151, 1047, -1147, -258, 2451, -3162, -604, 17609, 18570, 334, -3550, 2335, 10, -1284, 1000, -33, -563, 459, -31, -232, 189, -18, -79, 62, -7, -18, 12, -1},
+    {-2, 12, -16, -12, 63, -69, -36, 194, -204, -80, 476, -502, -145, 1046, -1154, -246, 2447, -3181, -561, 17657, 18525, 287, -3532, 2342, -3, -1278, 1003, -39, -560, 460, -33, -231, 190, -19, -79, 62, -7, -18, 12, -1},
+    {-2, 12, -16, -12, 63, -69, -35, 194, -206, -77, 475, -505, -140, 1044, -1161, -233, 2442, -3201, -518, 17704, 18485, 241, -3515, 2348, -16, -1272, 1005, -44, -558, 461, -36, -230, 190, -20, -78, 62, -7, -18, 12, -1},
+    {-2, 12, -16, -11, 62, -70, -34, 194, -207, -75, 475, -508, -134, 1042, -1168, -221, 2438, -3220, -475, 17752, 18439, 195, -3497, 2355, -29, -1266, 1008, -50, -555, 462, -38, -228, 190, -21, -78, 62, -8, -18, 12, -1},
+    {-2, 12, -16, -11, 62, -70, -33, 194, -209, -72, 474, -512, -129, 1040, -1174, -208, 2433, -3239, -432, 17799, 18395, 149, -3479, 2361, -42, -1260, 1011, -56, -552, 463, -41, -227, 191, -22, -77, 62, -8, -18, 12, -1},
+    {-2, 12, -16, -11, 62, -71, -33, 194, -210, -70, 473, -515, -123, 1038, -1181, -196, 2428, -3258, -389, 17847, 18353, 103, -3461, 2367, -55, -1253, 1013, -62, -549, 464, -43, -226, 191, -23, -77, 62, -8, -18, 12, -1},
+    {-2, 12, -16, -11, 62, -71, -32, 194, -212, -68, 473, -518, -118, 1036, -1188, -183, 2423, -3277, -345, 17894, 18306, 57, -3443, 2374, -68, -1247, 1016, -67, -546, 465, -46, -224, 191, -24, -76, 62, -8, -18, 12, -1},
+    {-2, 12, -17, -10, 62, -72, -31, 193, -213, -65, 472, -521, -112, 1034, -1195, -170, 2418, -3296, -301, 17940, 18261, 12, -3425, 2380, -81, -1241, 1018, -73, -543, 466, -48, -223, 192, -24, -76, 62, -9, -17, 12, -1},
+    {-2, 12, -17, -10, 62, -72, -30, 193, -215, -63, 471, -524, -107, 1032, -1201, -158, 2413, -3315, -257, 17987, 18217, -34, -3407, 2385, -94, -1234, 1021, -79, -540, 467, -51, -221, 192, -25, -75, 62, -9, -17, 12, -1},
+    {-2, 12, -17, -10, 62, -73, -29, 193, -216, -60, 470, -527, -101, 1030, -1208, -145, 2408, -3333, -213, 18033, 18171, -79, -3389, 2391, -107, -1228, 1023, -84, -537, 468, -53, -220, 192, -26, -75, 62, -9, -17, 12, -1},
+    {-1, 12, -17, -10, 62, -74, -28, 193, -217, -58, 469, -530, -95, 1028, -1215, -132, 2402, -3352, -168, 18079, 18125, -124, -3370, 2397, -119, -1221, 1025, -90, -534, 468, -56, -219, 192, -27, -74, 62, -9, -17, 12, -1},
+    {-1, 12, -17, -9, 62, -74, -27, 192, -219, -56, 468, -534, -90, 1025, -1221, -119, 2397, -3370, -124, 18125, 18079, -168, -3352, 2402, -132, -1215, 1028, -95, -530, 469, -58, -217, 193, -28, -74, 62, -10, -17, 12, -1},
+    {-1, 12, -17, -9, 62, -75, -26, 192, -220, -53, 468, -537, -84, 1023, -1228, -107, 2391, -3389, -79, 18171, 18033, -213, -3333, 2408, -145, -1208, 1030, -101, -527, 470, -60, -216, 193, -29, -73, 62, -10, -17, 12, -2},
+    {-1, 12, -17, -9, 62, -75, -25, 192, -221, -51, 467, -540, -79, 1021, -1234, -94, 2385, -3407, -34, 18217, 17987, -257, -3315, 2413, -158, -1201, 1032, -107, -524, 471, -63, -215, 193, -30, -72, 62, -10, -17, 12, -2},
+    {-1, 12, -17, -9, 62, -76, -24, 192, -223, -48, 466, -543, -73, 1018, -1241, -81, 2380, -3425, 12, 18261, 17940, -301, -3296, 2418, -170, -1195, 1034, -112, -521, 472, -65, -213, 193, -31, -72, 62, -10, -17, 12, -2},
+    {-1, 12, -18, -8, 62, -76, -24, 191, -224, -46, 465, -546, -67, 1016, -1247, -68, 2374, -3443, 57, 18306, 17894, -345, -3277, 2423, -183, -1188, 1036, -118, -518, 473, -68, -212, 194, -32, -71, 62, -11, -16, 12, -2},
+    {-1, 12, -18, -8, 62, -77, -23, 191, -226, -43, 464, -549, -62, 1013, -1253, -55, 2367, -3461, 103, 18353, 17847, -389, -3258, 2428, -196, -1181, 1038, -123, -515, 473, -70, -210, 194, -33, -71, 62, -11, -16, 12, -2},
+    {-1, 12, -18, -8, 62, -77, -22, 191, -227, -41, 463, -552, -56, 1011, -1260, -42, 2361, -3479, 149, 18395, 17799, -432, -3239, 2433, -208, -1174, 1040, -129, -512, 474, -72, -209, 194, -33, -70, 62, -11, -16, 12, -2},
+    {-1, 12, -18, -8, 62, -78, -21, 190, -228, -38, 462, -555, -50, 1008, -1266, -29, 2355, -3497, 195, 18439, 17752, -475, -3220, 2438, -221, -1168, 1042, -134, -508, 475, -75, -207, 194, -34, -70, 62, -11, -16, 12, -2},
+    {-1, 12, -18, -7, 62, -78, -20, 190, -230, -36, 461, -558, -44, 1005, -1272, -16, 2348, -3515, 241, 18485, 17704, -518, -3201, 2442, -233, -1161, 1044, -140, -505, 475, -77, -206, 194, -35, -69, 63, -12, -16, 12, -2},
+    {-1, 12, -18, -7, 62, -79, -19, 190, -231, -33, 460, -560, -39, 1003, -1278, -3, 2342, -3532, 287, 18525, 17657, -561, -3181, 2447, -246, -1154, 1046, -145, -502, 476, -80, -204, 194, -36, -69, 63, -12, -16, 12, -2},
+    {-1, 12, -18, -7, 62, -79, -18, 189, -232, -31, 459, -563, -33, 1000, -1284, 10, 2335, -3550, 334, 18570, 17609, -604, -3162, 2451, -258, -1147, 1047, -151, -499, 477, -82, -203, 195, -37, -68, 63, -12, -16, 12, -2},
+    {-1, 12, -19, -7, 62, -80, -17, 189, -234, -28, 458, -566, -27, 997, -1291, 23, 2328, -3567, 381, 18614, 17561, -646, -3142, 2455, -271, -1140, 1049, -156, -495, 477, -84, -202, 195, -38, -68, 63, -12, -15, 12, -2},
+    {-1, 12, -19, -6, 61, -80, -16, 189, -235, -26, 456, -569, -21, 994, -1297, 36, 2321, -3584, 428, 18657, 17512, -688, -3123, 2460, -283, -1133, 1051, -162, -492, 478, -87, -200, 195, -39, -67, 63, -12, -15, 12, -2},
+    {-1, 12, -19, -6, 61, -81, -15, 188, -236, -23, 455, -572, -16, 991, -1303, 49, 2314, -3602, 475, 18705, 17464, -730, -3103, 2464, -296, -1126, 1052, -167, -489, 478, -89, -199, 195, -40, -67, 63, -13, -15, 12, -2},
+    {-1, 12, -19, -6, 61, -81, -14, 188, -237, -21, 454, -575, -10, 988, -1308, 63, 2307, -3619, 522, 18742, 17415, -772, -3083, 2467, -308, -1119, 1054, -172, -485, 479, -91, -197, 195, -40, -66, 63, -13, -15, 12, -2},
+    {-1, 12, -19, -6, 61, -82, -13, 187, -239, -18, 453, -577, -4, 985, -1314, 76, 2300, -3636, 570, 18785, 17366, -814, -3064, 2471, -320, -1111, 1056, -178, -482, 480, -94, -196, 195, -41, -65, 63, -13, -15, 12, -2},
+    {-1, 12, -19, -5, 61, -82, -12, 187, -240, -16, 452, -580, 2, 982, -1320, 89, 2292, -3652, 618, 18826, 17317, -855, -3044, 2475, -333, -1104, 1057, -183, -479, 480, -96, -194, 195, -42, -65, 63, -13, -15, 12, -2},
+    {-1, 12, -19, -5, 61, -83, -11, 187, -241, -13, 451, -583, 7, 979, -1326, 102, 2285, -3669, 666, 18869, 17267, -896, -3024, 2478, -345, -1097, 1058, -189, -475, 481, -98, -193, 196, -43, -64, 63, -14, -15, 12, -2},
+    {-1, 12, -20, -5, 61, -83, -10, 186, -242, -11, 449, -586, 13, 976, -1332, 115, 2277, -3686, 714, 18912, 17218, -937, -3004, 2482, -357, -1090, 1060, -194, -472, 481, -100, -191, 196, -44, -64, 63, -14, -14, 12, -2},
+    {-1, 12, -20, -4, 61, -84, -9, 186, -244, -8, 448, -588, 19, 973, -1337, 129, 2269, -3702, 762, 18953, 17168, -978, -2984, 2485, -369, -1083, 1061, -199, -469, 481, -103, -190, 196, -45, -63, 63, -14, -14, 12, -2},
+    {-1, 12, -20, -4, 61, -84, -8, 185, -245, -6, 447, -591, 25, 970, -1343, 142, 2262, -3719, 811, 18991, 17118, -1019, -2963, 2488, -381, -1075, 1062, -204, -465, 482, -105, -188, 196, -45, -63, 63, -14, -14, 12, -2},
+    {-1, 12, -20, -4, 61, -85, -8, 185, -246, -3, 445, -594, 31, 967, -1349, 155, 2254, -3735, 859, 19037, 17068, -1059, -2943, 2491, -393, -1068, 1064, -210, -462, 482, -107, -187, 196, -46, -62, 62, -15, -14, 12, -2},
+    {-1, 12, -20, -4, 61, -85, -7, 184, -247, -1, 444, -596, 37, 963, -1354, 169, 2245, -3751, 908, 19076, 17017, -1099, -2923, 2494, -405, -1060, 1065, -215, -458, 483, -110, -185, 196, -47, -61, 62, -15, -14, 12, -2},
+    {-1, 12, -20, -3, 60, -86, -6, 184, -249, 2, 443, -599, 42, 960, -1360, 182, 2237, -3767, 957, 19119, 16967, -1139, -2902, 2497, -417, -1053, 1066, -220, -455, 483, -112, -184, 196, -48, -61, 62, -15, -14, 12, -2},
+    {-1, 12, -20, -3, 60, -86, -5, 183, -250, 5, 441, -602, 48, 956, -1365, 195, 2229, -3783, 1006, 19160, 16916, -1179, -2882, 2500, -429, -1046, 1067, -226, -451, 483, -114, -182, 196, -49, -60, 62, -15, -13, 12, -2},
+    {-1, 12, -20, -3, 60, -86, -4, 183, -251, 7, 440, -604, 54, 953, -1370, 209, 2220, -3799, 1056, 19195, 16865, -1218, -2861, 2503, -441, -1038, 1068, -231, -448, 484, -116, -180, 196, -50, -60, 62, -15, -13, 12, -2},
+    {-1, 12, -21, -3, 60, -87, -3, 182, -252, 10, 438, -607, 60, 949, -1376, 222, 2212, -3814, 1105, 19237, 16814, -1257, -2840, 2505, -453, -1030, 1069, -236, -444, 484, -118, -179, 196, -50, -59, 62, -16, -13, 12, -2},
+    {-1, 12, -21, -2, 60, -87, -2, 182, -253, 12, 437, -609, 66, 946, -1381, 235, 2203, -3830, 1155, 19277, 16762, -1296, -2820, 2508, -465, -1023, 1070, -241, -441, 484, -121, -177, 196, -51, -59, 62, -16, -13, 12, -2},
+    {-1, 12, -21, -2, 60, -88, -1, 181, -255, 15, 436, -612, 72, 942, -1386, 249, 2194, -3845, 1205, 19316, 16711, -1335, -2799, 2510, -477, -1015, 1071, -246, -437, 484, -123, -176, 196, -52, -58, 62, -16, -13, 12, -2},
+    {0, 12, -21, -2, 60, -88, 0, 181, -256, 18, 434, -614, 78, 939, -1391, 262, 2185, -3860, 1255, 19352, 16659, -1374, -2778, 2512, -488, -1008, 1072, -251, -434, 485, -125, -174, 196, -53, -58, 62, -16, -13, 12, -2},
+    {0, 12, -21, -1, 60, -89, 1, 180, -257, 20, 432, -617, 84, 935, -1397, 276, 2176, -3875, 1305, 19392, 16607, -1412, -2757, 2514, -500, -1000, 1073, -256, -430, 485, -127, -173, 196, -54, -57, 62, -16, -13, 12, -2},
+    {0, 12, -21, -1, 59, -89, 2, 180, -258, 23, 431, -619, 90, 931, -1402, 289, 2167, -3890, 1356, 19429, 16555, -1450, -2736, 2516, -512, -992, 1073, -262, -427, 485, -129, -171, 196, -54, -56, 62, -17, -12, 12, -2},
+    {0, 12, -21, -1, 59, -90, 3, 179, -259, 25, 429, -622, 95, 927, -1407, 303, 2158, -3905, 1406, 19472, 16503, -1488, -2715, 2518, -523, -985, 1074, -267, -423, 485, -132, -170, 196, -55, -56, 62, -17, -12, 12, -2},
+    {0, 12, -21, -1, 59, -90, 4, 179, -260, 28, 428, -624, 101, 923, -1412, 316, 2149, -3920, 1457, 19508, 16451, -1526, -2694, 2519, -535, -977, 1075, -272, -420, 485, -134, -168, 196, -56, -55, 62, -17, -12, 12, -2},
+    {0, 12, -22, 0, 59, -91, 5, 178, -261, 31, 426, -626, 107, 919, -1417, 329, 2139, -3935, 1508, 19549, 16398, -1564, -2673, 2521, -546, -969, 1075, -277, -416, 485, -136, -166, 196, -57, -55, 62, -17, -12, 11, -2},
+    {0, 12, -22, 0, 59, -91, 6, 178, -262, 33, 425, -629, 113, 916, -1421, 343, 2129, -3949, 1559, 19582, 16345, -1601, -2652, 2523, -558, -961, 1076, -282, -412, 485, -138, -165, 196, -57, -54, 62, -17, -12, 11, -2},
+    {0, 12, -22, 0, 59, -91, 7, 177, -263, 36, 423, -631, 119, 912, -1426, 356, 2120, -3964, 1611, 19619, 16292, -1638, -2630, 2524, -569, -953, 1076, -287, -409, 485, -140, -163, 196, -58, -53, 62, -18, -12, 11, -2},
+    {0, 12, -22, 1, 59, -92, 8, 176, -265, 38, 421, -633, 125, 908, -1431, 370, 2110, -3978, 1662, 19660, 16239, -1675, -2609, 2525, -581, -946, 1077, -292, -405, 485, -142, -162, 196, -59, -53, 62, -18, -12, 11, -2},
+    {0, 12, -22, 1, 58, -92, 9, 176, -266, 41, 420, -636, 131, 903, -1436, 384, 2100, -3992, 1714, 19693, 16186, -1711, -2587, 2526, -592, -938, 1077, -297, -401, 485, -144, -160, 196, -60, -52, 62, -18, -11, 11, -2},
+    {0, 12, -22, 1, 58, -93, 10, 175, -267, 44, 418, -638, 137, 899, -1440, 397, 2090, -4006, 1766, 19729, 16133, -1748, -2566, 2527, -603, -930, 1078, -302, -398, 485, -146, -158, 196, -60, -52, 62, -18, -11, 11, -2},
+    {0, 12, -22, 1, 58, -93, 11, 175, -268, 46, 416, -640, 143, 895, -1445, 411, 2080, -4020, 1818, 19766, 16079, -1784, -2544, 2528, -615, -922, 1078, -306, -394, 485, -149, -157, 195, -61, -51, 62, -18, -11, 11, -2},
+    {0, 12, -22, 2, 58, -94, 12, 174, -269, 49, 414, -642, 149, 891, -1450, 424, 2069, -4033, 1870, 19804, 16025, -1820, -2523, 2529, -626, -914, 1078, -311, -390, 485, -151, -155, 195, -62, -51, 62, -19, -11, 11, -2},
+    {0, 12, -23, 2, 58, -94, 13, 173, -270, 52, 413, -644, 155, 887, -1454, 438, 2059, -4047, 1922, 19840, 15971, -1856, -2501, 2530, -637, -906, 1078, -316, -387, 485, -153, -154, 195, -63, -50, 61, -19, -11, 11, -2},
+    {0, 12, -23, 2, 58, -94, 14, 173, -271, 54, 411, -646, 161, 882, -1458, 451, 2048, -4060, 1975, 19875, 15917, -1891, -2480, 2530, -648, -898, 1078, -321, -383, 485, -155, -152, 195, -63, -49, 61, -19, -11, 11, -3},
+    {0, 12, -23, 3, 57, -95, 15, 172, -272, 57, 409, -649, 167, 878, -1463, 465, 2038, -4074, 2027, 19911, 15863, -1927, -2458, 2531, -659, -890, 1079, -326, -379, 485, -157, -150, 195, -64, -49, 61, -19, -11, 11, -3},
+    {0, 12, -23, 3, 57, -95, 16, 171, -273, 59, 407, -651, 173, 874, -1467, 478, 2027, -4087, 2080, 19946, 15808, -1962, -2436, 2531, -670, -882, 1079, -331, -375, 485, -159, -149, 195, -65, -48, 61, -19, -10, 11, -3},
+    {0, 12, -23, 3, 57, -96, 17, 171, -274, 62, 405, -653, 179, 869, -1471, 492, 2016, -4100, 2133, 19980, 15754, -1997, -2414, 2531, -681, -873, 1079, -335, -372, 485, -161, -147, 195, -66, -48, 61, -20, -10, 11, -3},
+    {0, 12, -23, 3, 57, -96, 18, 170, -275, 65, 403, -655, 185, 865, -1476, 506, 2005, -4112, 2186, 20011, 15699, -2031, -2392, 2531, -692, -865, 1079, -340, -368, 485, -163, -145, 195, -66, -47, 61, -20, -10, 11, -3},
+    {0, 12, -23, 4, 57, -96, 19, 169, -276, 67, 401, -657, 191, 860, -1480, 519, 1994, -4125, 2239, 20048, 15644, -2066, -2370, 2531, -703, -857, 1079, -345, -364, 485, -165, -144, 194, -67, -46, 61, -20, -10, 11, -3},
+    {0, 12, -23, 4, 56, -97, 20, 169, -277, 70, 400, -659, 197, 855, -1484, 533, 1983, -4138, 2293, 20083, 15589, -2100, -2348, 2531, -714, -849, 1078, -350, -360, 484, -167, -142, 194, -68, -46, 61, -20, -10, 11, -3},
+    {0, 12, -24, 4, 56, -97, 21, 168, -278, 73, 398, -661, 203, 851, -1488, 546, 1972, -4150, 2346, 20114, 15534, -2134, -2326, 2531, -724, -841, 1078, -354, -357, 484, -169, -140, 194, -68, -45, 61, -20, -10, 11, -3},
+    {0, 12, -24, 5, 56, -98, 22, 167, -279, 75, 396, -663, 209, 846, -1492, 560, 1960, -4162, 2400, 20149, 15478, -2167, -2304, 2531, -735, -833, 1078, -359, -353, 484, -171, -139, 194, -69, -45, 61, -20, -10, 11, -3},
+    {0, 11, -24, 5, 56, -98, 23, 166, -280, 78, 394, -665, 215, 841, -1496, 574, 1949, -4175, 2454, 20182, 15423, -2201, -2282, 2530, -746, -824, 1078, -364, -349, 484, -173, -137, 194, -70, -44, 61, -21, -9, 11, -3},
+    {0, 11, -24, 5, 56, -98, 24, 166, -281, 81, 392, -667, 221, 837, -1499, 587, 1937, -4186, 2508, 20213, 15367, -2234, -2260, 2530, -756, -816, 1078, -368, -345, 483, -175, -136, 193, -71, -43, 60, -21, -9, 11, -3},
+    {1, 11, -24, 5, 55, -99, 26, 165, -281, 83, 390, -668, 227, 832, -1503, 601, 1925, -4198, 2562, 20246, 15311, -2267, -2238, 2529, -767, -808, 1077, -373, -341, 483, -177, -134, 193, -71, -43, 60, -21, -9, 11, -3},
+    {1, 11, -24, 6, 55, -99, 27, 164, -282, 86, 388, -670, 233, 827, -1507, 614, 1913, -4210, 2617, 20274, 15256, -2300, -2216, 2528, -777, -799, 1077, -377, -338, 483, -178, -132, 193, -72, -42, 60, -21, -9, 11, -3},
+    {1, 11, -24, 6, 55, -99, 28, 163, -283, 89, 385, -672, 239, 822, -1511, 628, 1901, -4221, 2671, 20310, 15199, -2332, -2193, 2527, -788, -791, 1076, -382, -334, 482, -180, -131, 193, -73, -42, 60, -21, -9, 11, -3},
+    {1, 11, -24, 6, 55, -100, 29, 163, -284, 91, 383, -674, 245, 817, -1514, 642, 1889, -4233, 2726, 20340, 15143, -2365, -2171, 2526, -798, -783, 1076, -386, -330, 482, -182, -129, 192, -73, -41, 60, -21, -9, 11, -3},
+    {1, 11, -24, 7, 55, -100, 30, 162, -285, 94, 381, -676, 251, 812, -1518, 655, 1877, -4244, 2780, 20373, 15087, -2397, -2149, 2525, -809, -774, 1075, -391, -326, 481, -184, -127, 192, -74, -40, 60, -22, -9, 11, -3},
+    {1, 11, -25, 7, 54, -101, 31, 161, -286, 97, 379, -677, 256, 807, -1521, 669, 1865, -4255, 2835, 20404, 15030, -2429, -2126, 2524, -819, -766, 1075, -395, -322, 481, -186, -126, 192, -75, -40, 60, -22, -8, 11, -3},
+    {1, 11, -25, 7, 54, -101, 32, 160, -287, 99, 377, -679, 262, 802, -1525, 682, 1852, -4266, 2890, 20436, 14973, -2460, -2104, 2523, -829, -758, 1074, -400, -318, 481, -188, -124, 192, -75, -39, 60, -22, -8, 11, -3},
+    {1, 11, -25, 8, 54, -101, 33, 159, -287, 102, 375, -681, 268, 797, -1528, 696, 1840, -4277, 2946, 20464, 14917, -2492, -2081, 2521, -839, -749, 1073, -404, -315, 480, -190, -122, 191, -76, -39, 60, -22, -8, 11, -3},
+    {1, 11, -25, 8, 54, -102, 34, 159, -288, 105, 373, -682, 274, 792, -1531, 709, 1827, -4287, 3001, 20494, 14860, -2523, -2059, 2520, -849, -741, 1073, -409, -311, 480, -192, -121, 191, -77, -38, 59, -22, -8, 11, -3},
+    {1, 11, -25, 8, 53, -102, 35, 158, -289, 107, 370, -684, 280, 786, -1535, 723, 1814, -4298, 3057, 20525, 14803, -2554, -2036, 2518, -859, -732, 1072, -413, -307, 479, -193, -119, 191, -77, -37, 59, -22, -8, 11, -3},
+    {1, 11, -25, 9, 53, -102, 36, 157, -290, 110, 368, -686, 286, 781, -1538, 737, 1802, -4308, 3112, 20555, 14745, -2585, -2014, 2516, -869, -724, 1071, -417, -303, 479, -195, -117, 191, -78, -37, 59, -23, -8, 11, -3},
+    {1, 11, -25, 9, 53, -103, 37, 156, -291, 113, 366, -687, 292, 776, -1541, 750, 1789, -4318, 3168, 20583, 14688, -2615, -1991, 2515, -879, -715, 1070, -422, -299, 478, -197, -116, 190, -78, -36, 59, -23, -8, 11, -3},
+    {1, 11, -25, 9, 53, -103, 38, 155, -291, 115, 364, -689, 298, 770, -1544, 764, 1776, -4328, 3224, 20613, 14631, -2646, -1968, 2513, -889, -707, 1069, -426, -295, 477, -199, -114, 190, -79, -36, 59, -23, -7, 10, -3},
+    {1, 11, -25, 9, 52, -103, 39, 154, -292, 118, 361, -690, 304, 765, -1547, 777, 1762, -4338, 3280, 20643, 14573, -2676, -1946, 2511, -899, -698, 1068, -430, -291, 477, -201, -112, 190, -80, -35, 59, -23, -7, 10, -3},
+    {1, 11, -25, 10, 52, -104, 40, 153, -293, 121, 359, -692, 310, 760, -1550, 791, 1749, -4348, 3336, 20672, 14515, -2705, -1923, 2508, -909, -690, 1067, -435, -287, 476, -202, -110, 189, -80, -35, 59, -23, -7, 10, -3},
+    {1, 11, -26, 10, 52, -104, 41, 153, -294, 123, 357, -693, 316, 754, -1553, 804, 1736, -4357, 3392, 20701, 14457, -2735, -1900, 2506, -919, -681, 1066, -439, -283, 476, -204, -109, 189, -81, -34, 58, -23, -7, 10, -3},
+    {1, 11, -26, 10, 52, -104, 42, 152, -294, 126, 354, -695, 322, 749, -1556, 818, 1722, -4366, 3449, 20725, 14399, -2764, -1878, 2504, -928, -672, 1065, -443, -279, 475, -206, -107, 189, -81, -33, 58, -23, -7, 10, -3},
+    {1, 11, -26, 11, 51, -105, 43, 151, -295, 129, 352, -696, 328, 743, -1558, 831, 1709, -4375, 3505, 20756, 14341, -2793, -1855, 2501, -938, -664, 1064, -447, -275, 474, -208, -105, 188, -82, -33, 58, -24, -7, 10, -3},
+    {1, 11, -26, 11, 51, -105, 44, 150, -296, 131, 349, -697, 334, 737, -1561, 845, 1695, -4384, 3562, 20781, 14283, -2822, -1832, 2499, -947, -655, 1063, -451, -271, 474, -209, -104, 188, -83, -32, 58, -24, -7, 10, -3},
+    {1, 11, -26, 11, 51, -105, 45, 149, -297, 134, 347, -699, 340, 732, -1564, 858, 1681, -4393, 3619, 20808, 14225, -2851, -1809, 2496, -957, -647, 1062, -455, -267, 473, -211, -102, 188, -83, -32, 58, -24, -6, 10, -3},
+    {1, 11, -26, 12, 51, -105, 46, 148, -297, 136, 345, -700, 346, 726, -1566, 872, 1667, -4402, 3676, 20835, 14166, -2879, -1787, 2493, -966, -638, 1060, -459, -264, 472, -213, -100, 187, -84, -31, 58, -24, -6, 10, -3},
+    {1, 11, -26, 12, 50, -106, 47, 147, -298, 139, 342, -701, 352, 720, -1569, 885, 1653, -4410, 3733, 20864, 14107, -2908, -1764, 2490, -976, -629, 1059, -463, -260, 471, -214, -99, 187, -84, -30, 58, -24, -6, 10, -3},
+    {2, 11, -26, 12, 50, -106, 48, 146, -299, 142, 340, -703, 358, 715, -1571, 899, 1639, -4419, 3790, 20888, 14049, -2935, -1741, 2487, -985, -621, 1058, -467, -256, 471, -216, -97, 186, -85, -30, 57, -24, -6, 10, -3},
+    {2, 11, -26, 13, 50, -106, 49, 145, -299, 144, 337, -704, 364, 709, -1573, 912, 1625, -4427, 3848, 20912, 13990, -2963, -1718, 2484, -994, -612, 1056, -471, -252, 470, -218, -95, 186, -86, -29, 57, -24, -6, 10, -3},
+    {2, 11, -26, 13, 50, -107, 50, 144, -300, 147, 335, -705, 369, 703, -1576, 925, 1610, -4435, 3905, 20941, 13931, -2991, -1695, 2481, -1003, -603, 1055, -475, -248, 469, -219, -94, 186, -86, -29, 57, -25, -6, 10, -3},
+    {2, 10, -27, 13, 49, -107, 51, 143, -300, 150, 332, -706, 375, 697, -1578, 939, 1596, -4443, 3963, 20968, 13872, -3018, -1672, 2478, -1013, -594, 1053, -479, -244, 468, -221, -92, 185, -87, -28, 57, -25, -6, 10, -3},
+    {2, 10, -27, 13, 49, -107, 52, 142, -301, 152, 330, -707, 381, 691, -1580, 952, 1581, -4450, 4021, 20991, 13813, -3045, -1649, 2474, -1022, -586, 1052, -483, -240, 467, -223, -90, 185, -87, -27, 57, -25, -5, 10, -3},
+    {2, 10, -27, 14, 49, -107, 54, 141, -302, 155, 327, -708, 387, 685, -1582, 966, 1567, -4458, 4078, 21014, 13753, -3072, -1626, 2471, -1031, -577, 1050, -487, -236, 467, -224, -88, 184, -88, -27, 57, -25, -5, 10, -3},
+    {2, 10, -27, 14, 48, -108, 55, 140, -302, 158, 324, -709, 393, 679, -1584, 979, 1552, -4465, 4136, 21039, 13694, -3098, -1603, 2467, -1040, -568, 1049, -491, -232, 466, -226, -87, 184, -88, -26, 56, -25, -5, 10, -3},
+    {2, 10, -27, 14, 48, -108, 56, 139, -303, 160, 322, -711, 399, 673, -1586, 992, 1537, -4472, 4194, 21066, 13634, -3124, -1581, 2463, -1048, -559, 1047, -495, -228, 465, -227, -85, 183, -89, -26, 56, -25, -5, 10, -3},
+    {2, 10, -27, 15, 48, -108, 57, 138, -303, 163, 319, -712, 405, 667, -1588, 1006, 1522, -4479, 4253, 21086, 13575, -3151, -1558, 2460, -1057, -551, 1045, -499, -224, 464, -229, -83, 183, -89, -25, 56, -25, -5, 10, -3},
+    {2, 10, -27, 15, 47, -108, 58, 137, -304, 166, 317, -713, 411, 661, -1590, 1019, 1507, -4486, 4311, 21109, 13515, -3176, -1535, 2456, -1066, -542, 1043, -502, -220, 463, -230, -82, 183, -90, -24, 56, -25, -5, 10, -3},
+    {2, 10, -27, 15, 47, -109, 59, 136, -304, 168, 314, -713, 416, 655, -1592, 1032, 1492, -4492, 4369, 21135, 13455, -3202, -1512, 2452, -1075, -533, 1042, -506, -216, 462, -232, -80, 182, -90, -24, 56, -26, -5, 10, -3},
+    {2, 10, -27, 16, 47, -109, 60, 135, -305, 171, 311, -714, 422, 649, -1593, 1045, 1477, -4499, 4428, 21153, 13395, -3227, -1489, 2448, -1083, -524, 1040, -510, -212, 461, -233, -78, 182, -91, -23, 56, -26, -4, 10, -3},
+    {2, 10, -27, 16, 47, -109, 61, 134, -305, 173, 309, -715, 428, 642, -1595, 1059, 1461, -4505, 4487, 21180, 13335, -3252, -1466, 2443, -1092, -516, 1038, -514, -208, 460, -235, -76, 181, -92, -23, 55, -26, -4, 10, -3},
+    {2, 10, -27, 16, 46, -109, 62, 133, -306, 176, 306, -716, 434, 636, -1596, 1072, 1446, -4511, 4545, 21200, 13275, -3277, -1443, 2439, -1100, -507, 1036, -517, -204, 459, -236, -75, 181, -92, -22, 55, -26, -4, 10, -3},
+    {2, 10, -27, 17, 46, -110, 63, 132, -306, 179, 303, -717, 440, 630, -1598, 1085, 1430, -4517, 4604, 21223, 13215, -3302, -1420, 2435, -1109, -498, 1034, -521, -200, 458, -238, -73, 180, -93, -21, 55, -26, -4, 10, -3},
+    {2, 10, -28, 17, 46, -110, 64, 131, -307, 181, 300, -718, 445, 623, -1599, 1098, 1415, -4522, 4663, 21246, 13155, -3326, -1397, 2430, -1117, -489, 1032, -525, -196, 457, -239, -71, 180, -93, -21, 55, -26, -4, 9, -3},
+    {2, 10, -28, 17, 45, -110, 65, 130, -307, 184, 298, -719, 451, 617, -1601, 1111, 1399, -4528, 4722, 21269, 13094, -3351, -1374, 2425, -1125, -480, 1030, -528, -192, 456, -241, -70, 179, -93, -20, 55, -26, -4, 9, -3},
+    {2, 10, -28, 18, 45, -110, 66, 129, -308, 187, 295, -719, 457, 610, -1602, 1124, 1383, -4533, 4781, 21289, 13034, -3375, -1351, 2421, -1134, -471, 1028, -532, -188, 455, -242, -68, 179, -94, -20, 54, -26, -4, 9, -3},
+    {2, 10, -28, 18, 45, -111, 67, 128, -308, 189, 292, -720, 463, 604, -1603, 1138, 1367, -4538, 4841, 21307, 12973, -3398, -1327, 2416, -1142, -463, 1026, -535, -184, 454, -244, -66, 178, -94, -19, 54, -27, -3, 9, -3},
+    {2, 10, -28, 18, 44, -111, 68, 127, -309, 192, 289, -721, 469, 597, -1604, 1151, 1351, -4543, 4900, 21329, 12913, -3422, -1304, 2411, -1150, -454, 1024, -539, -180, 453, -245, -65, 178, -95, -18, 54, -27, -3, 9, -3},
+    {3, 10, -28, 18, 44, -111, 69, 126, -309, 194, 286, -721, 474, 591, -1605, 1164, 1335, -4548, 4960, 21349, 12852, -3445, -1281, 2406, -1158, -445, 1021, -542, -176, 451, -247, -63, 177, -95, -18, 54, -27, -3, 9, -3},
+    {3, 10, -28, 19, 44, -111, 70, 124, -309, 197, 283, -722, 480, 584, -1606, 1177, 1319, -4553, 5019, 21368, 12791, -3468, -1258, 2401, -1166, -436, 1019, -546, -172, 450, -248, -61, 177, -96, -17, 54, -27, -3, 9, -3},
+    {3, 9, -28, 19, 43, -111, 71, 123, -310, 200, 281, -723, 486, 578, -1607, 1190, 1302, -4557, 5079, 21388, 12730, -3491, -1235, 2396, -1174, -427, 1017, -549, -168, 449, -249, -59, 176, -96, -17, 53, -27, -3, 9, -3},
+    {3, 9, -28, 19, 43, -112, 72, 122, -310, 202, 278, -723, 491, 571, -1608, 1203, 1286, -4561, 5139, 21409, 12669, -3513, -1212, 2391, -1182, -418, 1014, -552, -164, 448, -251, -58, 175, -97, -16, 53, -27, -3, 9, -3},
+    {3, 9, -28, 20, 43, -112, 73, 121, -311, 205, 275, -724, 497, 564, -1609, 1216, 1270, -4565, 5199, 21425, 12608, -3536, -1189, 2385, -1190, -409, 1012, -556, -159, 447, -252, -56, 175, -97, -15, 53, -27, -3, 9, -3},
+    {3, 9, -28, 20, 42, -112, 74, 120, -311, 207, 272, -724, 503, 558, -1610, 1229, 1253, -4569, 5259, 21444, 12547, -3558, -1166, 2380, -1197, -401, 1010, -559, -155, 445, -253, -54, 174, -98, -15, 53, -27, -3, 9, -3},
+    {3, 9, -28, 20, 42, -112, 75, 119, -311, 210, 269, -725, 508, 551, -1610, 1241, 1236, -4573, 5319, 21462, 12486, -3579, -1143, 2374, -1205, -392, 1007, -562, -151, 444, -255, -53, 174, -98, -14, 53, -27, -2, 9, -3},
+    {3, 9, -28, 21, 41, -112, 76, 118, -312, 212, 266, -725, 514, 544, -1611, 1254, 1219, -4576, 5379, 21483, 12424, -3601, -1120, 2368, -1213, -383, 1005, -565, -147, 443, -256, -51, 173, -99, -14, 52, -27, -2, 9, -3},
+    {3, 9, -28, 21, 41, -112, 77, 116, -312, 215, 263, -726, 520, 537, -1611, 1267, 1203, -4579, 5439, 21497, 12363, -3622, -1097, 2363, -1220, -374, 1002, -569, -143, 442, -257, -49, 173, -99, -13, 52, -28, -2, 9, -3},
+    {3, 9, -29, 21, 41, -113, 78, 115, -312, 218, 260, -726, 525, 530, -1612, 1280, 1186, -4583, 5499, 21520, 12302, -3644, -1074, 2357, -1228, -365, 1000, -572, -139, 440, -259, -48, 172, -99, -13, 52, -28, -2, 9, -3},
+    {3, 9, -29, 22, 40, -113, 79, 114, -312, 220, 257, -726, 531, 523, -1612, 1293, 1169, -4585, 5560, 21533, 12240, -3664, -1051, 2351, -1235, -356, 997, -575, -135, 439, -260, -46, 171, -100, -12, 52, -28, -2, 9, -3},
+    {3, 9, -29, 22, 40, -113, 80, 113, -313, 223, 254, -727, 537, 516, -1613, 1305, 1151, -4588, 5620, 21552, 12178, -3685, -1029, 2345, -1242, -347, 994, -578, -131, 438, -261, -44, 171, -100, -11, 52, -28, -2, 9, -3},
+    {3, 9, -29, 22, 40, -113, 81, 112, -313, 225, 251, -727, 542, 510, -1613, 1318, 1134, -4591, 5681, 21569, 12117, -3706, -1006, 2339, -1249, -338, 992, -581, -127, 436, -262, -43, 170, -101, -11, 51, -28, -2, 9, -3},
+    {3, 9, -29, 23, 39, -113, 82, 111, -313, 228, 248, -727, 548, 502, -1613, 1331, 1117, -4593, 5742, 21582, 12055, -3726, -983, 2333, -1257, -330, 989, -584, -123, 435, -264, -41, 170, -101, -10, 51, -28, -1, 9, -3},
+    {3, 9, -29, 23, 39, -113, 83, 109, -313, 230, 245, -727, 553, 495, -1613, 1343, 1099, -4595, 5802, 21601, 11993, -3746, -960, 2326, -1264, -321, 986, -587, -119, 434, -265, -39, 169, -101, -10, 51, -28, -1, 9, -3},
+    {3, 9, -29, 23, 39, -113, 85, 108, -314, 233, 242, -728, 559, 488, -1613, 1356, 1082, -4597, 5863, 21614, 11931, -3765, -937, 2320, -1271, -312, 983, -590, -115, 432, -266, -37, 168, -102, -9, 51, -28, -1, 9, -3},
+    {3, 9, -29, 23, 38, -114, 86, 107, -314, 235, 238, -728, 564, 481, -1613, 1368, 1064, -4599, 5924, 21636, 11869, -3785, -914, 2313, -1278, -303, 980, -593, -111, 431, -267, -36, 168, -102, -9, 50, -28, -1, 8, -3},
+    {3, 8, -29, 24, 38, -114, 87, 106, -314, 238, 235, -728, 570, 474, -1613, 1381, 1047, -4600, 5985, 21647, 11807, -3804, -891, 2307, -1285, -294, 977, -596, -107, 429, -268, -34, 167, -103, -8, 50, -28, -1, 8, -3},
+    {3, 8, -29, 24, 37, -114, 88, 104, -314, 240, 232, -728, 575, 467, -1613, 1393, 1029, -4601, 6046, 21662, 11745, -3823, -868, 2300, -1292, -285, 975, -599, -103, 428, -269, -32, 166, -103, -7, 50, -28, -1, 8, -3},
+    {3, 8, -29, 24, 37, -114, 89, 103, -314, 243, 229, -728, 581, 460, -1613, 1406, 1011, -4603, 6108, 21674, 11683, -3842, -845, 2294, -1298, -276, 972, -602, -99, 426, -271, -31, 166, -103, -7, 50, -28, -1, 8, -3},
+    {4, 8, -29, 25, 37, -114, 90, 102, -314, 245, 226, -728, 586, 452, -1612, 1418, 993, -4603, 6169, 21687, 11621, -3860, -823, 2287, -1305, -267, 969, -605, -95, 425, -272, -29, 165, -104, -6, 49, -28, -1, 8, -3},
+    {4, 8, -29, 25, 36, -114, 91, 101, -314, 248, 223, -728, 592, 445, -1612, 1431, 975, -4604, 6230, 21702, 11559, -3879, -800, 2280, -1312, -259, 966, -608, -91, 423, -273, -27, 164, -104, -6, 49, -29, 0, 8, -3},
+    {4, 8, -29, 25, 36, -114, 92, 99, -315, 250, 219, -728, 597, 438, -1611, 1443, 957, -4605, 6291, 21717, 11497, -3897, -777, 2273, -1318, -250, 962, -611, -87, 422, -274, -26, 164, -104, -5, 49, -29, 0, 8, -3},
+    {4, 8, -29, 26, 35, -114, 93, 98, -315, 253, 216, -728, 603, 431, -1611, 1455, 939, -4605, 6353, 21729, 11434, -3915, -754, 2266, -1325, -241, 959, -613, -83, 420, -275, -24, 163, -105, -5, 49, -29, 0, 8, -3},
+    {4, 8, -29, 26, 35, -114, 94, 97, -315, 255, 213, -728, 608, 423, -1610, 1468, 920, -4605, 6414, 21740, 11372, -3932, -732, 2259, -1331, -232, 956, -616, -79, 419, -276, -22, 162, -105, -4, 49, -29, 0, 8, -3},
+    {4, 8, -29, 26, 35, -115, 95, 95, -315, 258, 210, -728, 613, 416, -1610, 1480, 902, -4605, 6476, 21754, 11309, -3949, -709, 2251, -1337, -223, 953, -619, -75, 417, -277, -21, 162, -105, -3, 48, -29, 0, 8, -3},
+    {4, 8, -29, 27, 34, -115, 96, 94, -315, 260, 206, -728, 619, 408, -1609, 1492, 883, -4605, 6538, 21767, 11247, -3967, -686, 2244, -1344, -214, 950, -621, -71, 416, -278, -19, 161, -106, -3, 48, -29, 0, 8, -3},
+    {4, 8, -30, 27, 34, -115, 97, 93, -315, 263, 203, -727, 624, 401, -1608, 1504, 865, -4604, 6599, 21777, 11184, -3983, -664, 2237, -1350, -205, 946, -624, -67, 414, -279, -17, 160, -106, -2, 48, -29, 0, 8, -3},
+    {4, 8, -30, 27, 33, -115, 98, 92, -315, 265, 200, -727, 629, 393, -1607, 1516, 846, -4604, 6661, 21793, 11122, -4000, -641, 2229, -1356, -197, 943, -627, -63, 412, -280, -16, 159, -106, -2, 48, -29, 0, 8, -3},
+    {4, 8, -30, 28, 33, -115, 99, 90, -315, 268, 197, -727, 635, 386, -1606, 1528, 828, -4603, 6723, 21799, 11059, -4017, -618, 2221, -1362, -188, 940, -629, -59, 411, -281, -14, 159, -107, -1, 47, -29, 1, 8, -3},
+    {4, 7, -30, 28, 33, -115, 100, 89, -315, 270, 193, -727, 640, 378, -1605, 1540, 809, -4602, 6785, 21813, 10997, -4033, -596, 2214, -1368, -179, 936, -632, -55, 409, -282, -12, 158, -107, -1, 47, -29, 1, 8, -3},
+    {4, 7, -30, 28, 32, -115, 101, 88, -315, 272, 190, -726, 645, 371, -1604, 1552, 790, -4600, 6847, 21821, 10934, -4049, -573, 2206, -1374, -170, 933, -634, -51, 408, -283, -11, 157, -107, 0, 47, -29, 1, 8, -3},
+    {4, 7, -30, 28, 32, -115, 102, 86, -315, 275, 186, -726, 650, 363, -1603, 1564, 771, -4599, 6909, 21833, 10871, -4064, -551, 2198, -1380, -161, 930, -637, -47, 406, -284, -9, 157, -108, 1, 47, -29, 1, 8, -3},
+    {4, 7, -30, 29, 31, -115, 103, 85, -315, 277, 183, -725, 656, 355, -1601, 1576, 752, -4597, 6971, 21842, 10809, -4080, -528, 2190, -1386, -153, 926, -639, -43, 404, -285, -7, 156, -108, 1, 46, -29, 1, 8, -3},
+    {4, 7, -30, 29, 31, -115, 103, 84, -315, 280, 180, -725, 661, 348, -1600, 1588, 733, -4595, 7033, 21850, 10746, -4095, -506, 2182, -1391, -144, 923, -641, -39, 402, -286, -6, 155, -108, 2, 46, -29, 1, 8, -3},
+    {4, 7, -30, 29, 30, -115, 104, 82, -315, 282, 176, -725, 666, 340, -1599, 1600, 714, -4593, 7095, 21864, 10683, -4110, -483, 2174, -1397, -135, 919, -644, -35, 401, -287, -4, 154, -108, 2, 46, -29, 1, 7, -3},
+    {4, 7, -30, 30, 30, -115, 105, 81, -315, 284, 173, -724, 671, 332, -1597, 1611, 695, -4591, 7158, 21873, 10620, -4125, -461, 2166, -1403, -126, 915, -646, -32, 399, -288, -3, 154, -109, 3, 46, -29, 1, 7, -3},
+    {4, 7, -30, 30, 30, -115, 106, 79, -315, 287, 170, -724, 676, 325, -1596, 1623, 675, -4588, 7220, 21882, 10557, -4140, -439, 2158, -1408, -117, 912, -648, -28, 397, -289, -1, 153, -109, 3, 45, -30, 2, 7, -3},
+    {5, 7, -30, 30, 29, -115, 107, 78, -314, 289, 166, -723, 681, 317, -1594, 1635, 656, -4585, 7282, 21888, 10494, -4154, -416, 2150, -1414, -109, 908, -651, -24, 396, -290, 1, 152, -109, 4, 45, -30, 2, 7, -3},
+    {5, 7, -30, 31, 29, -115, 108, 77, -314, 291, 163, -722, 687, 309, -1592, 1646, 636, -4582, 7345, 21894, 10431, -4168, -394, 2141, -1419, -100, 904, -653, -20, 394, -290, 2, 151, -109, 4, 45, -30, 2, 7, -3},
+    {5, 7, -30, 31, 28, -115, 109, 75, -314, 294, 159, -722, 692, 301, -1591, 1658, 617, -4579, 7407, 21903, 10368, -4182, -372, 2133, -1424, -91, 901, -655, -16, 392, -291, 4, 151, -110, 5, 44, -30, 2, 7, -3},
+    {5, 7, -30, 31, 28, -115, 110, 74, -314, 296, 156, -721, 697, 293, -1589, 1669, 597, -4576, 7470, 21912, 10305, -4196, -350, 2124, -1429, -83, 897, -657, -12, 390, -292, 6, 150, -110, 5, 44, -30, 2, 7, -3},
+    {5, 6, -30, 32, 27, -115, 111, 73, -314, 298, 152, -720, 702, 285, -1587, 1681, 578, -4572, 7532, 21919, 10242, -4209, -327, 2116, -1435, -74, 893, -660, -8, 388, -293, 7, 149, -110, 6, 44, -30, 2, 7, -3},
+    {5, 6, -30, 32, 27, -115, 112, 71, -314, 301, 149, -720, 707, 278, -1585, 1692, 558, -4568, 7595, 21923, 10179, -4222, -305, 2107, -1440, -65, 889, -662, -4, 387, -294, 9, 148, -110, 7, 44, -30, 2, 7, -3},
+    {5, 6, -30, 32, 26, -115, 113, 70, -313, 303, 145, -719, 712, 270, -1583, 1703, 538, -4564, 7657, 21933, 10116, -4235, -283, 2098, -1445, -56, 885, -664, 0, 385, -294, 10, 147, -111, 7, 43, -30, 2, 7, -3},
+    {5, 6, -30, 32, 26, -115, 114, 68, -313, 305, 142, -718, 717, 262, -1581, 1715, 518, -4560, 7720, 21937, 10053, -4248, -261, 2089, -1450, -48, 882, -666, 4, 383, -295, 12, 147, -111, 8, 43, -30, 2, 7, -3},
+    {5, 6, -30, 33, 26, -115, 115, 67, -313, 308, 138, -717, 722, 254, -1578, 1726, 498, -4555, 7783, 21937, 9990, -4260, -239, 2080, -1454, -39, 878, -668, 8, 381, -296, 14, 146, -111, 8, 43, -30, 3, 7, -3},
+    {5, 6, -30, 33, 25, -115, 116, 65, -313, 310, 135, -716, 726, 246, -1576, 1737, 478, -4551, 7846, 21947, 9927, -4273, -217, 2071, -1459, -30, 874, -670, 11, 379, -297, 15, 145, -111, 9, 43, -30, 3, 7, -3},
+    {5, 6, -30, 33, 25, -115, 117, 64, -313, 312, 131, -716, 731, 238, -1574, 1748, 458, -4546, 7908, 21955, 9864, -4285, -195, 2062, -1464, -22, 870, -672, 15, 377, -297, 17, 144, -111, 9, 42, -30, 3, 7, -3},
+    {5, 6, -30, 34, 24, -115, 118, 63, -312, 314, 127, -715, 736, 230, -1571, 1759, 438, -4541, 7971, 21959, 9801, -4296, -174, 2053, -1469, -13, 866, -674, 19, 375, -298, 18, 143, -112, 10, 42, -30, 3, 7, -3},
+    {5, 6, -30, 34, 24, -115, 119, 61, -312, 317, 124, -714, 741, 221, -1569, 1770, 418, -4535, 8034, 21962, 9737, -4308, -152, 2044, -1473, -5, 862, -675, 23, 373, -299, 20, 143, -112, 10, 42, -30, 3, 7, -3},
+    {5, 6, -30, 34, 23, -115, 120, 60, -312, 319, 120, -713, 746, 213, -1566, 1781, 397, -4530, 8097, 21967, 9674, -4319, -130, 2035, -1478, 4, 857, -677, 27, 371, -299, 22, 142, -112, 11, 41, -30, 3, 7, -3},
+    {5, 6, -30, 35, 23, -115, 121, 58, -311, 321, 117, -712, 751, 205, -1563, 1792, 377, -4524, 8160, 21968, 9611, -4330, -108, 2025, -1482, 13, 853, -679, 31, 369, -300, 23, 141, -112, 11, 41, -30, 3, 7, -3},
+    {5, 5, -30, 35, 22, -115, 122, 57, -311, 323, 113, -711, 755, 197, -1561, 1803, 356, -4518, 8223, 21975, 9548, -4341, -87, 2016, -1486, 21, 849, -681, 35, 367, -301, 25, 140, -112, 12, 41, -30, 3, 7, -3},
+    {5, 5, -30, 35, 22, -115, 122, 55, -311, 326, 109, -710, 760, 189, -1558, 1814, 336, -4512, 8286, 21982, 9485, -4352, -65, 2006, -1491, 30, 845, -683, 38, 365, -301, 26, 139, -113, 12, 41, -30, 3, 6, -3},
+    {5, 5, -30, 35, 21, -115, 123, 54, -310, 328, 106, -708, 765, 181, -1555, 1824, 315, -4505, 8349, 21980, 9422, -4362, -43, 1997, -1495, 38, 841, -684, 42, 363, -302, 28, 138, -113, 13, 40, -30, 4, 6, -3},
+    {6, 5, -30, 36, 21, -115, 124, 52, -310, 330, 102, -707, 770, 172, -1552, 1835, 295, -4499, 8412, 21984, 9358, -4373, -22, 1987, -1499, 47, 837, -686, 46, 361, -303, 29, 138, -113, 13, 40, -30, 4, 6, -3},
+    {6, 5, -30, 36, 20, -115, 125, 51, -310, 332, 98, -706, 774, 164, -1549, 1845, 274, -4492, 8475, 21988, 9295, -4383, 0, 1977, -1503, 55, 832, -688, 50, 359, -303, 31, 137, -113, 14, 40, -30, 4, 6, -3},
+    {6, 5, -30, 36, 20, -115, 126, 49, -309, 334, 95, -705, 779, 156, -1546, 1856, 253, -4485, 8538, 21986, 9232, -4392, 21, 1968, -1507, 64, 828, -689, 54, 357, -304, 33, 136, -113, 14, 40, -30, 4, 6, -3},
+    {6, 5, -30, 37, 19, -114, 127, 48, -309, 337, 91, -704, 783, 148, -1543, 1866, 232, -4478, 8601, 21989, 9169, -4402, 43, 1958, -1511, 72, 824, -691, 57, 355, -304, 34, 135, -113, 15, 39, -30, 4, 6, -3},
+    {6, 5, -30, 37, 19, -114, 128, 46, -308, 339, 87, -702, 788, 139, -1540, 1877, 212, -4470, 8664, 21989, 9106, -4411, 64, 1948, -1515, 81, 819, -692, 61, 353, -305, 36, 134, -114, 15, 39, -30, 4, 6, -3},
+    {6, 5, -30, 37, 18, -114, 129, 45, -308, 341, 84, -701, 793, 131, -1536, 1887, 191, -4462, 8727, 21989, 9043, -4420, 85, 1938, -1519, 89, 815, -694, 65, 351, -305, 37, 133, -114, 16, 39, -30, 4, 6, -3},
+    {6, 5, -30, 38, 18, -114, 130, 43, -307, 343, 80, -700, 797, 123, -1533, 1898, 170, -4454, 8790, 21989, 8979, -4429, 106, 1928, -1522, 98, 811, -695, 69, 349, -306, 39, 132, -114, 16, 38, -30, 4, 6, -3},
+    {6, 4, -30, 38, 17, -114, 131, 42, -307, 345, 76, -698, 802, 114, -1529, 1908, 149, -4446, 8853, 21993, 8916, -4438, 127, 1918, -1526, 106, 806, -697, 72, 347, -306, 40, 131, -114, 17, 38, -30, 4, 6, -3},
+};
+
+// 24000 Hz to 16000 Hz, 2 phases of 40 taps
+const int16_t polyphase_24000_16000[2][40] = {
+    {2, -9, 3, 28, -42, -25, 125, -75, -176, 316, 18, -579, 513, 512, -1357, 401, 2056, -2908, -1430, 13747, 19418, 5431, -4170, 38, 1959, -1069, -530, 913, -190, -427, 338, 58, -211, 77, 64, -65, 3, 22, -9, -2},
+    {-2, -9, 22, 3, -65, 64, 77, -211, 58, 338, -427, -190, 913, -530, -1069, 1959, 38, -4170, 5431, 19418, 13747, -1430, -2908, 2056, 401, -1357, 512, 513, -579, 18, 316, -176, -75, 125, -25, -42, 28, 3, -9, 2},
+};
+
+// 32000 Hz to 16000 Hz, 1 phases of 56 taps
+const int16_t polyphase_32000_16000[1][56] = {
+    {2, 4, -5, -12, 9, 30, -8, -61, -5, 105, 40, -161, -111, 218, 234, -262, -423, 266, 697, -192, -1083, -26, 1648, 536, -2633, -1915, 5650, 13843, 13841, 5650, -1915, -2633, 536, 1648, -26, -1083, -192, 697, 266, -423, -262, 234, 218, -111, -161, 40, 105, -5, -61, -8, 30, 9, -12, -5, 4, 2},
+};
+
+// 44100 Hz to 16000 Hz, 160 phases of 72 taps
+const int16_t polyphase_44100_16000[160][72] = {
+    {0, -2, -5, -2, 8, 15, 4, -20, -34, -8, 43, 65, 14, -80, -116, -22, 139, 193, 30, -229, -305, -40, 365, 471, 49, -575, -727, -57, 930, 1171, 63, -1665, -2202, -62, 4450, 9059, 10999, 9036, 4419, -84, -2206, -1656, 73, 1173, 925, -64, -728, -572, 53, 472, 363, -42, -306, -228, 32, 193, 138, -23, -116, -80, 15, 66, 43, -9, -34, -20, 4, 15, 8, -2, -5, -2},
+    {0, -2, -5, -2, 8, 15, 4, -21, -33, -8, 43, 65, 14, -81, -116, -21, 140, 192, 29, -231, -305, -37, 367, 470, 45, -578, -725, -51, 935, 1168, 52, -1675, -2198, -39, 4482, 9082, 11000, 9013, 4387, -106, -2210, -1647, 83, 1176, 920, -70, -730, -569, 57, 473, 361, -45, -306, -226, 34, 193, 138, -24, -117, -79, 15, 66, 42, -9, -34, -20, 5, 15, 8, -2, -5, -2},
+    {0, -2, -5, -2, 8, 15, 4, -21, -33, -8, 43, 65, 13, -81, -116, -20, 141, 192, 27, -232, -304, -35, 369, 469, 42, -581, -723, -45, 940, 1165, 42, -1684, -2194, -17, 4514, 9105, 10997, 8990, 4356, -128, -2214, -1638, 94, 1178, 915, -76, -731, -566, 61, 474, 359, -47, -307, -225, 35, 194, 137, -25, -117, -79, 16, 66, 42, -9, -34, -20, 5, 15, 8, -2, -5, -2},
+    {0, -2, -5, -2, 8, 15, 4, -21, -33, -8, 44, 65, 13, -82, -116, -19, 142, 192, 26, -233, -303, -32, 371, 468, 38, -585, -721, -39, 945, 1162, 31, -1693, -2189, 6, 4545, 9128, 10994, 8967, 4324, -150, -2218, -1628, 104, 1181, 910, -82, -733, -563, 65, 475, 357, -50, -307, -224, 37, 194, 136, -25, -117, -78, 16, 66, 42, -10, -34, -20, 5, 15, 8, -2, -5, -2},
+    {0, -2, -5, -2, 8, 15, 4, -21, -33, -7, 44, 65, 12, -82, -115, -18, 143, 191, 24, -234, -303, -30, 373, 467, 34, -588, -720, -33, 949, 1159, 21, -1702, -2185, 28, 4577, 9150, 10996, 8944, 4293, -172, -2222, -1619, 114, 1183, 905, -88, -734, -559, 69, 476, 355, -52, -308, -222, 38, 194, 135, -26, -117, -78, 17, 66, 41, -10, -34, -20, 5, 15, 8, -2, -5, -2},
+    {0, -2, -5, -2, 9, 15, 4, -21, -33, -7, 44, 65, 12, -83, -115, -17, 144, 191, 23, -236, -302, -27, 375, 466, 30, -591, -718, -26, 954, 1156, 10, -1711, -2180, 51, 4608, 9173, 10993, 8920, 4261, -193, -2225, -1610, 124, 1186, 900, -94, -736, -556, 73, 477, 352, -55, -308, -221, 40, 194, 134, -27, -117, -77, 17, 66, 41, -10, -34, -20, 5, 15, 8, -2, -5, -2},
+    {0, -2, -5, -2, 9, 15, 4, -21, -33, -7, 45, 65, 11, -83, -115, -16, 144, 191, 21, -237, -301, -25, 377, 464, 26, -594, -716, -20, 959, 1153, 0, -1720, -2175, 74, 4640, 9195, 10993, 8896, 4230, -215, -2229, -1600, 135, 1188, 894, -100, -737, -553, 76, 477, 350, -57, -309, -220, 41, 195, 133, -28, -117, -77, 18, 66, 41, -10, -34, -19, 5, 15, 8, -2, -5, -2},
+    {0, -2, -5, -1, 9, 15, 3, -22, -33, -6, 45, 65, 10, -84, -115, -15, 145, 190, 19, -238, -301, -22, 379, 463, 22, -597, -714, -14, 964, 1150, -11, -1728, -2170, 97, 4672, 9217, 10995, 8873, 4198, -237, -2232, -1591, 145, 1190, 889, -106, -739, -550, 80, 478, 348, -60, -309, -218, 43, 195, 132, -29, -117, -76, 18, 66, 40, -11, -34, -19, 5, 15, 8, -2, -5, -2},
+    {0, -2, -5, -1, 9, 15, 3, -22, -33, -6, 45, 65, 10, -84, -115, -14, 146, 190, 18, -240, -300, -20, 381, 462, 18, -600, -712, -8, 968, 1147, -21, -1737, -2165, 120, 4703, 9239, 10991, 8849, 4167, -258, -2235, -1581, 155, 1192, 884, -112, -740, -546, 84, 479, 346, -62, -310, -217, 44, 195, 131, -30, -117, -75, 19, 66, 40, -11, -34, -19, 5, 15, 8, -2, -5, -2},
+    {0, -2, -5, -1, 9, 15, 3, -22, -33, -6, 46, 65, 9, -85, -114, -13, 147, 189, 16, -241, -299, -17, 383, 461, 14, -603, -710, -1, 973, 1144, -32, -1746, -2160, 143, 4735, 9261, 10987, 8825, 4135, -279, -2239, -1572, 165, 1195, 879, -118, -741, -543, 88, 480, 344, -65, -310, -215, 46, 195, 130, -31, -118, -75, 20, 66, 40, -11, -34, -19, 6, 15, 8, -2, -5, -2},
+    {0, -2, -5, -1, 9, 15, 3, -22, -33, -6, 46, 65, 9, -85, -114, -12, 148, 189, 15, -242, -298, -15, 385, 460, 10, -605, -708, 5, 978, 1141, -43, -1755, -2155, 166, 4766, 9283, 10984, 8801, 4104, -301, -2242, -1562, 175, 1197, 874, -124, -743, -540, 92, 481, 342, -67, -311, -214, 47, 196, 130, -32, -118, -74, 20, 66, 40, -11, -34, -19, 6, 15, 7, -2, -5, -2},
+    {0, -3, -5, -1, 9, 15, 3, -22, -33, -5, 46, 65, 8, -86, -114, -11, 148, 188, 13, -244, -298, -12, 387, 458, 6, -608, -706, 11, 982, 1138, -53, -1763, -2150, 190, 4798, 9305, 10988, 8777, 4072, -322, -2245, -1552, 185, 1199, 868, -130, -744, -536, 95, 481, 339, -69, -311, -212, 49, 196, 129, -33, -118, -74, 21, 66, 39, -12, -34, -19, 6, 15, 7, -2, -5, -2},
+    {0, -3, -5, -1, 9, 15, 3, -22, -33, -5, 46, 64, 8, -86, -114, -10, 149, 188, 11, -245, -297, -10, 389, 457, 2, -611, -704, 17, 987, 1134, -64, -1772, -2144, 213, 4829, 9326, 10988, 8752, 4041, -343, -2247, -1542, 195, 1201, 863, -136, -745, -533, 99, 482, 337, -72, -312, -211, 50, 196, 128, -34, -118, -73, 21, 66, 39, -12, -34, -18, 6, 15, 7, -2, -5, -2},
+    {0, -3, -5, -1, 9, 15, 3, -22, -33, -5, 47, 64, 7, -87, -114, -9, 150, 188, 10, -246, -296, -7, 391, 456, -2, -614, -702, 24, 992, 1131, -75, -1780, -2139, 237, 4861, 9348, 10982, 8728, 4009, -364, -2250, -1533, 205, 1202, 858, -142, -746, -530, 103, 483, 335, -74, -312, -210, 52, 196, 127, -35, -118, -73, 22, 66, 39, -12, -34, -18, 6, 15, 7, -2, -5, -2},
+    {0, -3, -5, -1, 9, 15, 3, -23, -33, -4, 47, 64, 7, -87, -113, -8, 151, 187, 8, -247, -295, -4, 392, 455, -6, -617, -700, 30, 996, 1127, -85, -1789, -2133, 260, 4893, 9369, 10978, 8704, 3978, -384, -2253, -1523, 215, 1204, 852, -148, -747, -526, 107, 484, 333, -77, -312, -208, 53, 197, 126, -36, -118, -72, 22, 66, 38, -12, -34, -18, 6, 15, 7, -2, -5, -2},
+    {0, -3, -5, -1, 9, 15, 2, -23, -33, -4, 47, 64, 6, -88, -113, -7, 152, 187, 6, -248, -295, -2, 394, 453, -10, -620, -698, 36, 1001, 1124, -96, -1797, -2127, 284, 4924, 9391, 10980, 8679, 3947, -405, -2255, -1513, 225, 1206, 847, -154, -749, -523, 110, 484, 331, -79, -313, -207, 55, 197, 125, -36, -118, -72, 23, 66, 38, -13, -34, -18, 6, 15, 7, -2, -5, -2},
+    {0, -3, -5, -1, 9, 15, 2, -23, -33, -4, 47, 64, 5, -88, -113, -6, 152, 186, 5, -250, -294, 1, 396, 452, -14, -623, -696, 43, 1005, 1120, -107, -1806, -2121, 308, 4956, 9412, 10981, 8655, 3915, -426, -2258, -1503, 235, 1208, 841, -160, -750, -520, 114, 485, 328, -81, -313, -205, 56, 197, 124, -37, -118, -71, 23, 66, 38, -13, -34, -18, 6, 15, 7, -3, -5, -2},
+    {0, -3, -5, -1, 9, 15, 2, -23, -33, -4, 48, 64, 5, -89, -113, -5, 153, 186, 3, -251, -293, 3, 398, 451, -18, -625, -693, 49, 1009, 1117, -118, -1814, -2115, 332, 4987, 9433, 10973, 8630, 3884, -446, -2260, -1493, 245, 1210, 836, -166, -751, -516, 118, 485, 326, -84, -313, -204, 58, 197, 123, -38, -118, -70, 24, 66, 37, -13, -34, -18, 7, 15, 7, -3, -5, -2},
+    {0, -3, -5, -1, 9, 15, 2, -23, -33, -3, 48, 64, 4, -89, -112, -4, 154, 185, 2, -252, -292, 6, 400, 449, -22, -628, -691, 56, 1014, 1113, -128, -1822, -2109, 355, 5019, 9454, 10970, 8605, 3852, -467, -2262, -1483, 254, 1211, 830, -171, -752, -513, 122, 486, 324, -86, -314, -202, 59, 197, 122, -39, -118, -70, 24, 66, 37, -14, -34, -17, 7, 15, 7, -3, -5, -2},
+    {0, -3, -5, -1, 9, 15, 2, -23, -33, -3, 48, 64, 4, -90, -112, -3, 155, 185, 0, -253, -291, 9, 402, 448, -26, -631, -689, 62, 1018, 1109, -139, -1830, -2103, 380, 5050, 9474, 10965, 8580, 3821, -487, -2264, -1473, 264, 1213, 825, -177, -753, -509, 125, 487, 322, -89, -314, -201, 61, 197, 121, -40, -118, -69, 25, 66, 37, -14, -34, -17, 7, 15, 7, -3, -5, -2},
+    {0, -3, -5, -1, 10, 15, 2, -23, -33, -3, 49, 63, 3, -90, -112, -2, 156, 184, -2, -255, -290, 11, 403, 446, -30, -634, -686, 68, 1022, 1105, -150, -1839, -2096, 404, 5082, 9495, 10967, 8555, 3790, -507, -2266, -1463, 274, 1214, 819, -183, -754, -506, 129, 487, 319, -91, -314, -199, 62, 198, 120, -41, -118, -69, 25, 66, 36, -14, -34, -17, 7, 15, 7, -3, -5, -2},
+    {0, -3, -5, -1, 10, 15, 2, -24, -33, -2, 49, 63, 3, -91, -111, -1, 156, 184, -3, -256, -289, 14, 405, 445, -34, -636, -684, 75, 1027, 1102, -161, -1847, -2090, 428, 5114, 9516, 10954, 8530, 3759, -527, -2268, -1453, 284, 1216, 814, -189, -754, -502, 133, 488, 317, -93, -315, -198, 64, 198, 119, -42, -118, -68, 26, 66, 36, -14, -34, -17, 7, 15, 7, -3, -5, -2},
+    {0, -3, -5, -1, 10, 15, 1, -24, -33, -2, 49, 63, 2, -91, -111, 0, 157, 183, -5, -257, -289, 16, 407, 443, -38, -639, -682, 81, 1031, 1098, -172, -1855, -2083, 452, 5145, 9536, 10964, 8505, 3727, -547, -2270, -1443, 293, 1217, 808, -195, -755, -499, 136, 488, 315, -96, -315, -196, 65, 198, 118, -43, -119, -68, 26, 66, 36, -15, -34, -17, 7, 15, 7, -3, -5, -2},
+    {0, -3, -5, -1, 10, 15, 1, -24, -33, -2, 49, 63, 1, -92, -111, 1, 158, 183, -7, -258, -288, 19, 409, 442, -43, -641, -679, 88, 1035, 1094, -183, -1863, -2077, 477, 5177, 9556, 10956, 8479, 3696, -567, -2271, -1433, 303, 1218, 803, -200, -756, -495, 140, 489, 312, -98, -315, -195, 67, 198, 117, -43, -119, -67, 27, 66, 35, -15, -34, -17, 7, 15, 7, -3, -5, -2},
+    {0, -3, -5, -1, 10, 14, 1, -24, -32, -1, 50, 63, 1, -92, -111, 2, 159, 182, -8, -259, -287, 22, 410, 440, -47, -644, -677, 94, 1039, 1090, -194, -1871, -2070, 501, 5208, 9577, 10952, 8454, 3665, -587, -2273, -1423, 313, 1220, 797, -206, -757, -492, 144, 489, 310, -100, -315, -193, 68, 198, 116, -44, -119, -66, 27, 66, 35, -15, -34, -17, 7, 15, 6, -3, -5, -2},
+    {0, -3, -5, -1, 10, 14, 1, -24, -32, -1, 50, 63, 0, -93, -110, 3, 159, 182, -10, -260, -286, 24, 412, 439, -51, -647, -674, 100, 1043, 1086, -205, -1878, -2063, 526, 5240, 9597, 10949, 8428, 3634, -606, -2274, -1413, 322, 1221, 791, -212, -758, -488, 147, 490, 308, -103, -316, -192, 70, 198, 115, -45, -119, -66, 27, 66, 35, -15, -34, -16, 7, 15, 6, -3, -5, -2},
+    {0, -3, -5, -1, 10, 14, 1, -24, -32, -1, 50, 63, 0, -93, -110, 4, 160, 181, -12, -261, -285, 27, 414, 437, -55, -649, -672, 107, 1047, 1081, -216, -1886, -2056, 551, 5271, 9617, 10940, 8403, 3603, -626, -2275, -1402, 332, 1222, 786, -217, -758, -484, 151, 490, 305, -105, -316, -190, 71, 198, 115, -46, -119, -65, 28, 66, 34, -16, -34, -16, 8, 15, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 1, -24, -32, -1, 50, 62, -1, -94, -110, 5, 161, 180, -13, -263, -284, 29, 415, 435, -59, -652, -669, 113, 1052, 1077, -227, -1894, -2048, 575, 5302, 9636, 10946, 8377, 3571, -645, -2277, -1392, 341, 1223, 780, -223, -759, -481, 154, 490, 303, -107, -316, -189, 72, 198, 114, -47, -119, -65, 28, 66, 34, -16, -34, -16, 8, 15, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 1, -25, -32, 0, 51, 62, -1, -94, -109, 6, 162, 180, -15, -264, -283, 32, 417, 434, -63, -654, -666, 120, 1056, 1073, -238, -1902, -2041, 600, 5334, 9656, 10933, 8351, 3540, -665, -2278, -1382, 350, 1224, 774, -229, -760, -477, 158, 491, 301, -109, -316, -187, 74, 198, 113, -48, -119, -64, 29, 66, 34, -16, -34, -16, 8, 15, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 0, -25, -32, 0, 51, 62, -2, -94, -109, 7, 162, 179, -17, -265, -282, 35, 419, 432, -67, -657, -664, 126, 1059, 1069, -249, -1909, -2034, 625, 5365, 9676, 10934, 8325, 3509, -684, -2279, -1371, 360, 1225, 769, -234, -760, -474, 161, 491, 298, -112, -316, -186, 75, 198, 112, -49, -119, -64, 29, 66, 33, -16, -33, -16, 8, 15, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 0, -25, -32, 0, 51, 62, -3, -95, -109, 8, 163, 179, -18, -266, -281, 37, 420, 431, -71, -659, -661, 133, 1063, 1064, -260, -1917, -2026, 650, 5397, 9695, 10927, 8299, 3478, -703, -2280, -1361, 369, 1226, 763, -240, -761, -470, 165, 491, 296, -114, -316, -184, 77, 198, 111, -49, -119, -63, 30, 66, 33, -16, -33, -16, 8, 14, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 0, -25, -32, 1, 52, 62, -3, -95, -108, 9, 164, 178, -20, -267, -280, 40, 422, 429, -75, -662, -658, 139, 1067, 1060, -271, -1924, -2019, 675, 5428, 9714, 10919, 8273, 3447, -722, -2280, -1351, 379, 1227, 757, -246, -762, -466, 169, 492, 294, -116, -317, -183, 78, 198, 110, -50, -119, -62, 30, 66, 33, -17, -33, -15, 8, 14, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 0, -25, -32, 1, 52, 62, -4, -96, -108, 10, 164, 177, -22, -268, -279, 43, 424, 427, -79, -664, -656, 146, 1071, 1055, -282, -1932, -2011, 701, 5460, 9734, 10915, 8247, 3416, -741, -2281, -1340, 388, 1228, 751, -251, -762, -463, 172, 492, 291, -118, -317, -181, 80, 198, 109, -51, -119, -62, 31, 66, 32, -17, -33, -15, 8, 14, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 0, -25, -32, 1, 52, 61, -4, -96, -108, 11, 165, 177, -23, -269, -278, 45, 425, 425, -84, -667, -653, 152, 1075, 1051, -293, -1939, -2003, 726, 5491, 9753, 10911, 8221, 3385, -759, -2282, -1330, 397, 1229, 745, -257, -763, -459, 176, 492, 289, -121, -317, -179, 81, 199, 108, -52, -119, -61, 31, 66, 32, -17, -33, -15, 8, 14, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 0, -25, -32, 2, 52, 61, -5, -97, -107, 12, 166, 176, -25, -270, -277, 48, 427, 424, -88, -669, -650, 159, 1079, 1046, -304, -1946, -1995, 751, 5522, 9772, 10903, 8195, 3354, -778, -2282, -1319, 406, 1229, 740, -262, -763, -455, 179, 492, 286, -123, -317, -178, 82, 199, 107, -53, -119, -61, 32, 66, 32, -17, -33, -15, 8, 14, 6, -3, -5, -2},
+    {0, -3, -5, 0, 10, 14, 0, -26, -32, 2, 53, 61, -6, -97, -107, 13, 166, 175, -27, -271, -275, 51, 428, 422, -92, -671, -647, 165, 1082, 1042, -315, -1953, -1987, 777, 5554, 9790, 10899, 8168, 3323, -797, -2283, -1309, 415, 1230, 734, -268, -763, -452, 183, 493, 284, -125, -317, -176, 84, 199, 106, -54, -119, -60, 32, 66, 31, -18, -33, -15, 8, 14, 6, -3, -5, -1},
+    {0, -3, -5, 0, 11, 14, -1, -26, -32, 2, 53, 61, -6, -97, -107, 14, 167, 175, -28, -272, -274, 53, 430, 420, -96, -674, -644, 172, 1086, 1037, -327, -1961, -1979, 803, 5585, 9809, 10888, 8142, 3292, -815, -2283, -1298, 425, 1231, 728, -273, -764, -448, 186, 493, 282, -127, -317, -175, 85, 199, 105, -54, -119, -59, 33, 66, 31, -18, -33, -15, 9, 14, 6, -3, -5, -1},
+    {0, -3, -5, 0, 11, 14, -1, -26, -31, 3, 53, 61, -7, -98, -106, 15, 168, 174, -30, -273, -273, 56, 431, 418, -100, -676, -641, 178, 1090, 1032, -338, -1968, -1970, 828, 5616, 9828, 10881, 8115, 3262, -833, -2283, -1288, 434, 1231, 722, -279, -764, -444, 189, 493, 279, -129, -317, -173, 86, 199, 104, -55, -118, -59, 33, 66, 31, -18, -33, -14, 9, 14, 6, -3, -5, -1},
+    {0, -3, -5, 0, 11, 14, -1, -26, -31, 3, 53, 60, -7, -98, -106, 16, 168, 173, -32, -274, -272, 59, 433, 416, -104, -678, -638, 185, 1093, 1027, -349, -1975, -1962, 854, 5647, 9846, 10877, 8088, 3231, -852, -2283, -1277, 443, 1232, 716, -284, -764, -440, 193, 493, 277, -132, -317, -172, 88, 198, 103, -56, -118, -58, 34, 66, 30, -18, -33, -14, 9, 14, 6, -3, -5, -1},
+    {0, -3, -5, 0, 11, 14, -1, -26, -31, 3, 53, 60, -8, -99, -105, 17, 169, 173, -33, -275, -271, 61, 434, 414, -108, -680, -635, 191, 1097, 1022, -360, -1982, -1953, 880, 5679, 9864, 10874, 8062, 3200, -870, -2283, -1266, 452, 1232, 710, -289, -765, -437, 196, 493, 274, -134, -317, -170, 89, 198, 102, -57, -118, -58, 34, 66, 30, -19, -33, -14, 9, 14, 5, -3, -5, -1},
+    {0, -3, -5, 0, 11, 14, -1, -26, -31, 4, 54, 60, -9, -99, -105, 18, 170, 172, -35, -276, -270, 64, 436, 413, -112, -683, -632, 198, 1101, 1017, -371, -1989, -1945, 906, 5710, 9882, 10865, 8035, 3169, -888, -2283, -1256, 461, 1233, 704, -295, -765, -433, 200, 493, 272, -136, -317, -168, 90, 198, 101, -58, -118, -57, 34, 66, 30, -19, -33, -14, 9, 14, 5, -3, -5, -1},
+    {0, -3, -5, 0, 11, 14, -1, -26, -31, 4, 54, 60, -9, -99, -105, 19, 170, 171, -37, -277, -269, 67, 437, 411, -117, -685, -629, 204, 1104, 1012, -382, -1995, -1936, 932, 5741, 9900, 10859, 8008, 3139, -906, -2283, -1245, 470, 1233, 698, -300, -765, -429, 203, 493, 269, -138, -317, -167, 92, 198, 100, -58, -118, -56, 35, 66, 29, -19, -33, -14, 9, 14, 5, -3, -5, -1},
+    {0, -3, -5, 0, 11, 14, -1, -26, -31, 4, 54, 60, -10, -100, -104, 20, 171, 171, -39, -278, -267, 69, 439, 409, -121, -687, -626, 211, 1108, 1007, -394, -2002, -1927, 958, 5772, 9918, 10851, 7981, 3108, -923, -2283, -1234, 478, 1233, 692, -305, -765, -425, 207, 493, 267, -140, -317, -165, 93, 198, 99, -59, -118, -56, 35, 66, 29, -19, -33, -14, 9, 14, 5, -3, -5, -1},
+    {0, -3, -5, 0, 11, 14, -2, -27, -31, 5, 54, 59, -10, -100, -104, 21, 172, 170, -40, -279, -266, 72, 440, 407, -125, -689, -623, 217, 1111, 1002, -405, -2009, -1918, 984, 5803, 9936, 10848, 7954, 3077, -941, -2282, -1224, 487, 1233, 686, -311, -765, -422, 210, 493, 264, -142, -317, -164, 94, 198, 98, -60, -118, -55, 36, 66, 29, -19, -33, -13, 9, 14, 5, -3, -5, -1},
+    {0, -3, -5, 1, 11, 14, -2, -27, -31, 5, 55, 59, -11, -101, -103, 22, 172, 169, -42, -280, -265, 75, 442, 405, -129, -691, -620, 224, 1114, 997, -416, -2015, -1909, 1010, 5834, 9954, 10843, 7926, 3047, -959, -2282, -1213, 496, 1234, 680, -316, -766, -418, 213, 493, 262, -145, -317, -162, 96, 198, 97, -61, -118, -55, 36, 66, 28, -20, -33, -13, 9, 14, 5, -4, -5, -1},
+    {0, -3, -5, 1, 11, 14, -2, -27, -31, 5, 55, 59, -12, -101, -103, 23, 173, 169, -44, -281, -264, 77, 443, 403, -133, -693, -617, 231, 1118, 992, -427, -2022, -1899, 1037, 5865, 9971, 10831, 7899, 3016, -976, -2281, -1202, 505, 1234, 674, -321, -766, -414, 217, 493, 259, -147, -317, -160, 97, 198, 96, -61, -118, -54, 37, 66, 28, -20, -33, -13, 9, 14, 5, -4, -5, -1},
+    {0, -3, -5, 1, 11, 14, -2, -27, -31, 5, 55, 59, -12, -101, -103, 24, 174, 168, -45, -282, -262, 80, 444, 401, -137, -695, -613, 237, 1121, 987, -439, -2028, -1890, 1063, 5896, 9988, 10823, 7872, 2986, -993, -2280, -1191, 513, 1234, 668, -327, -766, -410, 220, 493, 257, -149, -317, -159, 98, 198, 95, -62, -118, -53, 37, 65, 28, -20, -33, -13, 10, 14, 5, -4, -5, -1},
+    {0, -3, -5, 1, 11, 14, -2, -27, -31, 6, 55, 59, -13, -102, -102, 25, 174, 167, -47, -283, -261, 83, 446, 399, -142, -697, -610, 244, 1124, 981, -450, -2035, -1880, 1089, 5927, 10006, 10817, 7844, 2955, -1010, -2279, -1180, 522, 1234, 662, -332, -766, -406, 223, 493, 254, -151, -317, -157, 100, 198, 94, -63, -118, -53, 37, 65, 27, -20, -33, -13, 10, 14, 5, -4, -4, -1},
+    {0, -3, -5, 1, 11, 14, -2, -27, -30, 6, 56, 58, -13, -102, -102, 27, 175, 166, -49, -284, -260, 85, 447, 397, -146, -699, -607, 250, 1127, 976, -461, -2041, -1871, 1116, 5958, 10023, 10807, 7817, 2925, -1028, -2279, -1169, 531, 1234, 656, -337, -766, -402, 226, 493, 252, -153, -317, -155, 101, 198, 93, -64, -118, -52, 38, 65, 27, -20, -33, -13, 10, 14, 5, -4, -4, -1},
+    {0, -3, -5, 1, 11, 14, -3, -27, -30, 6, 56, 58, -14, -103, -101, 28, 175, 165, -50, -285, -259, 88, 448, 395, -150, -701, -604, 257, 1130, 970, -473, -2048, -1861, 1143, 5989, 10040, 10806, 7789, 2894, -1045, -2278, -1159, 539, 1234, 650, -342, -766, -398, 230, 493, 249, -155, -317, -154, 102, 198, 92, -65, -118, -52, 38, 65, 27, -21, -33, -12, 10, 14, 5, -4, -4, -1},
+    {0, -3, -5, 1, 11, 14, -3, -27, -30, 7, 56, 58, -15, -103, -101, 29, 176, 165, -52, -286, -257, 91, 450, 392, -154, -703, -600, 263, 1134, 965, -484, -2054, -1851, 1169, 6020, 10056, 10791, 7762, 2864, -1061, -2276, -1148, 548, 1233, 643, -347, -765, -395, 233, 493, 247, -157, -316, -152, 103, 198, 91, -65, -118, -51, 39, 65, 26, -21, -33, -12, 10, 14, 5, -4, -4, -1},
+    {0, -3, -5, 1, 11, 14, -3, -28, -30, 7, 56, 58, -15, -103, -100, 30, 176, 164, -54, -286, -256, 93, 451, 390, -158, -705, -597, 270, 1137, 959, -495, -2060, -1841, 1196, 6051, 10073, 10784, 7734, 2834, -1078, -2275, -1137, 556, 1233, 637, -352, -765, -391, 236, 493, 244, -159, -316, -151, 105, 197, 90, -66, -117, -50, 39, 65, 26, -21, -33, -12, 10, 14, 5, -4, -4, -1},
+    {0, -3, -5, 1, 11, 14, -3, -28, -30, 7, 56, 57, -16, -104, -100, 31, 177, 163, -56, -287, -255, 96, 452, 388, -162, -707, -593, 277, 1140, 954, -506, -2066, -1831, 1223, 6082, 10090, 10777, 7706, 2803, -1095, -2274, -1126, 565, 1233, 631, -357, -765, -387, 239, 493, 242, -161, -316, -149, 106, 197, 89, -67, -117, -50, 39, 65, 26, -21, -33, -12, 10, 14, 5, -4, -4, -1},
+    {0, -3, -5, 1, 12, 14, -3, -28, -30, 8, 57, 57, -16, -104, -100, 32, 178, 162, -57, -288, -253, 99, 454, 386, -166, -709, -590, 283, 1143, 948, -518, -2072, -1821, 1250, 6113, 10106, 10766, 7678, 2773, -1111, -2273, -1115, 573, 1233, 625, -362, -765, -383, 243, 493, 239, -163, -316, -147, 107, 197, 88, -68, -117, -49, 40, 65, 25, -22, -33, -12, 10, 14, 4, -4, -4, -1},
+    {0, -3, -5, 1, 12, 14, -3, -28, -30, 8, 57, 57, -17, -104, -99, 33, 178, 161, -59, -289, -252, 102, 455, 384, -171, -711, -586, 290, 1146, 942, -529, -2078, -1810, 1277, 6144, 10122, 10760, 7650, 2743, -1128, -2271, -1104, 582, 1232, 619, -368, -765, -379, 246, 492, 237, -165, -316, -146, 108, 197, 86, -68, -117, -49, 40, 65, 25, -22, -32, -12, 10, 14, 4, -4, -4, -1},
+    {0, -3, -5, 1, 12, 13, -3, -28, -30, 8, 57, 57, -18, -105, -99, 34, 179, 161, -61, -290, -251, 104, 456, 382, -175, -713, -583, 296, 1149, 937, -540, -2084, -1800, 1304, 6174, 10138, 10753, 7622, 2713, -1144, -2270, -1093, 590, 1232, 613, -373, -765, -375, 249, 492, 234, -167, -316, -144, 110, 197, 85, -69, -117, -48, 41, 65, 25, -22, -32, -11, 10, 14, 4, -4, -4, -1},
+    {0, -3, -5, 1, 12, 13, -4, -28, -30, 9, 57, 56, -18, -105, -98, 35, 179, 160, -62, -291, -249, 107, 457, 379, -179, -714, -579, 303, 1151, 931, -552, -2089, -1789, 1331, 6205, 10154, 10743, 7594, 2683, -1160, -2268, -1082, 598, 1231, 606, -378, -764, -371, 252, 492, 231, -169, -315, -142, 111, 197, 84, -70, -117, -47, 41, 65, 24, -22, -32, -11, 10, 14, 4, -4, -4, -1},
+    {0, -4, -5, 1, 12, 13, -4, -28, -29, 9, 58, 56, -19, -105, -98, 36, 180, 159, -64, -291, -248, 110, 458, 377, -183, -716, -576, 309, 1154, 925, -563, -2095, -1779, 1359, 6236, 10170, 10733, 7566, 2653, -1176, -2266, -1071, 606, 1231, 600, -382, -764, -367, 255, 492, 229, -171, -315, -141, 112, 196, 83, -70, -117, -47, 41, 65, 24, -22, -32, -11, 10, 14, 4, -4, -4, -1},
+    {0, -4, -5, 1, 12, 13, -4, -28, -29, 9, 58, 56, -20, -106, -97, 37, 180, 158, -66, -292, -246, 112, 460, 375, -187, -718, -572, 316, 1157, 919, -574, -2101, -1768, 1386, 6267, 10186, 10724, 7538, 2623, -1192, -2264, -1060, 614, 1230, 594, -387, -764, -363, 258, 491, 226, -173, -315, -139, 113, 196, 82, -71, -116, -46, 42, 64, 24, -23, -32, -11, 11, 14, 4, -4, -4, -1},
+    {0, -4, -5, 1, 12, 13, -4, -28, -29, 10, 58, 56, -20, -106, -97, 38, 181, 157, -68, -293, -245, 115, 461, 373, -191, -720, -568, 322, 1160, 913, -586, -2106, -1757, 1413, 6297, 10201, 10712, 7510, 2593, -1208, -2262, -1049, 623, 1230, 588, -392, -763, -359, 261, 491, 224, -175, -315, -137, 115, 196, 81, -72, -116, -45, 42, 64, 23, -23, -32, -11, 11, 14, 4, -4, -4, -1},
+    {0, -4, -5, 1, 12, 13, -4, -29, -29, 10, 58, 55, -21, -107, -96, 39, 181, 156, -69, -294, -243, 118, 462, 370, -196, -721, -565, 329, 1162, 907, -597, -2112, -1746, 1441, 6328, 10217, 10707, 7481, 2563, -1224, -2260, -1038, 631, 1229, 581, -397, -763, -355, 265, 491, 221, -177, -314, -136, 116, 196, 80, -73, -116, -45, 43, 64, 23, -23, -32, -11, 11, 14, 4, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -4, -29, -29, 10, 58, 55, -21, -107, -96, 40, 182, 155, -71, -295, -242, 120, 463, 368, -200, -723, -561, 336, 1165, 901, -609, -2117, -1735, 1468, 6358, 10232, 10694, 7453, 2533, -1239, -2258, -1026, 639, 1228, 575, -402, -762, -351, 268, 490, 219, -179, -314, -134, 117, 196, 79, -73, -116, -44, 43, 64, 23, -23, -32, -10, 11, 14, 4, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -5, -29, -29, 11, 59, 55, -22, -107, -95, 41, 182, 155, -73, -295, -241, 123, 464, 366, -204, -724, -557, 342, 1167, 895, -620, -2122, -1724, 1496, 6389, 10247, 10686, 7424, 2503, -1255, -2256, -1015, 647, 1227, 569, -407, -762, -347, 271, 490, 216, -181, -314, -132, 118, 195, 78, -74, -116, -44, 43, 64, 22, -23, -32, -10, 11, 14, 4, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -5, -29, -29, 11, 59, 55, -23, -107, -95, 42, 183, 154, -74, -296, -239, 126, 465, 363, -208, -726, -554, 349, 1170, 888, -631, -2128, -1712, 1524, 6419, 10262, 10676, 7396, 2473, -1270, -2253, -1004, 655, 1226, 562, -412, -761, -343, 274, 490, 213, -183, -314, -131, 119, 195, 77, -75, -116, -43, 44, 64, 22, -23, -32, -10, 11, 14, 4, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -5, -29, -29, 11, 59, 54, -23, -108, -94, 43, 183, 153, -76, -297, -238, 128, 466, 361, -212, -728, -550, 355, 1173, 882, -643, -2133, -1701, 1551, 6450, 10277, 10667, 7367, 2444, -1285, -2251, -993, 662, 1226, 556, -416, -761, -339, 277, 489, 211, -185, -313, -129, 121, 195, 76, -75, -116, -42, 44, 64, 22, -24, -32, -10, 11, 14, 4, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -5, -29, -28, 12, 59, 54, -24, -108, -94, 44, 184, 152, -78, -298, -236, 131, 467, 358, -216, -729, -546, 362, 1175, 876, -654, -2138, -1689, 1579, 6480, 10292, 10656, 7338, 2414, -1301, -2249, -982, 670, 1225, 550, -421, -760, -335, 280, 489, 208, -187, -313, -127, 122, 195, 75, -76, -115, -42, 45, 64, 21, -24, -32, -10, 11, 13, 4, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -5, -29, -28, 12, 59, 54, -24, -108, -93, 46, 184, 151, -80, -298, -234, 134, 468, 356, -221, -731, -542, 368, 1177, 870, -665, -2143, -1677, 1607, 6510, 10306, 10646, 7309, 2384, -1316, -2246, -971, 678, 1224, 543, -426, -759, -331, 283, 488, 206, -188, -313, -126, 123, 194, 74, -77, -115, -41, 45, 64, 21, -24, -32, -10, 11, 13, 4, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -5, -29, -28, 12, 60, 53, -25, -109, -92, 47, 185, 150, -81, -299, -233, 136, 469, 353, -225, -732, -538, 375, 1180, 863, -677, -2148, -1665, 1635, 6541, 10321, 10633, 7281, 2355, -1331, -2243, -959, 686, 1222, 537, -431, -759, -327, 286, 488, 203, -190, -312, -124, 124, 194, 73, -77, -115, -41, 45, 63, 21, -24, -32, -9, 11, 13, 4, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -6, -29, -28, 13, 60, 53, -26, -109, -92, 48, 185, 149, -83, -300, -231, 139, 470, 351, -229, -734, -534, 382, 1182, 857, -688, -2152, -1653, 1663, 6571, 10335, 10622, 7252, 2325, -1345, -2240, -948, 694, 1221, 531, -435, -758, -323, 289, 487, 200, -192, -312, -122, 125, 194, 72, -78, -115, -40, 46, 63, 20, -24, -32, -9, 11, 13, 3, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -6, -30, -28, 13, 60, 53, -26, -109, -91, 49, 186, 148, -85, -300, -230, 142, 471, 348, -233, -735, -530, 388, 1184, 850, -699, -2157, -1641, 1691, 6601, 10349, 10614, 7223, 2296, -1360, -2238, -937, 701, 1220, 524, -440, -757, -319, 291, 487, 198, -194, -311, -121, 126, 194, 71, -79, -115, -39, 46, 63, 20, -25, -31, -9, 11, 13, 3, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -6, -30, -28, 13, 60, 53, -27, -110, -91, 50, 186, 147, -87, -301, -228, 145, 472, 346, -237, -736, -526, 395, 1186, 844, -711, -2162, -1629, 1719, 6631, 10363, 10605, 7194, 2267, -1375, -2235, -926, 709, 1219, 518, -444, -757, -315, 294, 486, 195, -196, -311, -119, 127, 193, 70, -79, -114, -39, 46, 63, 20, -25, -31, -9, 11, 13, 3, -4, -4, -1},
+    {0, -4, -5, 2, 12, 13, -6, -30, -28, 14, 60, 52, -28, -110, -90, 51, 187, 146, -88, -302, -227, 147, 473, 343, -241, -738, -522, 401, 1189, 837, -722, -2166, -1617, 1748, 6661, 10377, 10594, 7165, 2237, -1389, -2232, -915, 716, 1218, 511, -449, -756, -311, 297, 486, 192, -198, -311, -117, 128, 193, 69, -80, -114, -38, 47, 63, 19, -25, -31, -9, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -5, 2, 13, 13, -6, -30, -27, 14, 60, 52, -28, -110, -90, 52, 187, 145, -90, -302, -225, 150, 474, 341, -245, -739, -518, 408, 1191, 830, -734, -2171, -1604, 1776, 6691, 10391, 10577, 7135, 2208, -1403, -2228, -903, 724, 1216, 505, -454, -755, -307, 300, 485, 190, -199, -310, -116, 130, 193, 68, -81, -114, -37, 47, 63, 19, -25, -31, -9, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -5, 2, 13, 13, -6, -30, -27, 14, 61, 52, -29, -110, -89, 53, 187, 144, -92, -303, -223, 153, 475, 338, -250, -740, -514, 414, 1193, 824, -745, -2175, -1592, 1804, 6721, 10404, 10568, 7106, 2179, -1418, -2225, -892, 731, 1215, 498, -458, -754, -303, 303, 484, 187, -201, -310, -114, 131, 192, 67, -81, -114, -37, 47, 63, 19, -25, -31, -8, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 2, 13, 12, -6, -30, -27, 15, 61, 51, -29, -111, -89, 54, 188, 143, -93, -303, -222, 155, 476, 336, -254, -741, -510, 421, 1195, 817, -756, -2180, -1579, 1833, 6751, 10418, 10551, 7077, 2150, -1432, -2222, -881, 739, 1214, 492, -462, -753, -299, 306, 484, 185, -203, -309, -112, 132, 192, 66, -82, -114, -36, 48, 62, 18, -25, -31, -8, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 2, 13, 12, -7, -30, -27, 15, 61, 51, -30, -111, -88, 55, 188, 142, -95, -304, -220, 158, 477, 333, -258, -743, -506, 427, 1197, 810, -768, -2184, -1566, 1861, 6781, 10431, 10546, 7048, 2120, -1446, -2219, -869, 746, 1212, 486, -467, -752, -295, 309, 483, 182, -205, -309, -110, 133, 192, 65, -83, -113, -36, 48, 62, 18, -26, -31, -8, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 2, 13, 12, -7, -30, -27, 15, 61, 51, -31, -111, -87, 56, 189, 141, -97, -305, -219, 161, 477, 330, -262, -744, -502, 434, 1199, 803, -779, -2188, -1553, 1890, 6811, 10444, 10536, 7018, 2091, -1460, -2215, -858, 753, 1211, 479, -471, -751, -291, 311, 483, 179, -207, -308, -109, 134, 191, 63, -83, -113, -35, 48, 62, 18, -26, -31, -8, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -7, -30, -27, 16, 61, 50, -31, -112, -87, 57, 189, 140, -98, -305, -217, 163, 478, 328, -266, -745, -497, 440, 1201, 796, -790, -2192, -1540, 1918, 6841, 10457, 10519, 6989, 2062, -1473, -2211, -847, 761, 1209, 473, -476, -750, -287, 314, 482, 177, -208, -308, -107, 135, 191, 62, -84, -113, -34, 49, 62, 17, -26, -31, -8, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -7, -30, -27, 16, 61, 50, -32, -112, -86, 58, 190, 139, -100, -306, -215, 166, 479, 325, -270, -746, -493, 447, 1202, 789, -802, -2196, -1527, 1947, 6870, 10470, 10509, 6959, 2033, -1487, -2208, -836, 768, 1207, 466, -480, -749, -282, 317, 481, 174, -210, -307, -105, 136, 191, 61, -84, -113, -34, 49, 62, 17, -26, -31, -8, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -7, -30, -26, 16, 62, 50, -32, -112, -86, 59, 190, 138, -102, -306, -213, 169, 480, 322, -274, -747, -489, 453, 1204, 782, -813, -2200, -1514, 1976, 6900, 10483, 10490, 6930, 2005, -1500, -2204, -824, 775, 1206, 460, -484, -748, -278, 320, 480, 171, -212, -307, -104, 137, 190, 60, -85, -112, -33, 49, 62, 17, -26, -31, -7, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -7, -31, -26, 17, 62, 49, -33, -112, -85, 60, 190, 137, -104, -307, -212, 171, 480, 320, -278, -748, -484, 460, 1206, 775, -824, -2204, -1500, 2005, 6930, 10490, 10483, 6900, 1976, -1514, -2200, -813, 782, 1204, 453, -489, -747, -274, 322, 480, 169, -213, -306, -102, 138, 190, 59, -86, -112, -32, 50, 62, 16, -26, -30, -7, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -8, -31, -26, 17, 62, 49, -34, -113, -84, 61, 191, 136, -105, -307, -210, 174, 481, 317, -282, -749, -480, 466, 1207, 768, -836, -2208, -1487, 2033, 6959, 10509, 10470, 6870, 1947, -1527, -2196, -802, 789, 1202, 447, -493, -746, -270, 325, 479, 166, -215, -306, -100, 139, 190, 58, -86, -112, -32, 50, 61, 16, -27, -30, -7, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -8, -31, -26, 17, 62, 49, -34, -113, -84, 62, 191, 135, -107, -308, -208, 177, 482, 314, -287, -750, -476, 473, 1209, 761, -847, -2211, -1473, 2062, 6989, 10519, 10457, 6841, 1918, -1540, -2192, -790, 796, 1201, 440, -497, -745, -266, 328, 478, 163, -217, -305, -98, 140, 189, 57, -87, -112, -31, 50, 61, 16, -27, -30, -7, 12, 13, 3, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -8, -31, -26, 18, 62, 48, -35, -113, -83, 63, 191, 134, -109, -308, -207, 179, 483, 311, -291, -751, -471, 479, 1211, 753, -858, -2215, -1460, 2091, 7018, 10536, 10444, 6811, 1890, -1553, -2188, -779, 803, 1199, 434, -502, -744, -262, 330, 477, 161, -219, -305, -97, 141, 189, 56, -87, -111, -31, 51, 61, 15, -27, -30, -7, 12, 13, 2, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -8, -31, -26, 18, 62, 48, -36, -113, -83, 65, 192, 133, -110, -309, -205, 182, 483, 309, -295, -752, -467, 486, 1212, 746, -869, -2219, -1446, 2120, 7048, 10546, 10431, 6781, 1861, -1566, -2184, -768, 810, 1197, 427, -506, -743, -258, 333, 477, 158, -220, -304, -95, 142, 188, 55, -88, -111, -30, 51, 61, 15, -27, -30, -7, 12, 13, 2, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -8, -31, -25, 18, 62, 48, -36, -114, -82, 66, 192, 132, -112, -309, -203, 185, 484, 306, -299, -753, -462, 492, 1214, 739, -881, -2222, -1432, 2150, 7077, 10551, 10418, 6751, 1833, -1579, -2180, -756, 817, 1195, 421, -510, -741, -254, 336, 476, 155, -222, -303, -93, 143, 188, 54, -89, -111, -29, 51, 61, 15, -27, -30, -6, 12, 13, 2, -4, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -8, -31, -25, 19, 63, 47, -37, -114, -81, 67, 192, 131, -114, -310, -201, 187, 484, 303, -303, -754, -458, 498, 1215, 731, -892, -2225, -1418, 2179, 7106, 10568, 10404, 6721, 1804, -1592, -2175, -745, 824, 1193, 414, -514, -740, -250, 338, 475, 153, -223, -303, -92, 144, 187, 53, -89, -110, -29, 52, 61, 14, -27, -30, -6, 13, 13, 2, -5, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -9, -31, -25, 19, 63, 47, -37, -114, -81, 68, 193, 130, -116, -310, -199, 190, 485, 300, -307, -755, -454, 505, 1216, 724, -903, -2228, -1403, 2208, 7135, 10577, 10391, 6691, 1776, -1604, -2171, -734, 830, 1191, 408, -518, -739, -245, 341, 474, 150, -225, -302, -90, 145, 187, 52, -90, -110, -28, 52, 60, 14, -27, -30, -6, 13, 13, 2, -5, -4, -1},
+    {-1, -4, -4, 3, 13, 12, -9, -31, -25, 19, 63, 47, -38, -114, -80, 69, 193, 128, -117, -311, -198, 192, 486, 297, -311, -756, -449, 511, 1218, 716, -915, -2232, -1389, 2237, 7165, 10594, 10377, 6661, 1748, -1617, -2166, -722, 837, 1189, 401, -522, -738, -241, 343, 473, 147, -227, -302, -88, 146, 187, 51, -90, -110, -28, 52, 60, 14, -28, -30, -6, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 3, 13, 11, -9, -31, -25, 20, 63, 46, -39, -114, -79, 70, 193, 127, -119, -311, -196, 195, 486, 294, -315, -757, -444, 518, 1219, 709, -926, -2235, -1375, 2267, 7194, 10605, 10363, 6631, 1719, -1629, -2162, -711, 844, 1186, 395, -526, -736, -237, 346, 472, 145, -228, -301, -87, 147, 186, 50, -91, -110, -27, 53, 60, 13, -28, -30, -6, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 3, 13, 11, -9, -31, -25, 20, 63, 46, -39, -115, -79, 71, 194, 126, -121, -311, -194, 198, 487, 291, -319, -757, -440, 524, 1220, 701, -937, -2238, -1360, 2296, 7223, 10614, 10349, 6601, 1691, -1641, -2157, -699, 850, 1184, 388, -530, -735, -233, 348, 471, 142, -230, -300, -85, 148, 186, 49, -91, -109, -26, 53, 60, 13, -28, -30, -6, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 3, 13, 11, -9, -32, -24, 20, 63, 46, -40, -115, -78, 72, 194, 125, -122, -312, -192, 200, 487, 289, -323, -758, -435, 531, 1221, 694, -948, -2240, -1345, 2325, 7252, 10622, 10335, 6571, 1663, -1653, -2152, -688, 857, 1182, 382, -534, -734, -229, 351, 470, 139, -231, -300, -83, 149, 185, 48, -92, -109, -26, 53, 60, 13, -28, -29, -6, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 4, 13, 11, -9, -32, -24, 21, 63, 45, -41, -115, -77, 73, 194, 124, -124, -312, -190, 203, 488, 286, -327, -759, -431, 537, 1222, 686, -959, -2243, -1331, 2355, 7281, 10633, 10321, 6541, 1635, -1665, -2148, -677, 863, 1180, 375, -538, -732, -225, 353, 469, 136, -233, -299, -81, 150, 185, 47, -92, -109, -25, 53, 60, 12, -28, -29, -5, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 4, 13, 11, -10, -32, -24, 21, 64, 45, -41, -115, -77, 74, 194, 123, -126, -313, -188, 206, 488, 283, -331, -759, -426, 543, 1224, 678, -971, -2246, -1316, 2384, 7309, 10646, 10306, 6510, 1607, -1677, -2143, -665, 870, 1177, 368, -542, -731, -221, 356, 468, 134, -234, -298, -80, 151, 184, 46, -93, -108, -24, 54, 59, 12, -28, -29, -5, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 4, 13, 11, -10, -32, -24, 21, 64, 45, -42, -115, -76, 75, 195, 122, -127, -313, -187, 208, 489, 280, -335, -760, -421, 550, 1225, 670, -982, -2249, -1301, 2414, 7338, 10656, 10292, 6480, 1579, -1689, -2138, -654, 876, 1175, 362, -546, -729, -216, 358, 467, 131, -236, -298, -78, 152, 184, 44, -94, -108, -24, 54, 59, 12, -28, -29, -5, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 11, -10, -32, -24, 22, 64, 44, -42, -116, -75, 76, 195, 121, -129, -313, -185, 211, 489, 277, -339, -761, -416, 556, 1226, 662, -993, -2251, -1285, 2444, 7367, 10667, 10277, 6450, 1551, -1701, -2133, -643, 882, 1173, 355, -550, -728, -212, 361, 466, 128, -238, -297, -76, 153, 183, 43, -94, -108, -23, 54, 59, 11, -29, -29, -5, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 11, -10, -32, -23, 22, 64, 44, -43, -116, -75, 77, 195, 119, -131, -314, -183, 213, 490, 274, -343, -761, -412, 562, 1226, 655, -1004, -2253, -1270, 2473, 7396, 10676, 10262, 6419, 1524, -1712, -2128, -631, 888, 1170, 349, -554, -726, -208, 363, 465, 126, -239, -296, -74, 154, 183, 42, -95, -107, -23, 55, 59, 11, -29, -29, -5, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 11, -10, -32, -23, 22, 64, 43, -44, -116, -74, 78, 195, 118, -132, -314, -181, 216, 490, 271, -347, -762, -407, 569, 1227, 647, -1015, -2256, -1255, 2503, 7424, 10686, 10247, 6389, 1496, -1724, -2122, -620, 895, 1167, 342, -557, -724, -204, 366, 464, 123, -241, -295, -73, 155, 182, 41, -95, -107, -22, 55, 59, 11, -29, -29, -5, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 11, -10, -32, -23, 23, 64, 43, -44, -116, -73, 79, 196, 117, -134, -314, -179, 219, 490, 268, -351, -762, -402, 575, 1228, 639, -1026, -2258, -1239, 2533, 7453, 10694, 10232, 6358, 1468, -1735, -2117, -609, 901, 1165, 336, -561, -723, -200, 368, 463, 120, -242, -295, -71, 155, 182, 40, -96, -107, -21, 55, 58, 10, -29, -29, -4, 13, 12, 2, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 11, -11, -32, -23, 23, 64, 43, -45, -116, -73, 80, 196, 116, -136, -314, -177, 221, 491, 265, -355, -763, -397, 581, 1229, 631, -1038, -2260, -1224, 2563, 7481, 10707, 10217, 6328, 1441, -1746, -2112, -597, 907, 1162, 329, -565, -721, -196, 370, 462, 118, -243, -294, -69, 156, 181, 39, -96, -107, -21, 55, 58, 10, -29, -29, -4, 13, 12, 1, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 11, -11, -32, -23, 23, 64, 42, -45, -116, -72, 81, 196, 115, -137, -315, -175, 224, 491, 261, -359, -763, -392, 588, 1230, 623, -1049, -2262, -1208, 2593, 7510, 10712, 10201, 6297, 1413, -1757, -2106, -586, 913, 1160, 322, -568, -720, -191, 373, 461, 115, -245, -293, -68, 157, 181, 38, -97, -106, -20, 56, 58, 10, -29, -28, -4, 13, 12, 1, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 11, -11, -32, -23, 24, 64, 42, -46, -116, -71, 82, 196, 113, -139, -315, -173, 226, 491, 258, -363, -764, -387, 594, 1230, 614, -1060, -2264, -1192, 2623, 7538, 10724, 10186, 6267, 1386, -1768, -2101, -574, 919, 1157, 316, -572, -718, -187, 375, 460, 112, -246, -292, -66, 158, 180, 37, -97, -106, -20, 56, 58, 9, -29, -28, -4, 13, 12, 1, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 10, -11, -32, -22, 24, 65, 41, -47, -117, -70, 83, 196, 112, -141, -315, -171, 229, 492, 255, -367, -764, -382, 600, 1231, 606, -1071, -2266, -1176, 2653, 7566, 10733, 10170, 6236, 1359, -1779, -2095, -563, 925, 1154, 309, -576, -716, -183, 377, 458, 110, -248, -291, -64, 159, 180, 36, -98, -105, -19, 56, 58, 9, -29, -28, -4, 13, 12, 1, -5, -4, 0},
+    {-1, -4, -4, 4, 14, 10, -11, -32, -22, 24, 65, 41, -47, -117, -70, 84, 197, 111, -142, -315, -169, 231, 492, 252, -371, -764, -378, 606, 1231, 598, -1082, -2268, -1160, 2683, 7594, 10743, 10154, 6205, 1331, -1789, -2089, -552, 931, 1151, 303, -579, -714, -179, 379, 457, 107, -249, -291, -62, 160, 179, 35, -98, -105, -18, 56, 57, 9, -30, -28, -4, 13, 12, 1, -5, -3, 0},
+    {-1, -4, -4, 4, 14, 10, -11, -32, -22, 25, 65, 41, -48, -117, -69, 85, 197, 110, -144, -316, -167, 234, 492, 249, -375, -765, -373, 613, 1232, 590, -1093, -2270, -1144, 2713, 7622, 10753, 10138, 6174, 1304, -1800, -2084, -540, 937, 1149, 296, -583, -713, -175, 382, 456, 104, -251, -290, -61, 161, 179, 34, -99, -105, -18, 57, 57, 8, -30, -28, -3, 13, 12, 1, -5, -3, 0},
+    {-1, -4, -4, 4, 14, 10, -12, -32, -22, 25, 65, 40, -49, -117, -68, 86, 197, 108, -146, -316, -165, 237, 492, 246, -379, -765, -368, 619, 1232, 582, -1104, -2271, -1128, 2743, 7650, 10760, 10122, 6144, 1277, -1810, -2078, -529, 942, 1146, 290, -586, -711, -171, 384, 455, 102, -252, -289, -59, 161, 178, 33, -99, -104, -17, 57, 57, 8, -30, -28, -3, 14, 12, 1, -5, -3, 0},
+    {-1, -4, -4, 4, 14, 10, -12, -33, -22, 25, 65, 40, -49, -117, -68, 88, 197, 107, -147, -316, -163, 239, 493, 243, -383, -765, -362, 625, 1233, 573, -1115, -2273, -1111, 2773, 7678, 10766, 10106, 6113, 1250, -1821, -2072, -518, 948, 1143, 283, -590, -709, -166, 386, 454, 99, -253, -288, -57, 162, 178, 32, -100, -104, -16, 57, 57, 8, -30, -28, -3, 14, 12, 1, -5, -3, 0},
+    {-1, -4, -4, 5, 14, 10, -12, -33, -21, 26, 65, 39, -50, -117, -67, 89, 197, 106, -149, -316, -161, 242, 493, 239, -387, -765, -357, 631, 1233, 565, -1126, -2274, -1095, 2803, 7706, 10777, 10090, 6082, 1223, -1831, -2066, -506, 954, 1140, 277, -593, -707, -162, 388, 452, 96, -255, -287, -56, 163, 177, 31, -100, -104, -16, 57, 56, 7, -30, -28, -3, 14, 11, 1, -5, -3, 0},
+    {-1, -4, -4, 5, 14, 10, -12, -33, -21, 26, 65, 39, -50, -117, -66, 90, 197, 105, -151, -316, -159, 244, 493, 236, -391, -765, -352, 637, 1233, 556, -1137, -2275, -1078, 2834, 7734, 10784, 10073, 6051, 1196, -1841, -2060, -495, 959, 1137, 270, -597, -705, -158, 390, 451, 93, -256, -286, -54, 164, 176, 30, -100, -103, -15, 58, 56, 7, -30, -28, -3, 14, 11, 1, -5, -3, 0},
+    {-1, -4, -4, 5, 14, 10, -12, -33, -21, 26, 65, 39, -51, -118, -65, 91, 198, 103, -152, -316, -157, 247, 493, 233, -395, -765, -347, 643, 1233, 548, -1148, -2276, -1061, 2864, 7762, 10791, 10056, 6020, 1169, -1851, -2054, -484, 965, 1134, 263, -600, -703, -154, 392, 450, 91, -257, -286, -52, 165, 176, 29, -101, -103, -15, 58, 56, 7, -30, -27, -3, 14, 11, 1, -5, -3, 0},
+    {-1, -4, -4, 5, 14, 10, -12, -33, -21, 27, 65, 38, -52, -118, -65, 92, 198, 102, -154, -317, -155, 249, 493, 230, -398, -766, -342, 650, 1234, 539, -1159, -2278, -1045, 2894, 7789, 10806, 10040, 5989, 1143, -1861, -2048, -473, 970, 1130, 257, -604, -701, -150, 395, 448, 88, -259, -285, -50, 165, 175, 28, -101, -103, -14, 58, 56, 6, -30, -27, -3, 14, 11, 1, -5, -3, 0},
+    {-1, -4, -4, 5, 14, 10, -13, -33, -20, 27, 65, 38, -52, -118, -64, 93, 198, 101, -155, -317, -153, 252, 493, 226, -402, -766, -337, 656, 1234, 531, -1169, -2279, -1028, 2925, 7817, 10807, 10023, 5958, 1116, -1871, -2041, -461, 976, 1127, 250, -607, -699, -146, 397, 447, 85, -260, -284, -49, 166, 175, 27, -102, -102, -13, 58, 56, 6, -30, -27, -2, 14, 11, 1, -5, -3, 0},
+    {-1, -4, -4, 5, 14, 10, -13, -33, -20, 27, 65, 37, -53, -118, -63, 94, 198, 100, -157, -317, -151, 254, 493, 223, -406, -766, -332, 662, 1234, 522, -1180, -2279, -1010, 2955, 7844, 10817, 10006, 5927, 1089, -1880, -2035, -450, 981, 1124, 244, -610, -697, -142, 399, 446, 83, -261, -283, -47, 167, 174, 25, -102, -102, -13, 59, 55, 6, -31, -27, -2, 14, 11, 1, -5, -3, 0},
+    {-1, -5, -4, 5, 14, 10, -13, -33, -20, 28, 65, 37, -53, -118, -62, 95, 198, 98, -159, -317, -149, 257, 493, 220, -410, -766, -327, 668, 1234, 513, -1191, -2280, -993, 2986, 7872, 10823, 9988, 5896, 1063, -1890, -2028, -439, 987, 1121, 237, -613, -695, -137, 401, 444, 80, -262, -282, -45, 168, 174, 24, -103, -101, -12, 59, 55, 5, -31, -27, -2, 14, 11, 1, -5, -3, 0},
+    {-1, -5, -4, 5, 14, 9, -13, -33, -20, 28, 66, 37, -54, -118, -61, 96, 198, 97, -160, -317, -147, 259, 493, 217, -414, -766, -321, 674, 1234, 505, -1202, -2281, -976, 3016, 7899, 10831, 9971, 5865, 1037, -1899, -2022, -427, 992, 1118, 231, -617, -693, -133, 403, 443, 77, -264, -281, -44, 169, 173, 23, -103, -101, -12, 59, 55, 5, -31, -27, -2, 14, 11, 1, -5, -3, 0},
+    {-1, -5, -4, 5, 14, 9, -13, -33, -20, 28, 66, 36, -55, -118, -61, 97, 198, 96, -162, -317, -145, 262, 493, 213, -418, -766, -316, 680, 1234, 496, -1213, -2282, -959, 3047, 7926, 10843, 9954, 5834, 1010, -1909, -2015, -416, 997, 1114, 224, -620, -691, -129, 405, 442, 75, -265, -280, -42, 169, 172, 22, -103, -101, -11, 59, 55, 5, -31, -27, -2, 14, 11, 1, -5, -3, 0},
+    {-1, -5, -3, 5, 14, 9, -13, -33, -19, 29, 66, 36, -55, -118, -60, 98, 198, 94, -164, -317, -142, 264, 493, 210, -422, -765, -311, 686, 1233, 487, -1224, -2282, -941, 3077, 7954, 10848, 9936, 5803, 984, -1918, -2009, -405, 1002, 1111, 217, -623, -689, -125, 407, 440, 72, -266, -279, -40, 170, 172, 21, -104, -100, -10, 59, 54, 5, -31, -27, -2, 14, 11, 0, -5, -3, 0},
+    {-1, -5, -3, 5, 14, 9, -14, -33, -19, 29, 66, 35, -56, -118, -59, 99, 198, 93, -165, -317, -140, 267, 493, 207, -425, -765, -305, 692, 1233, 478, -1234, -2283, -923, 3108, 7981, 10851, 9918, 5772, 958, -1927, -2002, -394, 1007, 1108, 211, -626, -687, -121, 409, 439, 69, -267, -278, -39, 171, 171, 20, -104, -100, -10, 60, 54, 4, -31, -26, -1, 14, 11, 0, -5, -3, 0},
+    {-1, -5, -3, 5, 14, 9, -14, -33, -19, 29, 66, 35, -56, -118, -58, 100, 198, 92, -167, -317, -138, 269, 493, 203, -429, -765, -300, 698, 1233, 470, -1245, -2283, -906, 3139, 8008, 10859, 9900, 5741, 932, -1936, -1995, -382, 1012, 1104, 204, -629, -685, -117, 411, 437, 67, -269, -277, -37, 171, 170, 19, -105, -99, -9, 60, 54, 4, -31, -26, -1, 14, 11, 0, -5, -3, 0},
+    {-1, -5, -3, 5, 14, 9, -14, -33, -19, 30, 66, 34, -57, -118, -58, 101, 198, 90, -168, -317, -136, 272, 493, 200, -433, -765, -295, 704, 1233, 461, -1256, -2283, -888, 3169, 8035, 10865, 9882, 5710, 906, -1945, -1989, -371, 1017, 1101, 198, -632, -683, -112, 413, 436, 64, -270, -276, -35, 172, 170, 18, -105, -99, -9, 60, 54, 4, -31, -26, -1, 14, 11, 0, -5, -3, 0},
+    {-1, -5, -3, 5, 14, 9, -14, -33, -19, 30, 66, 34, -58, -118, -57, 102, 198, 89, -170, -317, -134, 274, 493, 196, -437, -765, -289, 710, 1232, 452, -1266, -2283, -870, 3200, 8062, 10874, 9864, 5679, 880, -1953, -1982, -360, 1022, 1097, 191, -635, -680, -108, 414, 434, 61, -271, -275, -33, 173, 169, 17, -105, -99, -8, 60, 53, 3, -31, -26, -1, 14, 11, 0, -5, -3, 0},
+    {-1, -5, -3, 6, 14, 9, -14, -33, -18, 30, 66, 34, -58, -118, -56, 103, 198, 88, -172, -317, -132, 277, 493, 193, -440, -764, -284, 716, 1232, 443, -1277, -2283, -852, 3231, 8088, 10877, 9846, 5647, 854, -1962, -1975, -349, 1027, 1093, 185, -638, -678, -104, 416, 433, 59, -272, -274, -32, 173, 168, 16, -106, -98, -7, 60, 53, 3, -31, -26, -1, 14, 11, 0, -5, -3, 0},
+    {-1, -5, -3, 6, 14, 9, -14, -33, -18, 31, 66, 33, -59, -118, -55, 104, 199, 86, -173, -317, -129, 279, 493, 189, -444, -764, -279, 722, 1231, 434, -1288, -2283, -833, 3262, 8115, 10881, 9828, 5616, 828, -1970, -1968, -338, 1032, 1090, 178, -641, -676, -100, 418, 431, 56, -273, -273, -30, 174, 168, 15, -106, -98, -7, 61, 53, 3, -31, -26, -1, 14, 11, 0, -5, -3, 0},
+    {-1, -5, -3, 6, 14, 9, -15, -33, -18, 31, 66, 33, -59, -119, -54, 105, 199, 85, -175, -317, -127, 282, 493, 186, -448, -764, -273, 728, 1231, 425, -1298, -2283, -815, 3292, 8142, 10888, 9809, 5585, 803, -1979, -1961, -327, 1037, 1086, 172, -644, -674, -96, 420, 430, 53, -274, -272, -28, 175, 167, 14, -107, -97, -6, 61, 53, 2, -32, -26, -1, 14, 11, 0, -5, -3, 0},
+    {-1, -5, -3, 6, 14, 8, -15, -33, -18, 31, 66, 32, -60, -119, -54, 106, 199, 84, -176, -317, -125, 284, 493, 183, -452, -763, -268, 734, 1230, 415, -1309, -2283, -797, 3323, 8168, 10899, 9790, 5554, 777, -1987, -1953, -315, 1042, 1082, 165, -647, -671, -92, 422, 428, 51, -275, -271, -27, 175, 166, 13, -107, -97, -6, 61, 53, 2, -32, -26, 0, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 14, 8, -15, -33, -17, 32, 66, 32, -61, -119, -53, 107, 199, 82, -178, -317, -123, 286, 492, 179, -455, -763, -262, 740, 1229, 406, -1319, -2282, -778, 3354, 8195, 10903, 9772, 5522, 751, -1995, -1946, -304, 1046, 1079, 159, -650, -669, -88, 424, 427, 48, -277, -270, -25, 176, 166, 12, -107, -97, -5, 61, 52, 2, -32, -25, 0, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 14, 8, -15, -33, -17, 32, 66, 31, -61, -119, -52, 108, 199, 81, -179, -317, -121, 289, 492, 176, -459, -763, -257, 745, 1229, 397, -1330, -2282, -759, 3385, 8221, 10911, 9753, 5491, 726, -2003, -1939, -293, 1051, 1075, 152, -653, -667, -84, 425, 425, 45, -278, -269, -23, 177, 165, 11, -108, -96, -4, 61, 52, 1, -32, -25, 0, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 14, 8, -15, -33, -17, 32, 66, 31, -62, -119, -51, 109, 198, 80, -181, -317, -118, 291, 492, 172, -463, -762, -251, 751, 1228, 388, -1340, -2281, -741, 3416, 8247, 10915, 9734, 5460, 701, -2011, -1932, -282, 1055, 1071, 146, -656, -664, -79, 427, 424, 43, -279, -268, -22, 177, 164, 10, -108, -96, -4, 62, 52, 1, -32, -25, 0, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 14, 8, -15, -33, -17, 33, 66, 30, -62, -119, -50, 110, 198, 78, -183, -317, -116, 294, 492, 169, -466, -762, -246, 757, 1227, 379, -1351, -2280, -722, 3447, 8273, 10919, 9714, 5428, 675, -2019, -1924, -271, 1060, 1067, 139, -658, -662, -75, 429, 422, 40, -280, -267, -20, 178, 164, 9, -108, -95, -3, 62, 52, 1, -32, -25, 0, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 14, 8, -16, -33, -16, 33, 66, 30, -63, -119, -49, 111, 198, 77, -184, -316, -114, 296, 491, 165, -470, -761, -240, 763, 1226, 369, -1361, -2280, -703, 3478, 8299, 10927, 9695, 5397, 650, -2026, -1917, -260, 1064, 1063, 133, -661, -659, -71, 431, 420, 37, -281, -266, -18, 179, 163, 8, -109, -95, -3, 62, 51, 0, -32, -25, 0, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 15, 8, -16, -33, -16, 33, 66, 29, -64, -119, -49, 112, 198, 75, -186, -316, -112, 298, 491, 161, -474, -760, -234, 769, 1225, 360, -1371, -2279, -684, 3509, 8325, 10934, 9676, 5365, 625, -2034, -1909, -249, 1069, 1059, 126, -664, -657, -67, 432, 419, 35, -282, -265, -17, 179, 162, 7, -109, -94, -2, 62, 51, 0, -32, -25, 0, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 15, 8, -16, -34, -16, 34, 66, 29, -64, -119, -48, 113, 198, 74, -187, -316, -109, 301, 491, 158, -477, -760, -229, 774, 1224, 350, -1382, -2278, -665, 3540, 8351, 10933, 9656, 5334, 600, -2041, -1902, -238, 1073, 1056, 120, -666, -654, -63, 434, 417, 32, -283, -264, -15, 180, 162, 6, -109, -94, -1, 62, 51, 0, -32, -25, 1, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 15, 8, -16, -34, -16, 34, 66, 28, -65, -119, -47, 114, 198, 72, -189, -316, -107, 303, 490, 154, -481, -759, -223, 780, 1223, 341, -1392, -2277, -645, 3571, 8377, 10946, 9636, 5302, 575, -2048, -1894, -227, 1077, 1052, 113, -669, -652, -59, 435, 415, 29, -284, -263, -13, 180, 161, 5, -110, -94, -1, 62, 50, -1, -32, -24, 1, 14, 10, 0, -5, -3, 0},
+    {-2, -5, -3, 6, 15, 8, -16, -34, -16, 34, 66, 28, -65, -119, -46, 115, 198, 71, -190, -316, -105, 305, 490, 151, -484, -758, -217, 786, 1222, 332, -1402, -2275, -626, 3603, 8403, 10940, 9617, 5271, 551, -2056, -1886, -216, 1081, 1047, 107, -672, -649, -55, 437, 414, 27, -285, -261, -12, 181, 160, 4, -110, -93, 0, 63, 50, -1, -32, -24, 1, 14, 10, -1, -5, -3, 0},
+    {-2, -5, -3, 6, 15, 7, -16, -34, -15, 35, 66, 27, -66, -119, -45, 115, 198, 70, -192, -316, -103, 308, 490, 147, -488, -758, -212, 791, 1221, 322, -1413, -2274, -606, 3634, 8428, 10949, 9597, 5240, 526, -2063, -1878, -205, 1086, 1043, 100, -674, -647, -51, 439, 412, 24, -286, -260, -10, 182, 159, 3, -110, -93, 0, 63, 50, -1, -32, -24, 1, 14, 10, -1, -5, -3, 0},
+    {-2, -5, -3, 6, 15, 7, -17, -34, -15, 35, 66, 27, -66, -119, -44, 116, 198, 68, -193, -315, -100, 310, 489, 144, -492, -757, -206, 797, 1220, 313, -1423, -2273, -587, 3665, 8454, 10952, 9577, 5208, 501, -2070, -1871, -194, 1090, 1039, 94, -677, -644, -47, 440, 410, 22, -287, -259, -8, 182, 159, 2, -111, -92, 1, 63, 50, -1, -32, -24, 1, 14, 10, -1, -5, -3, 0},
+    {-2, -5, -3, 7, 15, 7, -17, -34, -15, 35, 66, 27, -67, -119, -43, 117, 198, 67, -195, -315, -98, 312, 489, 140, -495, -756, -200, 803, 1218, 303, -1433, -2271, -567, 3696, 8479, 10956, 9556, 5177, 477, -2077, -1863, -183, 1094, 1035, 88, -679, -641, -43, 442, 409, 19, -288, -258, -7, 183, 158, 1, -111, -92, 1, 63, 49, -2, -33, -24, 1, 15, 10, -1, -5, -3, 0},
+    {-2, -5, -3, 7, 15, 7, -17, -34, -15, 36, 66, 26, -68, -119, -43, 118, 198, 65, -196, -315, -96, 315, 488, 136, -499, -755, -195, 808, 1217, 293, -1443, -2270, -547, 3727, 8505, 10964, 9536, 5145, 452, -2083, -1855, -172, 1098, 1031, 81, -682, -639, -38, 443, 407, 16, -289, -257, -5, 183, 157, 0, -111, -91, 2, 63, 49, -2, -33, -24, 1, 15, 10, -1, -5, -3, 0},
+    {-2, -5, -3, 7, 15, 7, -17, -34, -14, 36, 66, 26, -68, -118, -42, 119, 198, 64, -198, -315, -93, 317, 488, 133, -502, -754, -189, 814, 1216, 284, -1453, -2268, -527, 3759, 8530, 10954, 9516, 5114, 428, -2090, -1847, -161, 1102, 1027, 75, -684, -636, -34, 445, 405, 14, -289, -256, -3, 184, 156, -1, -111, -91, 3, 63, 49, -2, -33, -24, 2, 15, 10, -1, -5, -3, 0},
+    {-2, -5, -3, 7, 15, 7, -17, -34, -14, 36, 66, 25, -69, -118, -41, 120, 198, 62, -199, -314, -91, 319, 487, 129, -506, -754, -183, 819, 1214, 274, -1463, -2266, -507, 3790, 8555, 10967, 9495, 5082, 404, -2096, -1839, -150, 1105, 1022, 68, -686, -634, -30, 446, 403, 11, -290, -255, -2, 184, 156, -2, -112, -90, 3, 63, 49, -3, -33, -23, 2, 15, 10, -1, -5, -3, 0},
+    {-2, -5, -3, 7, 15, 7, -17, -34, -14, 37, 66, 25, -69, -118, -40, 121, 197, 61, -201, -314, -89, 322, 487, 125, -509, -753, -177, 825, 1213, 264, -1473, -2264, -487, 3821, 8580, 10965, 9474, 5050, 380, -2103, -1830, -139, 1109, 1018, 62, -689, -631, -26, 448, 402, 9, -291, -253, 0, 185, 155, -3, -112, -90, 4, 64, 48, -3, -33, -23, 2, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -3, 7, 15, 7, -17, -34, -14, 37, 66, 24, -70, -118, -39, 122, 197, 59, -202, -314, -86, 324, 486, 122, -513, -752, -171, 830, 1211, 254, -1483, -2262, -467, 3852, 8605, 10970, 9454, 5019, 355, -2109, -1822, -128, 1113, 1014, 56, -691, -628, -22, 449, 400, 6, -292, -252, 2, 185, 154, -4, -112, -89, 4, 64, 48, -3, -33, -23, 2, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -3, 7, 15, 7, -18, -34, -13, 37, 66, 24, -70, -118, -38, 123, 197, 58, -204, -313, -84, 326, 485, 118, -516, -751, -166, 836, 1210, 245, -1493, -2260, -446, 3884, 8630, 10973, 9433, 4987, 332, -2115, -1814, -118, 1117, 1009, 49, -693, -625, -18, 451, 398, 3, -293, -251, 3, 186, 153, -5, -113, -89, 5, 64, 48, -4, -33, -23, 2, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -3, 7, 15, 6, -18, -34, -13, 38, 66, 23, -71, -118, -37, 124, 197, 56, -205, -313, -81, 328, 485, 114, -520, -750, -160, 841, 1208, 235, -1503, -2258, -426, 3915, 8655, 10981, 9412, 4956, 308, -2121, -1806, -107, 1120, 1005, 43, -696, -623, -14, 452, 396, 1, -294, -250, 5, 186, 152, -6, -113, -88, 5, 64, 47, -4, -33, -23, 2, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -2, 7, 15, 6, -18, -34, -13, 38, 66, 23, -72, -118, -36, 125, 197, 55, -207, -313, -79, 331, 484, 110, -523, -749, -154, 847, 1206, 225, -1513, -2255, -405, 3947, 8679, 10980, 9391, 4924, 284, -2127, -1797, -96, 1124, 1001, 36, -698, -620, -10, 453, 394, -2, -295, -248, 6, 187, 152, -7, -113, -88, 6, 64, 47, -4, -33, -23, 2, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -2, 7, 15, 6, -18, -34, -12, 38, 66, 22, -72, -118, -36, 126, 197, 53, -208, -312, -77, 333, 484, 107, -526, -747, -148, 852, 1204, 215, -1523, -2253, -384, 3978, 8704, 10978, 9369, 4893, 260, -2133, -1789, -85, 1127, 996, 30, -700, -617, -6, 455, 392, -4, -295, -247, 8, 187, 151, -8, -113, -87, 7, 64, 47, -4, -33, -23, 3, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -2, 7, 15, 6, -18, -34, -12, 39, 66, 22, -73, -118, -35, 127, 196, 52, -210, -312, -74, 335, 483, 103, -530, -746, -142, 858, 1202, 205, -1533, -2250, -364, 4009, 8728, 10982, 9348, 4861, 237, -2139, -1780, -75, 1131, 992, 24, -702, -614, -2, 456, 391, -7, -296, -246, 10, 188, 150, -9, -114, -87, 7, 64, 47, -5, -33, -22, 3, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -2, 7, 15, 6, -18, -34, -12, 39, 66, 21, -73, -118, -34, 128, 196, 50, -211, -312, -72, 337, 482, 99, -533, -745, -136, 863, 1201, 195, -1542, -2247, -343, 4041, 8752, 10988, 9326, 4829, 213, -2144, -1772, -64, 1134, 987, 17, -704, -611, 2, 457, 389, -10, -297, -245, 11, 188, 149, -10, -114, -86, 8, 64, 46, -5, -33, -22, 3, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -2, 7, 15, 6, -19, -34, -12, 39, 66, 21, -74, -118, -33, 129, 196, 49, -212, -311, -69, 339, 481, 95, -536, -744, -130, 868, 1199, 185, -1552, -2245, -322, 4072, 8777, 10988, 9305, 4798, 190, -2150, -1763, -53, 1138, 982, 11, -706, -608, 6, 458, 387, -12, -298, -244, 13, 188, 148, -11, -114, -86, 8, 65, 46, -5, -33, -22, 3, 15, 9, -1, -5, -3, 0},
+    {-2, -5, -2, 7, 15, 6, -19, -34, -11, 40, 66, 20, -74, -118, -32, 130, 196, 47, -214, -311, -67, 342, 481, 92, -540, -743, -124, 874, 1197, 175, -1562, -2242, -301, 4104, 8801, 10984, 9283, 4766, 166, -2155, -1755, -43, 1141, 978, 5, -708, -605, 10, 460, 385, -15, -298, -242, 15, 189, 148, -12, -114, -85, 9, 65, 46, -6, -33, -22, 3, 15, 9, -1, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 6, -19, -34, -11, 40, 66, 20, -75, -118, -31, 130, 195, 46, -215, -310, -65, 344, 480, 88, -543, -741, -118, 879, 1195, 165, -1572, -2239, -279, 4135, 8825, 10987, 9261, 4735, 143, -2160, -1746, -32, 1144, 973, -1, -710, -603, 14, 461, 383, -17, -299, -241, 16, 189, 147, -13, -114, -85, 9, 65, 46, -6, -33, -22, 3, 15, 9, -1, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 5, -19, -34, -11, 40, 66, 19, -75, -117, -30, 131, 195, 44, -217, -310, -62, 346, 479, 84, -546, -740, -112, 884, 1192, 155, -1581, -2235, -258, 4167, 8849, 10991, 9239, 4703, 120, -2165, -1737, -21, 1147, 968, -8, -712, -600, 18, 462, 381, -20, -300, -240, 18, 190, 146, -14, -115, -84, 10, 65, 45, -6, -33, -22, 3, 15, 9, -1, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 5, -19, -34, -11, 40, 66, 18, -76, -117, -29, 132, 195, 43, -218, -309, -60, 348, 478, 80, -550, -739, -106, 889, 1190, 145, -1591, -2232, -237, 4198, 8873, 10995, 9217, 4672, 97, -2170, -1728, -11, 1150, 964, -14, -714, -597, 22, 463, 379, -22, -301, -238, 19, 190, 145, -15, -115, -84, 10, 65, 45, -6, -33, -22, 3, 15, 9, -1, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 5, -19, -34, -10, 41, 66, 18, -77, -117, -28, 133, 195, 41, -220, -309, -57, 350, 477, 76, -553, -737, -100, 894, 1188, 135, -1600, -2229, -215, 4230, 8896, 10993, 9195, 4640, 74, -2175, -1720, 0, 1153, 959, -20, -716, -594, 26, 464, 377, -25, -301, -237, 21, 191, 144, -16, -115, -83, 11, 65, 45, -7, -33, -21, 4, 15, 9, -2, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 5, -20, -34, -10, 41, 66, 17, -77, -117, -27, 134, 194, 40, -221, -308, -55, 352, 477, 73, -556, -736, -94, 900, 1186, 124, -1610, -2225, -193, 4261, 8920, 10993, 9173, 4608, 51, -2180, -1711, 10, 1156, 954, -26, -718, -591, 30, 466, 375, -27, -302, -236, 23, 191, 144, -17, -115, -83, 12, 65, 44, -7, -33, -21, 4, 15, 9, -2, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 5, -20, -34, -10, 41, 66, 17, -78, -117, -26, 135, 194, 38, -222, -308, -52, 355, 476, 69, -559, -734, -88, 905, 1183, 114, -1619, -2222, -172, 4293, 8944, 10996, 9150, 4577, 28, -2185, -1702, 21, 1159, 949, -33, -720, -588, 34, 467, 373, -30, -303, -234, 24, 191, 143, -18, -115, -82, 12, 65, 44, -7, -33, -21, 4, 15, 8, -2, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 5, -20, -34, -10, 42, 66, 16, -78, -117, -25, 136, 194, 37, -224, -307, -50, 357, 475, 65, -563, -733, -82, 910, 1181, 104, -1628, -2218, -150, 4324, 8967, 10994, 9128, 4545, 6, -2189, -1693, 31, 1162, 945, -39, -721, -585, 38, 468, 371, -32, -303, -233, 26, 192, 142, -19, -116, -82, 13, 65, 44, -8, -33, -21, 4, 15, 8, -2, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 5, -20, -34, -9, 42, 66, 16, -79, -117, -25, 137, 194, 35, -225, -307, -47, 359, 474, 61, -566, -731, -76, 915, 1178, 94, -1638, -2214, -128, 4356, 8990, 10997, 9105, 4514, -17, -2194, -1684, 42, 1165, 940, -45, -723, -581, 42, 469, 369, -35, -304, -232, 27, 192, 141, -20, -116, -81, 13, 65, 43, -8, -33, -21, 4, 15, 8, -2, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 5, -20, -34, -9, 42, 66, 15, -79, -117, -24, 138, 193, 34, -226, -306, -45, 361, 473, 57, -569, -730, -70, 920, 1176, 83, -1647, -2210, -106, 4387, 9013, 11000, 9082, 4482, -39, -2198, -1675, 52, 1168, 935, -51, -725, -578, 45, 470, 367, -37, -305, -231, 29, 192, 140, -21, -116, -81, 14, 65, 43, -8, -33, -21, 4, 15, 8, -2, -5, -2, 0},
+    {-2, -5, -2, 8, 15, 4, -20, -34, -9, 43, 66, 15, -80, -116, -23, 138, 193, 32, -228, -306, -42, 363, 472, 53, -572, -728, -64, 925, 1173, 73, -1656, -2206, -84, 4419, 9036, 10999, 9059, 4450, -62, -2202, -1665, 63, 1171, 930, -57, -727, -575, 49, 471, 365, -40, -305, -229, 30, 193, 139, -22, -116, -80, 14, 65, 43, -8, -34, -20, 4, 15, 8, -2, -5, -2, 0},
+};
+
+// 48000 Hz to 16000 Hz, 1 phases of 80 taps
+const int16_t polyphase_48000_16000[1][80] = {
+    {1, -1, -4, -5, 2, 11, 14, 1, -21, -32, -12, 32, 63, 39, -38, -105, -88, 29, 158, 169, 9, -213, -290, -95, 256, 456, 256, -265, -678, -534, 200, 979, 1028, 19, -1454, -2085, -715, 2716, 6874, 9705, 9709, 6874, 2716, -715, -2085, -1454, 19, 1028, 979, 200, -534, -678, -265, 256, 456, 256, -95, -290, -213, 9, 169, 158, 29, -88, -105, -38, 39, 63, 32, -12, -32, -21, 1, 14, 11, 2, -5, -4, -1, 1},
+};
+
+struct PolyphaseTable {
+    int inRate;
+    int outRate;
+    int up;
+    int down;
+    int taps;
+    const int16_t *coefficients; // up phases of taps
+};
+
+const PolyphaseTable polyphaseTables[] = {
+    {16000, 44100, 441, 160, 16, &polyphase_16000_44100[0][0]},
+    {22050, 44100, 2, 1, 16, &polyphase_22050_44100[0][0]},
+    {24000, 44100, 147, 80, 16, &polyphase_24000_44100[0][0]},
+    {22050, 16000, 320, 441, 40, &polyphase_22050_16000[0][0]},
+    {24000, 16000, 2, 3, 40, &polyphase_24000_16000[0][0]},
+    {32000, 16000, 1, 2, 56, &polyphase_32000_16000[0][0]},
+    {44100, 16000, 160, 441, 72, &polyphase_44100_16000[0][0]},
+    {48000, 16000, 1, 3, 80, &polyphase_48000_16000[0][0]},
+};
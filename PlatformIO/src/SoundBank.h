@@ -0,0 +1,230 @@
+#pragma once
+#include <ctype.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <SPIFFS.h>
+
+// Feedback sounds are kept on SPIFFS as /sounds/<name>.wav, SPIFFS allows 31 characters per path
+const size_t SOUND_NAME_MAX_LENGTH = 19;
+
+inline std::string soundPath(const std::string &name, const char *extension)
+{
+    return std::string("/sounds/") + name + extension;
+}
+
+inline bool isValidSoundName(const std::string &name)
+{
+    if (name.empty() || name.length() > SOUND_NAME_MAX_LENGTH)
+    {
+        return false;
+    }
+    for (const char c : name)
+    {
+        if (!isalnum((unsigned char)c) && c != '_' && c != '-')
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Where the samples of a stored sound are and what they are
+struct SoundFormat
+{
+    int rate = 16000;
+    int channels = 1;
+    int bits = 16;
+    uint32_t dataStart = 0; // offset of the data chunk's samples in the file
+    uint32_t dataBytes = 0; // size of the data chunk, or what of it is in the file
+};
+
+/**
+ * Walks the RIFF chunks of a WAV file to the fmt and data chunks and leaves the file at the
+ * first sample. Unlike XT_Wav_Class it does not stop after 44 bytes, WAV editors put LIST or
+ * fact chunks in front of the data. Only PCM is taken.
+ */
+inline bool readSoundFormat(File &file, SoundFormat &format)
+{
+    uint8_t chunk[24];
+    if (file.read(chunk, 12) != 12 || memcmp(chunk, "RIFF", 4) != 0 || memcmp(chunk + 8, "WAVE", 4) != 0)
+    {
+        return false;
+    }
+    const size_t size = file.size();
+    bool pcm = false;
+    size_t pos = 12;
+    while (pos + 8 <= size)
+    {
+        if (!file.seek(pos) || file.read(chunk, 8) != 8)
+        {
+            return false;
+        }
+        const uint32_t length = chunk[4] | chunk[5] << 8 | chunk[6] << 16 | (uint32_t)chunk[7] << 24;
+        if (memcmp(chunk, "fmt ", 4) == 0 && length >= 16)
+        {
+            if (file.read(chunk + 8, 16) != 16)
+            {
+                return false;
+            }
+            pcm = (chunk[8] | chunk[9] << 8) == 1;
+            format.channels = chunk[10] | chunk[11] << 8;
+            format.rate = chunk[12] | chunk[13] << 8 | chunk[14] << 16 | (uint32_t)chunk[15] << 24;
+            format.bits = chunk[22] | chunk[23] << 8;
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            // a header written before the size was known claims more than there is
+            format.dataStart = pos + 8;
+            format.dataBytes = std::min((size_t)length, size - format.dataStart);
+            return pcm && format.channels > 0 && format.rate > 0 && file.seek(format.dataStart);
+        }
+        pos += 8 + (size_t)length + (length & 1);
+    }
+    return false;
+}
+
+/**
+ * @brief The sounds stored on SPIFFS, and the one playing
+ *
+ * Uploads arrive in parts and are written to /sounds/<name>.tmp, which only replaces the sound
+ * once complete, so a broken upload never plays. play() opens a sound and hands it to the
+ * playback, which reads the data chunk block by block with read(), the sound is never loaded
+ * as a whole. write() runs in SoundTask, play() in whatever task starts the sound, read() and
+ * finish() in I2Stask.
+ * Plain C++ against the SPIFFS File, so the host tests run it on a directory.
+ */
+class SoundBank
+{
+public:
+    enum UploadResult
+    {
+        UPLOAD_PART,       // written, more to come
+        UPLOAD_STORED,     // the last part, the sound is replaced
+        UPLOAD_REMOVED,    // an empty upload, the sound is gone
+        UPLOAD_SKIPPED,    // no upload in progress, the part is of a dropped one
+        UPLOAD_PLAYING,    // the sound is playing, it is not replaced
+        UPLOAD_INCOMPLETE, // a part went missing, the upload is dropped
+        UPLOAD_FULL        // SPIFFS is full, the upload is dropped
+    };
+
+    UploadResult write(const std::string &name, const uint8_t *data, size_t len, size_t index, size_t total)
+    {
+        const std::string path = soundPath(name, ".wav");
+        const std::string temporary = soundPath(name, ".tmp");
+        if (index == 0)
+        {
+            if (playing && playingName == name)
+            {
+                return UPLOAD_PLAYING;
+            }
+            upload.close();
+            uploadName = name;
+            if (total == 0)
+            {
+                SPIFFS.remove(path.c_str());
+                return UPLOAD_REMOVED;
+            }
+            upload = SPIFFS.open(temporary.c_str(), "w");
+            uploadBytes = 0;
+        }
+        if (!upload || uploadName != name)
+        {
+            return UPLOAD_SKIPPED;
+        }
+        if (index != uploadBytes)
+        {
+            // the MQTT callback could not hand a part over, the queue was full or memory short
+            upload.close();
+            SPIFFS.remove(temporary.c_str());
+            return UPLOAD_INCOMPLETE;
+        }
+        if (upload.write(data, len) != len)
+        {
+            upload.close();
+            SPIFFS.remove(temporary.c_str());
+            return UPLOAD_FULL;
+        }
+        uploadBytes += len;
+        if (index + len < total)
+        {
+            return UPLOAD_PART;
+        }
+        upload.close();
+        SPIFFS.remove(path.c_str());
+        SPIFFS.rename(temporary.c_str(), path.c_str());
+        return UPLOAD_STORED;
+    }
+
+    /**
+     * Opens /sounds/<name>.wav and calls start(), which asks the playback to take it and
+     * returns whether it did. The sound is set up before, the playback may read it as soon as
+     * it is asked to, and dropped again if start() returns false. False if the sound does not
+     * exist, is no PCM WAV, another one is playing or the playback did not take it.
+     */
+    template <typename Start>
+    bool play(const std::string &name, Start start)
+    {
+        if (!isValidSoundName(name) || playing)
+        {
+            return false;
+        }
+        const std::string path = soundPath(name, ".wav");
+        if (!SPIFFS.exists(path.c_str()))
+        {
+            return false;
+        }
+        File opened = SPIFFS.open(path.c_str());
+        SoundFormat format;
+        if (!opened || !readSoundFormat(opened, format))
+        {
+            opened.close();
+            return false;
+        }
+        file = opened;
+        current = format;
+        remaining = format.dataBytes;
+        playingName = name;
+        playing = true;
+        if (!start())
+        {
+            finish();
+            return false;
+        }
+        return true;
+    }
+
+    bool isPlaying() const { return playing; }
+
+    const SoundFormat &format() const { return current; }
+
+    // All of the data chunk has been read
+    bool finished() const { return remaining == 0; }
+
+    // Reads the next samples, up to len bytes, and nothing past the data chunk
+    size_t read(uint8_t *block, size_t len)
+    {
+        const size_t received = file.read(block, std::min(len, remaining));
+        remaining -= received;
+        return received;
+    }
+
+    void finish()
+    {
+        file.close();
+        remaining = 0;
+        playing = false;
+    }
+
+private:
+    File upload;
+    std::string uploadName;
+    size_t uploadBytes = 0;
+
+    File file;
+    SoundFormat current;
+    size_t remaining = 0;
+    std::string playingName;
+    std::atomic<bool> playing{false};
+};
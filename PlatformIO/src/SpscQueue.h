@@ -0,0 +1,80 @@
+#pragma once
+#include <atomic>
+#include <stddef.h>
+
+/**
+ * @brief A lock-free single producer, single consumer queue of fixed size slots
+ *
+ * The queue owns its slots. The producer fills the slot returned by acquire() in place
+ * and hands it over with commit(), the consumer works on the slot returned by front()
+ * in place and gives it back with release(). Nothing is copied and nobody blocks, so
+ * the producer can run at a higher priority than the consumer.
+ *
+ * Exactly one task may produce and exactly one task may consume. S must be a power of two.
+ */
+template <
+    typename T,
+    size_t S>
+
+class SpscQueue
+{
+    static_assert(S >= 2 && (S & (S - 1)) == 0, "S must be a power of two");
+
+    T slots[S];
+    // both counters run freely, the slot index is taken modulo S
+    std::atomic<size_t> head{0}; // written by the producer only
+    std::atomic<size_t> tail{0}; // written by the consumer only
+
+public:
+    /* Producer: return the next free slot, or NULL if the queue is full */
+    T *acquire()
+    {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == S)
+        {
+            return NULL;
+        }
+        return &slots[h & (S - 1)];
+    }
+
+    /* Producer: hand the slot returned by acquire() over to the consumer */
+    void commit()
+    {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /* Consumer: return the oldest committed slot, or NULL if the queue is empty */
+    T *front()
+    {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t)
+        {
+            return NULL;
+        }
+        return &slots[t & (S - 1)];
+    }
+
+    /* Consumer: give the slot returned by front() back to the producer */
+    void release()
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /* Consumer: release all committed slots */
+    void clear()
+    {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    /* return the number of committed slots */
+    size_t size() { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+
+    /* return true if no slot is committed */
+    bool isEmpty() { return size() == 0; }
+
+    /* return true if all slots are committed */
+    bool isFull() { return size() == S; }
+
+    /* return the number of slots */
+    size_t maxSize() { return S; }
+};
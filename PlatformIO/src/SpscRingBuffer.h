@@ -0,0 +1,234 @@
+#pragma once
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+/**
+ * @brief A lock-free single producer, single consumer byte ring buffer
+ *
+ * Has the interface of Esp32RingBuffer: input items are pushed, whole output items are
+ * popped. Instead of a spinlock around every send and receive, the producer only moves the
+ * head and the consumer only moves the tail. Both count bytes freely and are taken modulo
+ * the capacity, which is why S * sizeof(OT) must be a power of two. Nothing waits, push
+ * fails right away when the data does not fit.
+ *
+ * Besides push and pop, writeSpan and readSpan hand out the contiguous part of the free or
+ * used space up to the wrap around, to fill or drain it in place.
+ *
+ * Watermarks let the two sides wake each other instead of polling: onFilled is called by
+ * every push which leaves at least the high watermark buffered, onDrained by the pop or
+ * clear which takes the buffer from above the low watermark to at most it. They run in the
+ * task which pushes or pops, but not from the ...FromISR methods, and not for the spans.
+ *
+ * Exactly one task may produce and exactly one task may consume, clear is for the consumer.
+ * The ...FromISR methods are the same as the others and only there to match Esp32RingBuffer.
+ * Plain C++, so it builds on the host as well.
+ */
+template <
+    typename IT,
+    typename OT,
+    size_t S>
+
+class SpscRingBuffer
+{
+    static const size_t CAPACITY = S * sizeof(OT);
+    static_assert((sizeof(OT) % sizeof(IT)) == 0, "sizeof(OT) must be a multiple of sizeof(IT)");
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "S * sizeof(OT) must be a power of two");
+
+    uint8_t *buffer;
+    std::atomic<size_t> head{0}; // bytes pushed, written by the producer only
+    std::atomic<size_t> tail{0}; // bytes popped, written by the consumer only
+    std::atomic<size_t> highWatermark{CAPACITY};
+    std::atomic<size_t> lowWatermark{0};
+    void (*onFilled)() = NULL;
+    void (*onDrained)() = NULL;
+
+    SpscRingBuffer(const SpscRingBuffer &) = delete;
+    SpscRingBuffer &operator=(const SpscRingBuffer &) = delete;
+
+public:
+    SpscRingBuffer()
+    {
+        buffer = new uint8_t[CAPACITY];
+    }
+
+    ~SpscRingBuffer()
+    {
+        delete[] buffer;
+    }
+
+    /* Producer: return the free space up to the wrap around, its length in bytes */
+    uint8_t *writeSpan(size_t &bytes)
+    {
+        const size_t h = head.load(std::memory_order_relaxed);
+        const size_t free = CAPACITY - (h - tail.load(std::memory_order_acquire));
+        const size_t offset = h & (CAPACITY - 1);
+        bytes = std::min(free, CAPACITY - offset);
+        return &buffer[offset];
+    }
+
+    /* Producer: hand bytes written to the span returned by writeSpan over to the consumer */
+    void commitWrite(size_t bytes)
+    {
+        head.store(head.load(std::memory_order_relaxed) + bytes, std::memory_order_release);
+    }
+
+    /* Consumer: return the used space up to the wrap around, its length in bytes */
+    const uint8_t *readSpan(size_t &bytes)
+    {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        const size_t used = head.load(std::memory_order_acquire) - t;
+        const size_t offset = t & (CAPACITY - 1);
+        bytes = std::min(used, CAPACITY - offset);
+        return &buffer[offset];
+    }
+
+    /* Consumer: give bytes of the span returned by readSpan back to the producer */
+    void commitRead(size_t bytes)
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + bytes, std::memory_order_release);
+    }
+
+private:
+    /* the plain push and pop, without the watermarks */
+    bool write(const IT *const inElement_p, size_t len)
+    {
+        const size_t bytes = len * sizeof(IT);
+        if (bytes > freeSize())
+        {
+            return false;
+        }
+        const uint8_t *src_p = reinterpret_cast<const uint8_t *>(inElement_p);
+        size_t written = 0;
+        while (written < bytes)
+        {
+            size_t span;
+            uint8_t *dst_p = writeSpan(span);
+            span = std::min(span, bytes - written);
+            memcpy(dst_p, &src_p[written], span);
+            written += span;
+            commitWrite(span);
+        }
+        return true;
+    }
+
+    size_t read(OT *dst, size_t n)
+    {
+        const size_t wanted = std::min(n, available()) * sizeof(OT);
+        uint8_t *dst_p = reinterpret_cast<uint8_t *>(dst);
+        size_t received = 0;
+        while (received < wanted)
+        {
+            size_t span;
+            const uint8_t *src_p = readSpan(span);
+            span = std::min(span, wanted - received);
+            memcpy(&dst_p[received], src_p, span);
+            received += span;
+            commitRead(span);
+        }
+        return received / sizeof(OT);
+    }
+
+    void drained(size_t before, size_t after)
+    {
+        const size_t low = lowWatermark.load(std::memory_order_relaxed);
+        if (onDrained != NULL && before > low && after <= low)
+        {
+            onDrained();
+        }
+    }
+
+public:
+    /* Set the callbacks and both watermarks in bytes, before the tasks use the buffer */
+    void setWatermarks(size_t high, void (*filledCallback)(), size_t low, void (*drainedCallback)())
+    {
+        onFilled = filledCallback;
+        onDrained = drainedCallback;
+        highWatermark = high;
+        lowWatermark = low;
+    }
+
+    /* Producer: move the watermark onFilled waits for */
+    void setHighWatermark(size_t high) { highWatermark = high; }
+
+    /* Producer: move the watermark onDrained waits for */
+    void setLowWatermark(size_t low) { lowWatermark = low; }
+
+    /* Push an input item to the end of the buffer */
+    bool push(const IT inElement)
+    {
+        return push(&inElement, 1);
+    }
+
+    /* Push an item array to the end of the buffer, all of it or nothing */
+    bool push(const IT *const inElement_p, size_t len = 1)
+    {
+        if (!write(inElement_p, len))
+        {
+            return false;
+        }
+        if (onFilled != NULL && size() >= highWatermark.load(std::memory_order_relaxed))
+        {
+            onFilled();
+        }
+        return true;
+    }
+
+    /* Pop the data at the beginning of the buffer */
+    bool pop(OT &outElement)
+    {
+        return popInto(&outElement, 1) == 1;
+    }
+
+    /* Pop up to n output items into dst, returns the number of items popped */
+    size_t popInto(OT *dst, size_t n)
+    {
+        const size_t before = size();
+        const size_t popped = read(dst, n);
+        drained(before, before - popped * sizeof(OT));
+        return popped;
+    }
+
+    /* Return the number of complete output items which can be popped right now */
+    size_t available() { return size() / sizeof(OT); }
+
+    /* Push an input item to the end of the buffer from within an interrupt service routine */
+    bool pushFromISR(const IT inElement) { return write(&inElement, 1); }
+
+    /* Push an input item array to the end of the buffer from within an interrupt service routine */
+    bool pushFromISR(const IT *const inElement_p, size_t len = 1) { return write(inElement_p, len); }
+
+    /* Pop the data from the beginning of the buffer from within an interrupt service routine */
+    bool popFromISR(OT &outElement) { return read(&outElement, 1) == 1; }
+
+    /* Return true if the buffer is full */
+    bool isFull() { return freeSize() == 0; }
+
+    /* Return true if the buffer is empty */
+    bool isEmpty() { return size() == 0; }
+
+    /* Consumer: reset the buffer to an empty state */
+    void clear()
+    {
+        const size_t before = size();
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+        drained(before, 0);
+    }
+
+    /* return the used size of the buffer in bytes. The tail is read first, so a producer
+     * sees rather too little free space than too much */
+    size_t size()
+    {
+        const size_t t = tail.load(std::memory_order_acquire);
+        const size_t used = head.load(std::memory_order_acquire) - t;
+        return used < CAPACITY ? used : CAPACITY;
+    }
+
+    /* return the maximum size of the buffer in bytes*/
+    size_t maxSize() { return CAPACITY; }
+
+    /* return the free size of the buffer in bytes*/
+    size_t freeSize() { return CAPACITY - size(); }
+};
@@ -1,7 +1,6 @@
 #include <tinyfsm.hpp>
 #include <AsyncMqttClient.h>
 #include <PubSubClient.h>
-#include "Esp32RingBuffer.h"
 
 class StateMachine
 : public tinyfsm::Fsm<StateMachine>
@@ -25,6 +24,7 @@ class HotwordDetected : public StateMachine
 {
   void entry(void) override {
     Serial.println("Enter HotwordDetected");
+    vadGateIdle = false;
     xEventGroupClearBits(audioGroup, PLAY);
     xEventGroupClearBits(audioGroup, STREAM);
     device->updateBrightness(config.hotword_brightness);
@@ -33,7 +33,11 @@ class HotwordDetected : public StateMachine
       xSemaphoreGive(wbSemaphore);
     }
     initHeader(device->readSize, device->width, device->rate);
-    xEventGroupSetBits(audioGroup, STREAM);
+    // the sound goes first, on a half duplex device the stream then starts with the
+    // StreamAudioEvent of I2Stask once it is done
+    if (!playSound(HOTWORD_SOUND) || fullDuplex()) {
+      xEventGroupSetBits(audioGroup, STREAM);
+    }
   }
 
   void react(StreamAudioEvent const &) override { 
@@ -41,9 +45,12 @@ class HotwordDetected : public StateMachine
     xEventGroupSetBits(audioGroup, STREAM);
   };
 
-  void react(PlayAudioEvent const &) override { 
-    xEventGroupClearBits(audioGroup, STREAM);
+  void react(PlayAudioEvent const &e) override { 
+    xEventGroupClearBits(audioGroup, playClearsBits(fullDuplex()));
     xEventGroupSetBits(audioGroup, PLAY);
+    if (e.accepted != NULL) {
+      *e.accepted = true;
+    }
   };
 
   void react(IdleEvent const &) override { 
@@ -61,6 +68,7 @@ class Idle : public StateMachine
 
   void entry(void) override {
     Serial.println("Enter Idle");
+    vadGateIdle = true;
     hotwordDetected = false;
     xEventGroupClearBits(audioGroup, PLAY);
     xEventGroupClearBits(audioGroup, STREAM);
@@ -99,9 +107,12 @@ class Idle : public StateMachine
     xEventGroupSetBits(audioGroup, STREAM);
   };
 
-  void react(PlayAudioEvent const &) override { 
-    xEventGroupClearBits(audioGroup, STREAM);
+  void react(PlayAudioEvent const &e) override { 
+    xEventGroupClearBits(audioGroup, playClearsBits(fullDuplex()));
     xEventGroupSetBits(audioGroup, PLAY);
+    if (e.accepted != NULL) {
+      *e.accepted = true;
+    }
   };
 
 };
@@ -112,11 +123,13 @@ class MQTTConnected : public StateMachine {
     Serial.printf("Connected as %s\r\n",config.siteid.c_str());
     publishDebug("Connected to asynch MQTT!");
     asyncClient.subscribe(playBytesTopic.c_str(), 0);
+    asyncClient.subscribe(playBytesStreamingTopic.c_str(), 0);
     asyncClient.subscribe(hotwordTopic.c_str(), 0);
     asyncClient.subscribe(audioTopic.c_str(), 0);
     asyncClient.subscribe(debugTopic.c_str(), 0);
     asyncClient.subscribe(ledTopic.c_str(), 0);
     asyncClient.subscribe(restartTopic.c_str(), 0);
+    asyncClient.subscribe((soundsTopic + "#").c_str(), 0);
     transit<Idle>();
   }
 
@@ -191,6 +204,8 @@ class WifiConnected : public StateMachine
     device->updateBrightness(config.brightness);
     device->updateColors(COLORS_WIFI_CONNECTED);
     ArduinoOTA.begin();
+    // wall clock for the audioStats timestamps, so frames of several satellites can be compared
+    configTime(0, 0, NTP_SERVER);
     transit<MQTTDisconnected>();
   }
 
@@ -205,6 +220,8 @@ class WifiDisconnected : public StateMachine
   void entry(void) override {
     if (!audioGroup) {
       audioGroup = xEventGroupCreate();
+      audioData.setWatermarks(0, audioDataFilled, 0, audioDataDrained);
+      soundUploadParts = xQueueCreate(SOUND_UPLOAD_QUEUE_SIZE, sizeof(SoundUploadPart));
     }
     //Mute initial output
     device->muteOutput(true);
@@ -217,6 +234,15 @@ class WifiDisconnected : public StateMachine
     } else {  
       Serial.println("We already have a I2Stask");
     }
+    if (captureHandle == NULL) {
+      // capture runs above I2Stask and PublishTask, reading the mic must never wait for the network
+      xTaskCreatePinnedToCore(CaptureTask, "CaptureTask", 8192, NULL, 4, &captureHandle, 1);
+      xTaskCreatePinnedToCore(PublishTask, "PublishTask", 8192, NULL, 2, &publishHandle, 1);
+    }
+    if (soundHandle == NULL) {
+      // below the audio tasks, a flash write may take a while
+      xTaskCreatePinnedToCore(SoundTask, "SoundTask", 4096, NULL, 1, &soundHandle, 1);
+    }
     Serial.println("Enter WifiDisconnected");
     Serial.printf("Total heap: %d\r\n", ESP.getHeapSize());
     Serial.printf("Free heap: %d\r\n", ESP.getFreeHeap());
@@ -341,26 +367,113 @@ std::vector<std::string> explode( const std::string &delimiter, const std::strin
     return arr;
 }
 
-void push_i2s_data(const uint8_t *const payload, size_t len)
+// Drops openUtterance if I2Stask gave up on the queue since it was started
+bool checkOpenUtterance()
 {
-  while (audioData.push((uint8_t *)payload, len) == false)
+  if (openUtterance != NULL && openGeneration != playGeneration)
   {
-    // getting in here indicates a completely filled buffer, as this is the only 
-    // reason why push can fail unless len is larger than max buffer size
-    // this case is not handled and must be avoided, hence we put an assert in
-    assert(len < audioData.maxSize());
-    do
+    openUtterance = NULL;
+  }
+  return openUtterance != NULL;
+}
+
+// audioData high watermark, called by every push once enough is buffered to ride out the gaps
+// between the chunks
+void audioDataFilled()
+{
+  if (!(xEventGroupGetBits(audioGroup) & PLAY))
+  {
+    send_event(PlayAudioEvent());
+  }
+}
+
+// audioData low watermark, called by I2Stask once there is room for the push waiting for it
+void audioDataDrained()
+{
+  xEventGroupSetBits(audioGroup, SPACE);
+}
+
+// Pushes in slices of at most half the buffer, a larger push would never fit
+void push_i2s_data(const uint8_t *payload, size_t len)
+{
+  const size_t maxSlice = audioData.maxSize() / 2;
+  while (len > 0)
+  {
+    if (!checkOpenUtterance())
     {
-      if (xEventGroupGetBits(audioGroup) != PLAY)
-      {
-        send_event(PlayAudioEvent());
-      }
-      vTaskDelay(pdMS_TO_TICKS(50));
-    } while (audioData.isFull());
-    /// Serial.print("."); 
+      return;
+    }
+    const size_t slice = std::min(len, maxSlice);
+    // cleared before trying, so room made after the failed push still wakes this task
+    audioData.setLowWatermark(audioData.maxSize() - slice);
+    xEventGroupClearBits(audioGroup, SPACE);
+    while (!audioData.push((uint8_t *)payload, slice))
+    {
+      // the buffer is full, it only drains while playing. The timeout covers a PlayAudioEvent
+      // which was not taken, the state machine ignores it in some states
+      audioDataFilled();
+      xEventGroupWaitBits(audioGroup, SPACE, pdTRUE, pdFALSE, pdMS_TO_TICKS(500));
+    }
+    openUtterance->bytes += slice;
+    payload += slice;
+    len -= slice;
+  }
+}
+
+// All of the request is buffered, make sure it plays even if the start threshold was not reached
+void finish_playback()
+{
+  if (!checkOpenUtterance())
+  {
+    return;
+  }
+  if (openUtterance->bytes % 2 != 0)
+  {
+    // I2Stask pops whole 16 bit words, pad to keep the next utterance aligned
+    const uint8_t pad = openUtterance->bitDepth == 8 ? 0x80 : 0;
+    push_i2s_data(&pad, 1);
+  }
+  openUtterance->complete = true;
+  openUtterance = NULL;
+  if (!(xEventGroupGetBits(audioGroup) & PLAY))
+  {
+    send_event(PlayAudioEvent());
+  }
+}
+
+// Queues a new utterance with the format from the WAV header, returns where its samples start.
+// Waits while the queue is full.
+size_t start_playback(const uint8_t *wav, const std::string &requestId)
+{
+  finish_playback();
+  XT_Wav_Class Message(wav);
+
+  Serial.printf("Samplerate: %d, Channels: %d, Format: %d, Bits per Sample: %d, Start: %d\r\n", Message.SampleRate, Message.NumChannels, (int)Message.Format, Message.BitsPerSample, Message.DataStart);
+  Utterance *utterance = playQueue.acquire();
+  while (utterance == NULL)
+  {
+    if (!(xEventGroupGetBits(audioGroup) & PLAY))
+    {
+      send_event(PlayAudioEvent());
+    }
+    vTaskDelay(pdMS_TO_TICKS(50));
+    utterance = playQueue.acquire();
   }
+  utterance->finishedMsg = "{\"id\":\"" + requestId + "\",\"siteId\":\"" + config.siteid + "\",\"sessionId\":null}";
+  utterance->sampleRate = Message.SampleRate;
+  utterance->numChannels = Message.NumChannels;
+  utterance->bitDepth = Message.BitsPerSample;
+  utterance->bytes = 0;
+  utterance->complete = false;
+  playQueue.commit();
+  openUtterance = utterance;
+  openGeneration = playGeneration;
+
+  audioData.setHighWatermark(playStartBytes(Message.SampleRate, Message.NumChannels, Message.BitsPerSample, config.play_start_ms, audioData.maxSize()));
+  return Message.DataStart;
 }
 
+// hermes/audioServer/<siteId>/playBytes/<requestId>
 void handle_playBytes(const std::string& topicstr, uint8_t *payload, size_t len, size_t index, size_t total)
 {
   size_t offset = 0;
@@ -368,19 +481,10 @@ void handle_playBytes(const std::string& topicstr, uint8_t *payload, size_t len,
   // start of message
   if (index == 0)
   {
-    message_size = total;
-    audioData.clear();
-    XT_Wav_Class Message((const uint8_t *)payload);
-    
-    sampleRate = Message.SampleRate;
-    numChannels = Message.NumChannels;
-    bitDepth = Message.BitsPerSample;
-    offset = Message.DataStart;
-
-    Serial.printf("Samplerate: %d, Channels: %d, Format: %d, Bits per Sample: %d, Start: %d\r\n", sampleRate, numChannels, (int)Message.Format, bitDepth, offset);
-    queueDelay = (sampleRate * numChannels * bitDepth) / 1000;
-    //delay *= 2;
-    //Serial.printf("Delay %d\n", (int)queueDelay);
+    std::vector<std::string> topicparts = explode("/", topicstr);
+    // a streaming request still open is ended, its remaining chunks are not played
+    streamingChunks.takeOver();
+    offset = start_playback((const uint8_t *)payload, topicparts.size() > 4 ? topicparts[4] : std::string(""));
   }
 
   push_i2s_data((uint8_t *)&payload[offset], len - offset);
@@ -388,21 +492,154 @@ void handle_playBytes(const std::string& topicstr, uint8_t *payload, size_t len,
   // enf of message 
   if (len + index == total)
   {    
-    //At the end, make sure to start play in case the buffer is not full yet
-    if (!audioData.isEmpty() && xEventGroupGetBits(audioGroup) != PLAY)
+    finish_playback();
+  }
+}
+
+// Plays what streamingChunks puts in order, each chunk is a WAV file of its own. The first
+// chunk played sets the format.
+struct StreamingPlayer
+{
+  void play(const uint8_t *chunk, size_t len, bool chunkStart, bool requestStart)
+  {
+    size_t offset = 0;
+    if (chunkStart && len >= 4 && memcmp(chunk, "RIFF", 4) == 0)
     {
-      send_event(PlayAudioEvent());
+      if (requestStart)
+      {
+        offset = start_playback(chunk, streamingChunks.requestId());
+      }
+      else
+      {
+        XT_Wav_Class Message(chunk);
+        offset = Message.DataStart;
+      }
     }
+    offset = std::min(offset, len);
+    push_i2s_data(&chunk[offset], len - offset);
+  }
 
-    std::vector<std::string> topicparts = explode("/", topicstr);
-    finishedMsg = "{\"id\":\"" + topicparts[4] + "\",\"siteId\":\"" + config.siteid + "\",\"sessionId\":null}";
+  void finish() { finish_playback(); }
+
+  void lost(int chunkIndex, bool dropped)
+  {
+    if (dropped)
+    {
+      Serial.printf("Chunk %d of %s dropped, %d bytes are waiting already\r\n", chunkIndex, streamingChunks.requestId().c_str(), (int)streamingChunks.pendingSize());
+    }
+    else
+    {
+      Serial.printf("Chunk %d of %s lost\r\n", chunkIndex, streamingChunks.requestId().c_str());
+    }
+  }
+};
+
+// hermes/audioServer/<siteId>/playBytesStreaming/<requestId>/<chunkIndex>/<isLastChunk>
+// Playing starts once play_start_ms is buffered, it does not wait for the last chunk.
+void handle_playBytesStreaming(const std::string& topicstr, uint8_t *payload, size_t len, size_t index, size_t total)
+{
+  std::vector<std::string> topicparts = explode("/", topicstr);
+  if (topicparts.size() < 7)
+  {
+    return;
+  }
+  const int chunkIndex = atoi(topicparts[5].c_str());
+  const bool lastChunk = topicparts[6] == "true" || topicparts[6] == "1";
+  StreamingPlayer player;
+  streamingChunks.receive(topicparts[4], chunkIndex, lastChunk, (const uint8_t *)payload, len, index, total, player);
+}
+
+// <siteid>/sounds/<name> stores the WAV in the payload as /sounds/<name>.wav, an empty payload
+// removes it. Runs in the MQTT callback, so it only copies the part for SoundTask.
+void handle_sound_upload(const std::string& topicstr, const uint8_t *payload, size_t len, size_t index, size_t total)
+{
+  const std::string name = topicstr.substr(soundsTopic.length());
+  if (!isValidSoundName(name))
+  {
+    if (index == 0)
+    {
+      publishDebug("Sound names are 1 to 19 letters, digits, '_' or '-'");
+    }
+    return;
+  }
+  SoundUploadPart part;
+  strcpy(part.name, name.c_str());
+  part.data = len > 0 ? (uint8_t *)malloc(len) : NULL;
+  part.len = len;
+  part.index = index;
+  part.total = total;
+  if (len > 0 && part.data == NULL)
+  {
+    // SoundTask sees the gap and drops the upload
+    return;
+  }
+  memcpy(part.data, payload, len);
+  if (xQueueSend(soundUploadParts, &part, 0) != pdTRUE)
+  {
+    free(part.data);
+  }
+}
+
+// Writes a part of a sound upload, one with a part missing is dropped
+void write_sound_part(const SoundUploadPart &part)
+{
+  switch (soundBank.write(part.name, part.data, part.len, part.index, part.total))
+  {
+    case SoundBank::UPLOAD_STORED:
+      Serial.printf("Stored sound %s, %d bytes\n", part.name, (int)part.total);
+      break;
+    case SoundBank::UPLOAD_PLAYING:
+      publishDebug("Sound is playing, not replaced");
+      break;
+    case SoundBank::UPLOAD_INCOMPLETE:
+      publishDebug("Sound upload incomplete, not stored");
+      break;
+    case SoundBank::UPLOAD_FULL:
+      publishDebug("Sound does not fit into SPIFFS");
+      break;
+    default:
+      break;
+  }
+}
+
+void SoundTask(void *p) {
+  SoundUploadPart part;
+  while (1) {
+    if (xQueueReceive(soundUploadParts, &part, portMAX_DELAY) == pdTRUE) {
+      write_sound_part(part);
+      free(part.data);
+    }
   }
 }
 
+// Plays /sounds/<name>.wav from flash, I2Stask reads it block by block into the playback path.
+// Does nothing if the sound does not exist, something is playing already or the state does not
+// play.
+bool playSound(const std::string &name)
+{
+  if (xEventGroupGetBits(audioGroup) & PLAY)
+  {
+    return false;
+  }
+  return soundBank.play(name, []() {
+    PlayAudioEvent event;
+    bool accepted = false;
+    event.accepted = &accepted;
+    send_event(event);
+    return accepted;
+  });
+}
+
 void onMqttMessage(char *topic, char *payload, AsyncMqttClientMessageProperties properties, size_t len, size_t index, size_t total)
 {
   const std::string topicstr(topic);
 
+  if (topicstr.compare(0, soundsTopic.length(), soundsTopic) == 0)
+  {
+    handle_sound_upload(topicstr, (uint8_t*)payload, len, index, total);
+    return;
+  }
+
   // complete or enf of message has been received
   if (len + index == total)
   {
@@ -434,6 +671,10 @@ void onMqttMessage(char *topic, char *payload, AsyncMqttClientMessageProperties
         }
       }
     }
+    else if (topicstr.find("playBytesStreaming") != std::string::npos)
+    {
+      handle_playBytesStreaming(topicstr, (uint8_t*)payload, len, index, total);
+    }
     else if (topicstr.find("playBytes") != std::string::npos)
     {
       handle_playBytes(topicstr, (uint8_t*)payload, len, index, total);
@@ -506,13 +747,65 @@ void onMqttMessage(char *topic, char *payload, AsyncMqttClientMessageProperties
         }
         if (root.containsKey("gain")) {
           config.gain = (int)root["gain"];
+          device->setGain(config.gain);
         }
         if (root.containsKey("volume")) {
           config.volume = (uint16_t)root["volume"];
+          device->setVolume(config.volume);
+          playbackVolume.setVolume(config.volume);
+        }
+        if (root.containsKey("vad")) {
+          config.vad = (root["vad"] == "true") ? true : false;
+        }
+        if (root.containsKey("vad_preroll_ms")) {
+          config.vad_preroll_ms = std::max(std::min((int)root["vad_preroll_ms"], VAD_PREROLL_MAX_MS), 0);
+        }
+        if (root.containsKey("frame_ms")) {
+          const int frame_ms = (int)root["frame_ms"];
+          if (isValidFrameMs(frame_ms)) {
+            config.frame_ms = frame_ms;
+            initHeader(device->readSize, device->width, device->rate);
+          }
+        }
+        if (root.containsKey("beam")) {
+          config.beam = (int)root["beam"];
+          device->setBeamDirection(config.beam);
+        }
+        if (root.containsKey("audio_stats")) {
+          config.audio_stats = (root["audio_stats"] == "true") ? true : false;
+        }
+        if (root.containsKey("drop_policy")) {
+          if (root["drop_policy"] == "newest") {
+            config.drop_policy = DROP_NEWEST;
+          } else if (root["drop_policy"] == "oldest") {
+            config.drop_policy = DROP_OLDEST;
+          } else if (root["drop_policy"] == "block") {
+            config.drop_policy = DROP_BLOCK;
+          }
+        }
+        if (root.containsKey("play_start_ms")) {
+          config.play_start_ms = std::max((int)root["play_start_ms"], 0);
+        }
+        if (root.containsKey("full_duplex")) {
+          config.full_duplex = (root["full_duplex"] == "true") ? true : false;
+        }
+        if (root.containsKey("resampler_quality")) {
+          config.resampler_quality = std::max(std::min((int)root["resampler_quality"], 10), -1);
+          device->setResamplerQuality(config.resampler_quality);
+        }
+        if (root.containsKey("drop_ms")) {
+          config.drop_ms = std::max((int)root["drop_ms"], 0);
+        }
+        if (root.containsKey("adpcm")) {
+          config.adpcm = (root["adpcm"] == "true") ? true : false;
+          initHeader(device->readSize, device->width, device->rate);
         }
         if (root.containsKey("hotword")) {
           config.hotword_detection = (root["hotword"] == "local") ? HW_LOCAL : HW_REMOTE;
         }
+        if (root.containsKey("play_sound")) {
+          playSound(std::string(root["play_sound"] | ""));
+        }
         saveConfiguration(configfile, config);
       } else {
         publishDebug(err.c_str());
@@ -544,7 +837,11 @@ void onMqttMessage(char *topic, char *payload, AsyncMqttClientMessageProperties
     }
   } else {
     // len + index < total ==> partial message
-    if (topicstr.find("playBytes") != std::string::npos)
+    if (topicstr.find("playBytesStreaming") != std::string::npos)
+    {
+      handle_playBytesStreaming(topicstr, (uint8_t*)payload, len, index, total);
+    }
+    else if (topicstr.find("playBytes") != std::string::npos)
     {
       handle_playBytes(topicstr, (uint8_t*)payload, len, index, total);
     }
@@ -555,93 +852,372 @@ void onMqttMessage(char *topic, char *payload, AsyncMqttClientMessageProperties
   }
 }
 
+// Sets up the converter and, unless it is set up like that already, the device for a format
+void configurePlayback(int rate, int bits, int channels, bool reference, int *current)
+{
+  if (!playbackConverter.configure(bits, channels, device->writeChannels)) {
+    Serial.printf("Unsupported format, %d bits %d channels\n", bits, channels);
+  }
+  if (current[0] == rate && current[1] == bits && current[2] == channels) {
+    return;
+  }
+  const int outChannels = playbackConverter.outputChannels();
+  playbackConcealer.reset();
+  if (reference && current[0] != 0) {
+    flushReference();
+  }
+  device->setWriteMode(rate, 16, outChannels);
+  if (reference) {
+    initReferenceHeader(rate, 16, outChannels);
+  }
+  current[0] = rate;
+  current[1] = bits;
+  current[2] = channels;
+}
+
+// Writes samples of playbackSamples to the device
+void writeSamples(size_t samples, bool reference)
+{
+  size_t bytes_written;
+  const int outChannels = playbackConverter.outputChannels();
+  const size_t bytes_to_write = samples * 2;
+  if (!device->hasVolumeControl()) {
+    playbackVolume.process(playbackSamples, bytes_to_write / 2 / outChannels, outChannels);
+  }
+  if (!config.mute_output && bytes_to_write > 0)
+  {
+    device->muteOutput(false);
+    device->writeAudio((uint8_t*)playbackSamples, bytes_to_write, &bytes_written);
+    if (reference) {
+      queueReference((const uint8_t *)playbackSamples, bytes_written);
+    }
+  }
+  else
+  {
+    bytes_written = bytes_to_write;
+  }
+  if (bytes_written != bytes_to_write) {
+    Serial.printf("Bytes to write %d, but bytes written %d\r\n",bytes_to_write,bytes_written);
+  }
+}
+
+// Converts received bytes of playbackBlock and writes them to the device
+void playBlock(size_t received, bool reference)
+{
+  const int outChannels = playbackConverter.outputChannels();
+  // a frame split between two blocks comes out with the next one
+  const size_t samples = playbackConverter.convert(playbackBlock, received, playbackSamples);
+  playbackConcealer.play(playbackSamples, samples / outChannels, outChannels);
+  writeSamples(samples, reference);
+}
+
+// Fills a gap in the stream, so the DMA neither repeats old buffers nor stops mid waveform
+void concealBlock(bool reference)
+{
+  const int outChannels = playbackConverter.outputChannels();
+  playbackConcealer.conceal(playbackSamples, UNDERRUN_CONCEAL_FRAMES, outChannels);
+  writeSamples(UNDERRUN_CONCEAL_FRAMES * outChannels, reference);
+  playbackStats.concealedFrames += UNDERRUN_CONCEAL_FRAMES;
+  if (config.mute_output) {
+    // nothing waits for the DMA then
+    vTaskDelay(pdMS_TO_TICKS(UNDERRUN_CONCEAL_FRAMES * 1000 / 16000));
+  }
+}
+
 void I2Stask(void *p) {  
   while (1) {    
-    if (xEventGroupGetBits(audioGroup) == PLAY && xSemaphoreTake(wbSemaphore, (TickType_t)5000) == pdTRUE) {
-      size_t bytes_written;
+    if ((xEventGroupGetBits(audioGroup) & PLAY) && xSemaphoreTake(wbSemaphore, (TickType_t)5000) == pdTRUE) {
       boolean timeout = false;
-      int played = 44;
+      const bool reference = fullDuplex();
+      const size_t blockBytes = std::min(device->writeSize, PLAYBACK_BLOCK_MAX_BYTES);
+      // rate, bits and channels the device is set up for
+      int format[3] = {0, 0, 0};
+      const uint32_t underruns = playbackStats.underruns;
 
-      device->setWriteMode(sampleRate, bitDepth, numChannels);
-
-      while (played < message_size && timeout == false)
-      {
-        int bytes_to_write = device->writeSize;
-        if (message_size - played < device->writeSize)
-        {
-          bytes_to_write = message_size - played;
+      if (soundBank.isPlaying()) {
+        // a sound from flash, read straight into the playback block, it is never loaded as a whole
+        // only the data chunk, tags may follow it. Reads which fail stall it like a stream
+        const SoundFormat &sound = soundBank.format();
+        configurePlayback(sound.rate, sound.bits, sound.channels, reference, format);
+        unsigned long lastData = millis();
+        boolean stalled = false;
+        while (!soundBank.finished() && !stalled) {
+          const size_t received = soundBank.read(playbackBlock, blockBytes);
+          if (received > 0) {
+            lastData = millis();
+          }
+          playBlock(received, reference);
+          if (received < blockBytes && !soundBank.finished()) {
+            concealBlock(reference);
+            stalled = millis() - lastData > 5000;
+          }
         }
-        uint16_t data[bytes_to_write/2];
-        if (!timeout)
+        soundBank.finish();
+      }
+
+      // the utterances back to back, each plays until all of it has arrived and drained,
+      // playBytesStreaming does not know its size up front
+      Utterance *utterance;
+      while (!timeout && (utterance = playQueue.front()) != NULL) {
+        configurePlayback(utterance->sampleRate, utterance->bitDepth, utterance->numChannels, reference, format);
+        size_t played = 0;
+        unsigned long lastData = millis();
+        while (!(utterance->complete && played >= utterance->bytes) && timeout == false)
         {
-          for (int i = 0; i < bytes_to_write/2; i++)
+          const size_t samples = std::min(blockBytes, utterance->bytes - played) / 2;
+          const size_t popped = audioData.popInto((uint16_t *)playbackBlock, samples);
+          if (popped > 0)
           {
-            if (!audioData.pop(data[i]))
+            if (playbackConcealer.isConcealing())
             {
-              Serial.printf("Buffer underflow %d %ld\n", played + i, message_size);
-              vTaskDelay(60);
-              bytes_to_write = (i)*2;
+              playbackStats.longestGapMs = std::max((uint32_t)(millis() - lastData), (uint32_t)playbackStats.longestGapMs);
             }
+            lastData = millis();
           }
-          played = played + bytes_to_write;
-          if (!config.mute_output)
+          played = played + popped * 2;
+          playBlock(popped * 2, reference);
+          if (popped * 2 < blockBytes && !utterance->complete)
           {
-            device->muteOutput(false);
-            device->writeAudio((uint8_t*)data, bytes_to_write, &bytes_written);
-
-          }
-          else
-          {
-            bytes_written = bytes_to_write;
-          }
-            if (bytes_written != bytes_to_write) {
-              Serial.printf("Bytes to write %d, but bytes written %d\r\n",bytes_to_write,bytes_written);
+            if (!playbackConcealer.isConcealing())
+            {
+              playbackStats.underruns++;
+            }
+            concealBlock(reference);
+            // the rest of the message is not coming anymore
+            timeout = millis() - lastData > 5000;
           }
         }
+        asyncClient.publish(playFinishedTopic.c_str(), 0, false, utterance->finishedMsg.c_str());
+        playQueue.release();
+      }
+      if (timeout) {
+        // give up on everything queued, openUtterance goes with it
+        while ((utterance = playQueue.front()) != NULL) {
+          asyncClient.publish(playFinishedTopic.c_str(), 0, false, utterance->finishedMsg.c_str());
+          playQueue.release();
+        }
+        audioData.clear();
+        playGeneration++;
+      }
+      if (reference && format[0] != 0) {
+        flushReference();
       }
-      asyncClient.publish(playFinishedTopic.c_str(), 0, false, finishedMsg.c_str());
       device->muteOutput(true);
-      audioData.clear();
-      Serial.println("Done");
+      if (playbackStats.underruns != underruns) {
+        Serial.printf("Done, %u underruns\n", (unsigned)(playbackStats.underruns - underruns));
+      } else {
+        Serial.println("Done");
+      }
       xSemaphoreGive(wbSemaphore); 
       send_event(StreamAudioEvent());
+      if (!playQueue.isEmpty()) {
+        // queued after the loop above looked, while PLAY was still set
+        send_event(PlayAudioEvent());
+      }
     }
-    if (xEventGroupGetBits(audioGroup) == STREAM && !config.mute_input && xSemaphoreTake(wbSemaphore, (TickType_t)5000) == pdTRUE) {     
+    //Added for stability when neither PLAY or STREAM is set.
+    vTaskDelay(10);
+
+  }  
+  vTaskDelete(NULL);
+}
+
+// Copy the header into the frame unless it is already up to date
+void prepareAudioFrame(AudioFrame *frame) {
+  if (frame->headerSerial != headerSerial) {
+    frame->adpcm = adpcmFrames;
+    if (frame->adpcm) {
+      frame->headerLength = sizeof(adpcmHeader);
+      frame->messageLength = adpcmHeader.data_length;
+      memcpy(&frame->headerSpace[AUDIO_FRAME_HEADER_MAX_BYTES - frame->headerLength], &adpcmHeader, frame->headerLength);
+    } else {
+      frame->headerLength = sizeof(header);
+      frame->messageLength = header.data_length;
+      memcpy(&frame->headerSpace[AUDIO_FRAME_HEADER_MAX_BYTES - frame->headerLength], &header, frame->headerLength);
+    }
+    frame->headerSerial = headerSerial;
+  }
+}
+
+// Encodes the samples of a frame into one ADPCM block per message
+void encodeAudioFrame(AudioFrame *frame, const int16_t *samples, size_t count) {
+  // blocks hold the codes of (block size - 4) * 2 samples, behind the header sample
+  const size_t blockSamples = (frame->messageLength - 4) * 2;
+  frame->length = 0;
+  for (size_t i = 0; i + blockSamples <= count; i += blockSamples) {
+    frame->length += adpcmEncoder.encodeBlock(&samples[i], blockSamples, &frame->data[frame->length]);
+  }
+}
+
+// Hands a captured frame to PublishTask, or keeps it in the pre-roll while the voice gate is closed.
+// Once the gate opens, frames pass through the pre-roll until it is drained, so the order is kept.
+// The voice detection runs on the samples the frame was made of, as its data may be encoded.
+void queueAudioFrame(AudioFrame *frame, const int16_t *samples, size_t count) {
+  const int frame_ms = std::max((int)(count * 1000 / device->rate), 1);
+  bool voice = true;
+  if (config.vad && vadGateIdle) {
+    voice = voiceDetector.process(samples, count, frame_ms);
+  }
+  const int prerollFrames = std::max(std::min(config.vad_preroll_ms, VAD_PREROLL_MAX_MS), 0) / frame_ms;
+  const size_t capacity = prerollFrames * frame->length;
+  if (capacity != preroll.capacity()) {
+    preroll.reset(capacity);
+  }
+
+  if (!voice) {
+    preroll.push(frame->data, frame->length);
+    captureStats.gated++;
+  } else if (!preroll.isEmpty()) {
+    captureStats.dropped += preroll.push(frame->data, frame->length) / frame->length;
+    // the pre-roll holds the frames right before this one, which dates them
+    const uint32_t sequence = frame->sequence;
+    const int64_t captureTime = frame->captureTime;
+    const int64_t queuedTime = frame->queuedTime;
+    const int64_t frameMicros = (int64_t)count * 1000000 / device->rate;
+    // the first acquire returns the slot of frame again, its data is in the pre-roll by now
+    AudioFrame *slot;
+    while (preroll.size() >= frame->length && (slot = audioFrames.acquire()) != NULL) {
+      const uint32_t age = preroll.size() / frame->length - 1;
+      prepareAudioFrame(slot);
+      slot->length = frame->length;
+      slot->sequence = sequence - age;
+      slot->captureTime = captureTime - age * frameMicros;
+      // the latency bound counts from the release, the pre-roll is old on purpose
+      slot->queuedTime = queuedTime;
+      preroll.pop(slot->data, slot->length);
+      audioFrames.commit();
+    }
+    xTaskNotifyGive(publishHandle);
+  } else if (frame == &overrunFrame) {
+    captureStats.dropped++;
+  } else {
+    audioFrames.commit();
+    xTaskNotifyGive(publishHandle);
+  }
+}
+
+// Reads the mic and queues the frames for PublishTask. Network stalls never reach this task,
+// when the queue is full the frame is still read, so the DMA keeps running, but dropped.
+void CaptureTask(void *p) {
+  uint32_t encoderSerial = 0;
+  uint32_t sequence = 0;
+  while (1) {
+    // in full duplex the mic has its own port, capture does not wait for the playback to finish
+    const bool duplex = fullDuplex();
+    if ((xEventGroupGetBits(audioGroup) & STREAM) && !config.mute_input) {
+      // PublishTask notifies every released frame. With DROP_BLOCK waiting delays the read,
+      // longer than the DMA buffers of the device hold and samples are lost there instead.
+      // The wait is over before wbSemaphore is taken, so the playback never waits along
+      AudioFrame *frame = acquireFrame(audioFrames, config.drop_policy, config.drop_ms,
+        []() { return (int64_t)esp_timer_get_time(); },
+        [](int64_t micros) { ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(micros / 1000 + 1)); });
+      const bool locked = captureTakesSemaphore(duplex);
+      if (locked && xSemaphoreTake(wbSemaphore, (TickType_t)5000) != pdTRUE) {
+        continue;
+      }
       device->setReadMode();
-      uint8_t data[device->readSize * device->width];
-      if (audioServer.connected()) {
-        if (device->readAudio(data, device->readSize * device->width)) {
-          // only send audio if hotword_detection is HW_REMOTE.
-          //TODO when LOCAL is supported: check if hotword is detected and send audio as well in that case
-          if (config.hotword_detection == HW_REMOTE)
-          {
-            //Rhasspy needs an audiofeed of 512 bytes+header per message
-            //Some devices, like the Matrix Voice do 512 16 bit read in one mic read
-            //This is 1024 bytes, so two message are needed in that case
-            const int messageBytes = 512;
-            uint8_t payload[sizeof(header) + messageBytes];
-            const int message_count = sizeof(data) / messageBytes;
-            for (int i = 0; i < message_count; i++) {
-              memcpy(payload, &header, sizeof(header));
-              memcpy(&payload[sizeof(header)], &data[messageBytes * i], messageBytes);
-              audioServer.publish(audioFrameTopic.c_str(),(uint8_t *)payload, sizeof(payload));
+      if (frame == NULL) {
+        frame = &overrunFrame;
+      }
+      prepareAudioFrame(frame);
+      // a frame holds one or more device reads, ADPCM frames are read aside and encoded into the frame
+      uint8_t *samples = frame->adpcm ? (uint8_t *)captureSamples : frame->data;
+      const int readBytes = device->readSize * device->width;
+      bool complete = true;
+      frame->length = audioFrameBytes;
+      for (int offset = 0; offset < audioFrameBytes && complete; offset += readBytes) {
+        complete = device->readAudio(&samples[offset], readBytes);
+      }
+      if (complete) {
+        frame->captureTime = wallClockMicros();
+        frame->queuedTime = esp_timer_get_time();
+        frame->sequence = sequence++;
+        captureStats.captured++;
+        // only send audio if hotword_detection is HW_REMOTE.
+        //TODO when LOCAL is supported: check if hotword is detected and send audio as well in that case
+        if (config.hotword_detection == HW_REMOTE) {
+          if (frame->adpcm) {
+            // a new header starts a new stream
+            if (encoderSerial != frame->headerSerial) {
+              adpcmEncoder.reset();
+              encoderSerial = frame->headerSerial;
             }
+            encodeAudioFrame(frame, captureSamples, audioFrameBytes / 2);
           }
-        } else {
-          //Loop, because otherwise this causes timeouts
-          audioServer.loop();
+          queueAudioFrame(frame, (const int16_t *)samples, audioFrameBytes / 2);
+        } else if (frame == &overrunFrame) {
+          captureStats.dropped++;
         }
       } else {
+        captureStats.readFailures++;
+      }
+      if (locked) {
+        xSemaphoreGive(wbSemaphore);
+      }
+    } else {
+      vTaskDelay(10);
+    }
+  }
+  vTaskDelete(NULL);
+}
+
+// Drains the frames queued by CaptureTask to the MQTT server
+void PublishTask(void *p) {
+  uint32_t reportedDrops = 0;
+  unsigned long statsPublished = millis();
+  while (1) {
+    if (audioServer.connected()) {
+      AudioFrame *frame = frontFrame(audioFrames, config.drop_policy, config.drop_ms, esp_timer_get_time(), captureStats.dropped);
+      if (frame != NULL) {
+        //A frame is split into messages of frame_ms, i.e. the Matrix Voice reads 512 16 bit
+        //samples in one mic read, with 16 ms this is sent as two messages of 512 bytes
+        const int messageBytes = frame->messageLength;
+        const int message_count = frame->length / messageBytes;
+        const int64_t start = esp_timer_get_time();
+        for (int i = 0; i < message_count; i++) {
+          if (!publishAudioFrame(*frame, messageBytes * i, messageBytes)) {
+            captureStats.publishFailures++;
+          }
+        }
+        recordPublishTime((esp_timer_get_time() - start) / 1000);
+        if (config.audio_stats) {
+          publishAudioStats(*frame, message_count);
+        }
+        audioFrames.release();
+        captureStats.published++;
+        xTaskNotifyGive(captureHandle);
+      } else if (!referenceFrames.isEmpty()) {
+        // the mic frames go first, the reference is only for later processing
+        publishReferenceFrame(*referenceFrames.front());
+        referenceFrames.release();
+      } else {
+        if (captureStats.dropped != reportedDrops) {
+          reportedDrops = captureStats.dropped;
+          Serial.printf("Capture dropped %u frames so far\r\n", reportedDrops);
+        }
+        //Loop, because otherwise this causes timeouts
+        audioServer.loop();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+      }
+      if (config.audio_stats && millis() - statsPublished >= 10000) {
+        statsPublished = millis();
+        if (!publishText(captureStatsTopic, captureStatsJson())) {
+          captureStats.publishFailures++;
+        }
+        if (!publishText(playbackStatsTopic, playbackStatsJson())) {
+          captureStats.publishFailures++;
+        }
+      }
+    } else {
+      audioFrames.clear();
+      referenceFrames.clear();
+      if (xEventGroupGetBits(audioGroup) & STREAM) {
         xEventGroupClearBits(audioGroup, STREAM);
         send_event(MQTTDisconnectedEvent());
       }
-      xSemaphoreGive(wbSemaphore); 
+      vTaskDelay(10);
     }
-
-    //Added for stability when neither PLAY or STREAM is set.
-    vTaskDelay(10);
-
-  }  
+  }
   vTaskDelete(NULL);
 }
 
@@ -651,7 +1227,13 @@ void initHeader(int readSize, int width, int rate) {
     strncpy(header.fmt_tag, "fmt ", 4);
     strncpy(header.data_tag, "data", 4);
 
-    header.riff_length = (uint32_t)sizeof(header) + (readSize * width);
+    const int frame_ms = isValidFrameMs(config.frame_ms) ? config.frame_ms : 16;
+    const AudioFrameLayout layout(readSize * width, rate * width, frame_ms, AUDIO_FRAME_MAX_BYTES);
+    const int messageBytes = layout.messageBytes;
+    audioFrameBytes = layout.frameBytes;
+
+    // RIFF length counts everything after the riff_length field
+    header.riff_length = (uint32_t)sizeof(header) - 8 + messageBytes;
     header.fmt_length = 16;
     header.audio_format = 1;
     header.num_channels = 1;
@@ -659,7 +1241,143 @@ void initHeader(int readSize, int width, int rate) {
     header.byte_rate = rate * width;
     header.block_align = width;
     header.bits_per_sample = width * 8;
-    header.data_length = readSize * width;
+    header.data_length = messageBytes;
+
+    // ADPCM encodes each message into one block, for 16 bit mono only
+    adpcmFrames = config.adpcm && width == 2;
+    const int blockSamples = messageBytes / width;
+    const int blockSize = ImaAdpcmEncoder::blockSize(blockSamples);
+    const int blockFrames = ImaAdpcmEncoder::samplesPerBlock(blockSamples);
+    strncpy(adpcmHeader.riff_tag, "RIFF", 4);
+    strncpy(adpcmHeader.wave_tag, "WAVE", 4);
+    strncpy(adpcmHeader.fmt_tag, "fmt ", 4);
+    strncpy(adpcmHeader.fact_tag, "fact", 4);
+    strncpy(adpcmHeader.data_tag, "data", 4);
+    adpcmHeader.riff_length = (uint32_t)sizeof(adpcmHeader) - 8 + blockSize;
+    adpcmHeader.fmt_length = 20;
+    adpcmHeader.audio_format = 0x11;
+    adpcmHeader.num_channels = 1;
+    adpcmHeader.sample_rate = rate;
+    adpcmHeader.byte_rate = rate * blockSize / blockFrames;
+    adpcmHeader.block_align = blockSize;
+    adpcmHeader.bits_per_sample = 4;
+    adpcmHeader.extra_length = 2;
+    adpcmHeader.samples_per_block = blockFrames;
+    adpcmHeader.fact_length = 4;
+    adpcmHeader.sample_length = blockFrames;
+    adpcmHeader.data_length = blockSize;
+
+    headerSerial++;
+}
+
+// Header of the reference frames, the format of the audio being played
+void initReferenceHeader(int rate, int bits, int channels) {
+    flushReference();
+    strncpy(referenceHeader.riff_tag, "RIFF", 4);
+    strncpy(referenceHeader.wave_tag, "WAVE", 4);
+    strncpy(referenceHeader.fmt_tag, "fmt ", 4);
+    strncpy(referenceHeader.data_tag, "data", 4);
+    referenceHeader.fmt_length = 16;
+    referenceHeader.audio_format = 1;
+    referenceHeader.num_channels = channels;
+    referenceHeader.sample_rate = rate;
+    referenceHeader.block_align = channels * bits / 8;
+    referenceHeader.byte_rate = rate * referenceHeader.block_align;
+    referenceHeader.bits_per_sample = bits;
+    referenceCapacity = AUDIO_FRAME_MAX_BYTES - AUDIO_FRAME_MAX_BYTES % std::max((int)referenceHeader.block_align, 1);
+}
+
+// Appends played audio to the reference frame being filled, full frames go to PublishTask
+void queueReference(const uint8_t *data, size_t len) {
+    while (len > 0) {
+        ReferenceFrame *frame = referenceFrames.acquire();
+        if (frame == NULL) {
+            captureStats.referenceDropped++;
+            return;
+        }
+        if (referenceFill == 0) {
+            frame->header = referenceHeader;
+        }
+        const size_t n = std::min(len, referenceCapacity - referenceFill);
+        memcpy(&frame->data[referenceFill], data, n);
+        referenceFill += n;
+        data += n;
+        len -= n;
+        if (referenceFill == referenceCapacity) {
+            flushReference();
+        }
+    }
+}
+
+// Hands the partly filled reference frame to PublishTask
+void flushReference() {
+    ReferenceFrame *frame = referenceFrames.acquire();
+    if (frame != NULL && referenceFill > 0) {
+        frame->length = referenceFill;
+        frame->header.riff_length = (uint32_t)sizeof(frame->header) - 8 + referenceFill;
+        frame->header.data_length = referenceFill;
+        referenceFrames.commit();
+        xTaskNotifyGive(publishHandle);
+    }
+    referenceFill = 0;
+}
+
+bool publishReferenceFrame(const ReferenceFrame &frame) {
+    const size_t len = sizeof(frame.header) + frame.length;
+    if (!audioServer.beginPublish(audioReferenceTopic.c_str(), len, false)) {
+        return false;
+    }
+    const size_t written = audioServer.write((const uint8_t *)&frame.header, len);
+    return audioServer.endPublish() == 1 && written == len;
+}
+
+// Streams header and samples straight from the frame to the socket, PubSubClient::publish
+// would first copy the whole message into its own buffer
+bool publishAudioFrame(const AudioFrame &frame, size_t offset, size_t len) {
+    if (!audioServer.beginPublish(audioFrameTopic.c_str(), frame.headerLength + len, false)) {
+        return false;
+    }
+    size_t written;
+    if (offset == 0) {
+        // header and samples are contiguous, so this is a single write
+        written = audioServer.write(frame.message(), frame.headerLength + len);
+    } else {
+        written = audioServer.write(frame.message(), frame.headerLength);
+        written += audioServer.write(&frame.data[offset], len);
+    }
+    return audioServer.endPublish() == 1 && written == frame.headerLength + len;
+}
+
+// Streams a text message like publishAudioFrame, PubSubClient::publish fails on anything
+// larger than its buffer (256 bytes by default), as the stats are
+bool publishText(const std::string &topic, const std::string &message) {
+    if (!audioServer.beginPublish(topic.c_str(), message.size(), false)) {
+        return false;
+    }
+    const size_t written = audioServer.write((const uint8_t *)message.data(), message.size());
+    return audioServer.endPublish() == 1 && written == message.size();
+}
+
+// Microseconds since the epoch, once SNTP has synced, since boot before that
+int64_t wallClockMicros() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// Sequence and capture time of a frame, published on the audio connection right behind its
+// messages, so the host sees them in the same order
+void publishAudioStats(const AudioFrame &frame, int messages) {
+    char message[160];
+    // 2020-01-01, anything before means the clock is not synced yet
+    const bool synced = frame.captureTime > 1577836800LL * 1000000;
+    snprintf(message, sizeof(message),
+        "{\"seq\":%u,\"captured_us\":%lld,\"synced\":%s,\"messages\":%d,\"bytes\":%u,\"dropped\":%u}",
+        frame.sequence, (long long)frame.captureTime, synced ? "true" : "false", messages,
+        (unsigned)frame.length, (unsigned)captureStats.dropped);
+    if (!publishText(audioStatsTopic, message)) {
+        captureStats.publishFailures++;
+    }
 }
 
 void WiFiEvent(WiFiEvent_t event) {
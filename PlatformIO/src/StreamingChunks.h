@@ -0,0 +1,187 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Puts the chunks of playBytesStreaming requests back in order
+ *
+ * Chunks are played in the order of their index, early ones wait for the missing one, at
+ * most MAX_PENDING_CHUNKS of them in MAX_PENDING_BYTES. Past the count the missing chunk is
+ * given up on. A chunk which does not fit into the bytes is dropped, and the missing chunk
+ * is given up on right away to free the memory. Chunks may arrive in parts, one message
+ * after the other.
+ *
+ * A new request ends the one before, as does takeOver() when a playBytes request starts.
+ * Chunks of an ended request are ignored, those of the request before the last one as well.
+ *
+ * What to play goes to a Player:
+ *   play(data, len, chunkStart, requestStart)  samples, or with chunkStart the start of a
+ *                                              chunk with its WAV header, with requestStart
+ *                                              the first chunk played of the request
+ *   finish()                                   the request is over or ended
+ *   lost(chunkIndex, dropped)                  a chunk which will not be played
+ * Plain C++, so it builds on the host as well.
+ */
+class StreamingChunks
+{
+public:
+    static const size_t MAX_PENDING_CHUNKS = 8;
+    static const size_t MAX_PENDING_BYTES = 32 * 1024;
+
+private:
+    std::string request;
+    std::string previousRequest;
+    bool ended = true;
+    int firstChunk = 0;
+    int nextChunk = 0;
+    int lastChunk = -1;
+    int droppedChunk = -1;
+    std::map<int, std::vector<uint8_t>> pending;
+    size_t pendingBytes = 0;
+
+    // Keeps a part of a chunk which came early, false if the chunk did not fit and was dropped
+    bool hold(int chunkIndex, const uint8_t *payload, size_t len, size_t index)
+    {
+        auto chunk = pending.find(chunkIndex);
+        if (index == 0)
+        {
+            // the start of a chunk, whatever a repeat of it left is replaced
+            if (chunk == pending.end())
+            {
+                chunk = pending.emplace(chunkIndex, std::vector<uint8_t>()).first;
+            }
+            pendingBytes -= chunk->second.size();
+            chunk->second.clear();
+        }
+        if (chunk == pending.end())
+        {
+            // its start was missed, this part is no use
+            return true;
+        }
+        if (pendingBytes + len > MAX_PENDING_BYTES)
+        {
+            pendingBytes -= chunk->second.size();
+            pending.erase(chunk);
+            return false;
+        }
+        chunk->second.insert(chunk->second.end(), payload, payload + len);
+        pendingBytes += len;
+        return true;
+    }
+
+    void forget()
+    {
+        pending.clear();
+        pendingBytes = 0;
+        ended = true;
+    }
+
+public:
+    /* The request being played, or the last one */
+    const std::string &requestId() { return request; }
+
+    /* Bytes of the chunks waiting for a missing one */
+    size_t pendingSize() { return pendingBytes; }
+
+    /* Number of chunks waiting for a missing one */
+    size_t pendingChunks() { return pending.size(); }
+
+    /* Another request took over the playback, the rest of this one is not played */
+    void takeOver() { forget(); }
+
+    /* A part of a message on playBytesStreaming/<requestId>/<chunkIndex>/<isLastChunk>, at
+     * index of total bytes */
+    template <typename Player>
+    void receive(const std::string &requestId, int chunkIndex, bool isLastChunk, const uint8_t *payload, size_t len, size_t index, size_t total, Player &player)
+    {
+        if (requestId == previousRequest)
+        {
+            // a late chunk of a request which another one ended
+            return;
+        }
+        if (requestId != request)
+        {
+            previousRequest = request;
+            request = requestId;
+            ended = false;
+            firstChunk = 0;
+            nextChunk = 0;
+            lastChunk = -1;
+            droppedChunk = -1;
+            pending.clear();
+            pendingBytes = 0;
+            // a request still open is not continued anymore, play what it got
+            player.finish();
+        }
+        if (ended || chunkIndex < nextChunk || (lastChunk >= 0 && chunkIndex > lastChunk))
+        {
+            // a repeated chunk, one after the end or of a request taken over
+            return;
+        }
+
+        if (chunkIndex == droppedChunk)
+        {
+            // the rest of a chunk which did not fit
+        }
+        else if (chunkIndex == nextChunk)
+        {
+            // only the first part of a chunk starts with its header
+            player.play(payload, len, index == 0, index == 0 && nextChunk == firstChunk);
+        }
+        else if (!hold(chunkIndex, payload, len, index))
+        {
+            player.lost(chunkIndex, true);
+            droppedChunk = chunkIndex;
+        }
+        // a dropped chunk frees its memory right away, not once it is complete
+        if (len + index < total && chunkIndex != droppedChunk)
+        {
+            return;
+        }
+
+        if (isLastChunk && len + index >= total)
+        {
+            lastChunk = chunkIndex;
+        }
+        if (chunkIndex == nextChunk)
+        {
+            nextChunk++;
+        }
+        else if (!pending.empty() && (pending.size() > MAX_PENDING_CHUNKS || chunkIndex == droppedChunk))
+        {
+            // the missing chunk is not coming anymore, or waiting for it holds too much memory,
+            // play on with the earliest one received
+            player.lost(nextChunk, false);
+            if (nextChunk == firstChunk)
+            {
+                firstChunk = pending.begin()->first;
+            }
+            nextChunk = pending.begin()->first;
+        }
+        // play the chunks which waited for this one, everything pending is complete by now.
+        // The dropped chunk is skipped
+        while (true)
+        {
+            auto next = pending.find(nextChunk);
+            if (next != pending.end())
+            {
+                player.play(next->second.data(), next->second.size(), true, nextChunk == firstChunk);
+                pendingBytes -= next->second.size();
+                pending.erase(next);
+            }
+            else if (nextChunk != droppedChunk)
+            {
+                break;
+            }
+            nextChunk++;
+        }
+        if (lastChunk >= 0 && nextChunk > lastChunk)
+        {
+            forget();
+            player.finish();
+        }
+    }
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Hides playback underruns behind short fades
+ *
+ * Runs on the 16 bit samples going to the device. When the stream runs dry, conceal() fills
+ * the gap with the last frame played, fading it to silence over FADE_FRAMES, instead of
+ * cutting off mid waveform. Once samples come again they fade back in at the same pace.
+ * Both fades move one envelope, so a gap shorter than a fade turns back from the level it
+ * reached, whatever the sizes of the blocks around the gap are.
+ */
+class UnderrunConcealer
+{
+    static const int FADE_FRAMES = 64;
+    static const int MAX_CHANNELS = 2;
+
+    int16_t last[MAX_CHANNELS] = {0, 0};
+    int level = FADE_FRAMES; // envelope, FADE_FRAMES plays at full level
+    bool concealing = false;
+
+public:
+    /* A new stream starts at full level */
+    void reset()
+    {
+        last[0] = last[1] = 0;
+        level = FADE_FRAMES;
+        concealing = false;
+    }
+
+    /* true between conceal() and the next samples played */
+    bool isConcealing() { return concealing; }
+
+    /* Samples about to be played, fades them in after a gap and keeps the last frame */
+    void play(int16_t *samples, size_t frames, int channels)
+    {
+        if (frames == 0)
+        {
+            return;
+        }
+        concealing = false;
+        for (int c = 0; c < channels && c < MAX_CHANNELS; c++)
+        {
+            last[c] = samples[(frames - 1) * channels + c];
+        }
+        for (size_t f = 0; f < frames && level < FADE_FRAMES; f++)
+        {
+            level++;
+            const int32_t gain = level * 32768 / FADE_FRAMES;
+            for (int c = 0; c < channels; c++)
+            {
+                samples[f * channels + c] = (samples[f * channels + c] * gain) >> 15;
+            }
+        }
+    }
+
+    /* Writes frames of fill for a gap in the stream to out */
+    void conceal(int16_t *out, size_t frames, int channels)
+    {
+        concealing = true;
+        for (size_t f = 0; f < frames; f++)
+        {
+            level = level > 0 ? level - 1 : 0;
+            const int32_t gain = level * 32768 / FADE_FRAMES;
+            for (int c = 0; c < channels; c++)
+            {
+                out[f * channels + c] = (last[c < MAX_CHANNELS ? c : 0] * gain) >> 15;
+            }
+        }
+    }
+};
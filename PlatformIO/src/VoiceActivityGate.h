@@ -0,0 +1,144 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Cheap fixed-point voice activity detector for 16 bit mono frames
+ *
+ * A frame counts as voice when its mean magnitude is well above the tracked noise floor
+ * and it does not cross zero as often as broadband noise does. A detection is held for
+ * a hangover time, so the gaps between words do not close the gate.
+ */
+class VoiceActivityDetector
+{
+    // the level must exceed the noise floor by this factor (Q4, 48 = 3.0 or about 10 dB)
+    static const uint32_t SNR_Q4 = 48;
+    // mean magnitude which is always silence (about -55 dBFS)
+    static const uint32_t MIN_LEVEL = 60;
+    // quiet frames crossing zero more often than this (per thousand samples) are noise
+    static const uint32_t MAX_ZCR = 450;
+    static const int HANGOVER_MS = 800;
+    // the noise floor rises with a time constant of about this, and falls much faster
+    static const int FLOOR_RISE_MS = 5000;
+
+    uint32_t floorQ4 = 32767 << 4; // start high, the floor drops to the real noise within a few frames
+    int holdMs = 0;
+    int16_t last = 0;
+
+public:
+    /* Analyse one frame, returns true while voice is detected */
+    bool process(const int16_t *samples, size_t count, int frame_ms)
+    {
+        if (count == 0)
+        {
+            return holdMs > 0;
+        }
+        uint32_t sum = 0;
+        uint32_t crossings = 0;
+        int16_t prev = last;
+        for (size_t i = 0; i < count; i++)
+        {
+            const int16_t x = samples[i];
+            sum += (x < 0) ? -(int32_t)x : x;
+            crossings += ((x ^ prev) < 0);
+            prev = x;
+        }
+        last = prev;
+
+        const uint32_t levelQ4 = (sum / count) << 4;
+        const uint32_t zcr = crossings * 1000 / count;
+        const bool loud = levelQ4 * 16 > floorQ4 * SNR_Q4 && levelQ4 > (MIN_LEVEL << 4);
+        const bool voice = loud && (zcr < MAX_ZCR || levelQ4 * 16 > floorQ4 * SNR_Q4 * 4);
+
+        // follow the noise quickly down and slowly up, so speech hardly moves the floor
+        if (levelQ4 < floorQ4)
+        {
+            floorQ4 -= (floorQ4 - levelQ4) >> 2;
+        }
+        else
+        {
+            int shift = 0;
+            while ((frame_ms << (shift + 1)) <= FLOOR_RISE_MS)
+            {
+                shift++;
+            }
+            floorQ4 += (levelQ4 - floorQ4) >> shift;
+        }
+
+        if (voice)
+        {
+            holdMs = HANGOVER_MS;
+        }
+        else if (holdMs > 0)
+        {
+            holdMs -= frame_ms;
+        }
+        return voice || holdMs > 0;
+    }
+};
+
+/**
+ * @brief Byte FIFO keeping the most recent audio while the voice activity gate is closed
+ *
+ * When full, pushing overwrites the oldest bytes. The capacity is kept a multiple of the
+ * frame length, so frames never wrap half way.
+ */
+template <size_t S>
+class PrerollBuffer
+{
+    uint8_t buffer[S];
+    size_t cap = 0;
+    size_t start = 0;
+    size_t fill = 0;
+
+public:
+    /* Drop the content and change the usable capacity (at most S) */
+    void reset(size_t capacity)
+    {
+        cap = (capacity < S) ? capacity : S;
+        start = 0;
+        fill = 0;
+    }
+
+    /* Append len bytes, returns the number of bytes overwritten or not stored */
+    size_t push(const uint8_t *data, size_t len)
+    {
+        if (len > cap)
+        {
+            return len;
+        }
+        size_t lost = 0;
+        if (fill + len > cap)
+        {
+            lost = fill + len - cap;
+            start = (start + lost) % cap;
+            fill -= lost;
+        }
+        size_t end = (start + fill) % cap;
+        const size_t first = (len < cap - end) ? len : cap - end;
+        memcpy(&buffer[end], data, first);
+        memcpy(buffer, &data[first], len - first);
+        fill += len;
+        return lost;
+    }
+
+    /* Remove the oldest len bytes into data, returns false if less than len bytes are stored */
+    bool pop(uint8_t *data, size_t len)
+    {
+        if (len > fill)
+        {
+            return false;
+        }
+        const size_t first = (len < cap - start) ? len : cap - start;
+        memcpy(data, &buffer[start], first);
+        memcpy(&data[first], buffer, len - first);
+        start = (start + len) % cap;
+        fill -= len;
+        return true;
+    }
+
+    size_t capacity() { return cap; }
+    size_t size() { return fill; }
+    bool isEmpty() { return fill == 0; }
+};
@@ -0,0 +1,84 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * @brief Software volume for devices without a volume control of their own
+ *
+ * Multiplies 16 bit samples with a Q15 gain, 32768 being unity. The volume of 0 - 100 maps
+ * to the gain by its square, which sounds closer to even steps than a linear gain. A new
+ * volume does not jump, the gain ramps to it over RAMP_FRAMES frames, carried on across
+ * blocks, so a change during playback does not click. The first block starts at the volume
+ * set by then, nothing has played at another one. setVolume may be called from another task
+ * than process.
+ */
+class VolumeRamp
+{
+    static const int RAMP_FRAMES = 256;
+    // the gain is kept with 8 more fractional bits, so short ramps still move in even steps
+    static const int RAMP_SHIFT = 8;
+
+    std::atomic<int32_t> target{32768};
+    int32_t rampTarget = 32768;
+    int32_t current = 32768 << RAMP_SHIFT;
+    int32_t step = 0;
+    bool started = false;
+
+    static inline int16_t scale(int16_t sample, int32_t gain)
+    {
+        const int32_t scaled = (sample * gain) >> 15;
+        return scaled > 32767 ? 32767 : (scaled < -32768 ? -32768 : scaled);
+    }
+
+public:
+    void setVolume(int volume)
+    {
+        volume = volume < 0 ? 0 : (volume > 100 ? 100 : volume);
+        target = volume * volume * 32768 / 10000;
+    }
+
+    /* Applies the volume to frames of interleaved samples in place */
+    void process(int16_t *samples, size_t frames, int channels)
+    {
+        const int32_t goal = target;
+        if (!started)
+        {
+            started = true;
+            rampTarget = goal;
+            current = goal << RAMP_SHIFT;
+        }
+        else if (goal != rampTarget)
+        {
+            rampTarget = goal;
+            step = ((goal << RAMP_SHIFT) - current) / RAMP_FRAMES;
+            step = step != 0 ? step : ((goal << RAMP_SHIFT) > current ? 1 : -1);
+        }
+        const int32_t end = rampTarget << RAMP_SHIFT;
+        size_t f = 0;
+        // frame by frame while ramping
+        for (; f < frames && current != end; f++)
+        {
+            current += step;
+            if ((step > 0 && current > end) || (step < 0 && current < end))
+            {
+                current = end;
+            }
+            const int32_t gain = current >> RAMP_SHIFT;
+            for (int c = 0; c < channels; c++)
+            {
+                samples[f * channels + c] = scale(samples[f * channels + c], gain);
+            }
+        }
+        // the rest of the block at the final gain
+        const int32_t gain = current >> RAMP_SHIFT;
+        if (gain == 32768)
+        {
+            return;
+        }
+        for (size_t i = f * channels; i < frames * channels; i++)
+        {
+            samples[i] = scale(samples[i], gain);
+        }
+    }
+};
@@ -47,10 +47,17 @@ class Device {
     virtual void muteOutput(bool mute) {};
     //Some devices have multiple outputs (jack/speeker)
     virtual void ampOutput(int output) {};
-    //Some devices support settings of volume
+    //Some devices support settings of volume, override hasVolumeControl too, otherwise the volume is applied in software
     virtual void setVolume(uint16_t volume) {};
+    virtual bool hasVolumeControl() {return false;};
     //Possiblity to set gain
     virtual void setGain(uint16_t gain) {};
+    //Devices which resample playback can trade CPU for quality, 0 - 10, -1 is the device default
+    virtual void setResamplerQuality(int quality) {};
+    //Devices with a mic array can steer it, degrees < 0 listens in all directions
+    virtual void setBeamDirection(int degrees) {};
+    //Devices with separate ports for mic and speaker can capture while playing, override to return true
+    virtual bool isFullDuplex() {return false;};
     //You can use this method to activated the hotword state (i.e. a hardware button)
     virtual bool isHotwordDetected() {return false;};
 
@@ -60,6 +67,8 @@ class Device {
     //You can override these in your device
     int readSize = 256;
     int writeSize = 256;
+    //Channels writeAudio expects, 0 takes the channels of the stream. Playback is always 16 bit
+    int writeChannels = 0;
     int width = 2;
     int rate = 16000;
 };
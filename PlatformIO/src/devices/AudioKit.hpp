@@ -6,7 +6,10 @@
 #include <AC101.h>
 #include <Wire.h>
 #include <IndicatorLight.h>
+#include <atomic>
 #include "ES8388Control.h"
+#include "PolyphaseResampler.h"
+#include "speex_resampler.h"
 
 // I2S pins
 #define CONFIG_I2S_BCK_PIN 27
@@ -54,6 +57,17 @@
 
 #define SPEAKER_I2S_NUMBER I2S_NUM_0
 
+// ES8388: the mic runs at the playback rate and is decimated to this
+#define CAPTURE_RATE 16000
+// codec frames of one mic read
+const int CAPTURE_BLOCK_FRAMES = 256;
+// lowest playback rate the mic can follow, below it is upsampled
+#define CAPTURE_MIN_RATE 8000
+// speex takes the rates without a decimation filter, good enough for speech
+#define CAPTURE_SPEEX_QUALITY 3
+// after a pause in reading this long, what the RX DMA still holds is stale
+#define CAPTURE_STALE_MS 100
+
 
 class AudioKit : public Device
 {
@@ -74,13 +88,20 @@ public:
     // TODO
     void ampOutput(int output);
     void setVolume(uint16_t volume);
+    bool hasVolumeControl() { return true; };
 
     bool isHotwordDetected();
 
+    // the ES8388 captures while playing
+    bool isFullDuplex() { return is_es; };
+
     int numAmpOutConfigurations() { return 3; };
 
 private:
     void InitI2SSpeakerOrMic(int mode);
+    void setClock(int sampleRate);
+    void dropStaleCapture();
+    bool readDecimated();
     AC101 ac;
     ES8388Control es8388;
 
@@ -88,10 +109,24 @@ private:
     AmpOut out_amp = AMP_OUT_SPEAKERS;
 
     bool is_es = false;
-    bool is_mono_stream_stereo_out = false;
     uint16_t key_listen;
 
     IndicatorLight *indicator_light = new IndicatorLight(LED_STREAM);
+
+    // ES8388: one port plays and captures, so the mic follows the playback rate. Set by the
+    // playback task under clockLock, which the capture task holds while it reads, so a block
+    // is never read across a rate change and the decimator always knows its rate
+    SemaphoreHandle_t clockLock = NULL;
+    std::atomic<int> clockRate{0};
+    int decimatorRate = 0;
+    PolyphaseResampler<CAPTURE_BLOCK_FRAMES> decimator;
+    SpeexResamplerState *captureResampler = NULL;
+    int16_t captureBlock[CAPTURE_BLOCK_FRAMES * 2];
+    // mic samples at CAPTURE_RATE, not yet returned by readAudio
+    int16_t decimated[CAPTURE_BLOCK_FRAMES * CAPTURE_RATE / CAPTURE_MIN_RATE + 1];
+    size_t decimatedStart = 0;
+    size_t decimatedEnd = 0;
+    unsigned long lastCaptureRead = 0;
 };
 
 AudioKit::AudioKit(){};
@@ -103,6 +138,8 @@ void AudioKit::init()
     if ((is_es = es8388.begin(ES_IIC_DATA, ES_IIC_CLK)) == true)
     {
         Serial.println("found ES8388Control");
+        // es8388 requires stereo i2s
+        writeChannels = 2;
     }
     else
     {
@@ -132,6 +169,15 @@ void AudioKit::init()
     // pinMode(KEY_VOL_UP, INPUT_PULLUP);
     // pinMode(KEY_VOL_DOWN, INPUT_PULLUP);
 
+    if (is_es)
+    {
+        // installed once, the rate follows the playback from here
+        clockLock = xSemaphoreCreateMutex();
+        InitI2SSpeakerOrMic(MODE_SPK);
+        setClock(CAPTURE_RATE);
+        int err;
+        captureResampler = speex_resampler_init(1, CAPTURE_RATE, CAPTURE_RATE, CAPTURE_SPEEX_QUALITY, &err);
+    }
     // now initialize read mode 
     // setReadMode();
 };
@@ -172,7 +218,7 @@ void AudioKit::updateColors(int colors)
 
 void AudioKit::InitI2SSpeakerOrMic(int mode)
 {
-    Serial.printf("InitI2SSpeakerOrMic -> %s\n", mode == MODE_MIC ? "Mic" : "Speaker");
+    Serial.printf("InitI2SSpeakerOrMic -> %s\n", is_es ? "Mic and Speaker" : (mode == MODE_MIC ? "Mic" : "Speaker"));
     esp_err_t err = ESP_OK;
 
     i2s_driver_uninstall(SPEAKER_I2S_NUMBER);
@@ -186,7 +232,13 @@ void AudioKit::InitI2SSpeakerOrMic(int mode)
         .dma_buf_count = 8,
         .dma_buf_len = (((mode == MODE_MIC) ? this->readSize : this->writeSize) * (is_es ? 2 : 1)) / 4,
     };
-    if (mode == MODE_MIC)
+    if (is_es)
+    {
+        i2s_config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX | I2S_MODE_RX);
+        i2s_config.tx_desc_auto_clear = true;
+        i2s_config.dma_buf_len = CAPTURE_BLOCK_FRAMES;
+    }
+    else if (mode == MODE_MIC)
     {
         i2s_config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX);
     }
@@ -226,8 +278,31 @@ void AudioKit::InitI2SSpeakerOrMic(int mode)
     return;
 }
 
+// ES8388 only, the port always runs 16 bit stereo. Waits for the mic read in progress, the
+// mic samples still queued at the old rate are zeroed, which costs a few ms of silence
+void AudioKit::setClock(int sampleRate)
+{
+    if (sampleRate != clockRate)
+    {
+        xSemaphoreTake(clockLock, portMAX_DELAY);
+        i2s_set_clk(SPEAKER_I2S_NUMBER, sampleRate, I2S_BITS_PER_SAMPLE_16BIT, I2S_CHANNEL_STEREO);
+        i2s_zero_dma_buffer(SPEAKER_I2S_NUMBER);
+        clockRate = sampleRate;
+        xSemaphoreGive(clockLock);
+    }
+}
+
 void AudioKit::setWriteMode(int sampleRate, int bitDepth, int numChannels)
 {
+    if (is_es)
+    {
+        // no reinstall, the mic keeps running at the new rate
+        if (sampleRate > 0)
+        {
+            setClock(sampleRate);
+        }
+        return;
+    }
     if (mode != MODE_SPK)
     {
         InitI2SSpeakerOrMic(MODE_SPK);
@@ -235,22 +310,17 @@ void AudioKit::setWriteMode(int sampleRate, int bitDepth, int numChannels)
     }
     if (sampleRate > 0)
     {
-        if (is_es)
-        {
-            // es8388 requires stereo i2s
-            i2s_set_clk(SPEAKER_I2S_NUMBER, sampleRate, static_cast<i2s_bits_per_sample_t>(bitDepth), I2S_CHANNEL_STEREO);
-        }
-        else
-        {
-            i2s_set_clk(SPEAKER_I2S_NUMBER, sampleRate, static_cast<i2s_bits_per_sample_t>(bitDepth), static_cast<i2s_channel_t>(numChannels));
-        }
-        // ES8388Control is never put into mono mode, hence we have to handle this case
-        is_mono_stream_stereo_out = is_es && numChannels == 1;
+        i2s_set_clk(SPEAKER_I2S_NUMBER, sampleRate, static_cast<i2s_bits_per_sample_t>(bitDepth), static_cast<i2s_channel_t>(numChannels));
     }
 }
 
 void AudioKit::setReadMode()
 {
+    if (is_es)
+    {
+        // the mic runs all the time
+        return;
+    }
     if (mode != MODE_MIC)
     {
         InitI2SSpeakerOrMic(MODE_MIC);
@@ -263,57 +333,112 @@ void AudioKit::setReadMode()
 
 void AudioKit::writeAudio(uint8_t *data, size_t size, size_t *bytes_written)
 {
-    if (is_mono_stream_stereo_out == false)
-    {
-        // input stream and I2S confguration have same number of channels
-        i2s_write(SPEAKER_I2S_NUMBER, data, size, bytes_written, portMAX_DELAY);      
-    }
-    else
+    // the playback converter already made mono streams stereo for the es8388
+    i2s_write(SPEAKER_I2S_NUMBER, data, size, bytes_written, portMAX_DELAY);
+}
+
+// Empties the RX DMA when the mic has not been read for a while, i.e. when capture resumes
+// after a playback in half duplex, so the audio captured meanwhile is not published late.
+// The ES8388 also drops its decimated samples and restarts the decimator from silence.
+void AudioKit::dropStaleCapture()
+{
+    if (millis() - lastCaptureRead > CAPTURE_STALE_MS)
     {
-        // input stream is mono, I2S needs stereo, hence samples are send
-        // twice to I2S stream to create 2 channels
-        // HACK: This works ATM only for 16bit samples as sample size is hardcoded
-        // here
-        uint16_t data2[size];
-        uint16_t *data1 = (uint16_t *)data;
-
-        for (int idx = 0; idx < size / 2; idx++)
+        if (is_es)
         {
-            data2[2 * idx] = data1[idx];
-            data2[2 * idx + 1] = data1[idx];
-            
+            xSemaphoreTake(clockLock, portMAX_DELAY);
         }
-
-        i2s_write(SPEAKER_I2S_NUMBER, data2, 2 * size, bytes_written, portMAX_DELAY);
-        *bytes_written /= 2; // half the actual bytes written as we have double the stream size
+        size_t byte_read;
+        do
+        {
+            i2s_read(SPEAKER_I2S_NUMBER, captureBlock, sizeof(captureBlock), &byte_read, 0);
+        } while (byte_read == sizeof(captureBlock));
+        if (is_es)
+        {
+            xSemaphoreGive(clockLock);
+        }
+        decimatedStart = decimatedEnd = 0;
+        decimatorRate = 0;
     }
+    lastCaptureRead = millis();
 }
 
 bool AudioKit::readAudio(uint8_t *data, size_t size)
 {
-    size_t byte_read;
-
+    dropStaleCapture();
     if (!is_es)
     {
+        size_t byte_read;
         i2s_read(SPEAKER_I2S_NUMBER, data, size, &byte_read, pdMS_TO_TICKS(100));
+        return byte_read == size;
     }
-    else
+
+    // the codec reads do not line up with size, what is left over goes with the next call
+    int16_t *samples = (int16_t *)data;
+    size_t remaining = size / sizeof(int16_t);
+    while (remaining > 0)
     {
-        // ES8388Control returns stereo stream from Mic, but we need only one channel, 
-        // we drop channel 2 (right channel) here
-        uint16_t data2[size];
-        uint16_t *data1 = (uint16_t *)data;
+        if (decimatedStart == decimatedEnd && !readDecimated())
+        {
+            return false;
+        }
+        const size_t count = std::min(remaining, decimatedEnd - decimatedStart);
+        memcpy(samples, &decimated[decimatedStart], count * sizeof(int16_t));
+        decimatedStart += count;
+        samples += count;
+        remaining -= count;
+    }
+    return true;
+}
 
-        i2s_read(SPEAKER_I2S_NUMBER, data2, 2 * size, &byte_read, pdMS_TO_TICKS(100));
+// Reads one block from the ES8388 and takes it to CAPTURE_RATE mono into decimated
+bool AudioKit::readDecimated()
+{
+    // the rate can not change while the block is read
+    xSemaphoreTake(clockLock, portMAX_DELAY);
+    const int sampleRate = clockRate;
+    size_t byte_read;
+    i2s_read(SPEAKER_I2S_NUMBER, captureBlock, sizeof(captureBlock), &byte_read, pdMS_TO_TICKS(100));
+    xSemaphoreGive(clockLock);
 
-        for (size_t idx = 0; idx < size / 2; idx++)
+    if (sampleRate != decimatorRate)
+    {
+        if (sampleRate != CAPTURE_RATE && !decimator.setRates(sampleRate, CAPTURE_RATE, 1))
         {
-            data1[idx] = data2[idx * 2];
+            speex_resampler_set_rate(captureResampler, sampleRate, CAPTURE_RATE);
+            speex_resampler_reset_mem(captureResampler);
+            speex_resampler_skip_zeros(captureResampler);
         }
-        byte_read /= 2;
+        decimatorRate = sampleRate;
     }
 
-    return byte_read == size;
+    const size_t frames = byte_read / (2 * sizeof(int16_t));
+
+    // ES8388Control returns stereo stream from Mic, but we need only one channel, 
+    // we drop channel 2 (right channel) here
+    for (size_t idx = 0; idx < frames; idx++)
+    {
+        captureBlock[idx] = captureBlock[idx * 2];
+    }
+    decimatedStart = 0;
+    if (sampleRate == CAPTURE_RATE)
+    {
+        memcpy(decimated, captureBlock, frames * sizeof(int16_t));
+        decimatedEnd = frames;
+    }
+    else if (decimator.isActive())
+    {
+        decimatedEnd = decimator.process(captureBlock, frames, decimated, 1);
+    }
+    else
+    {
+        // below CAPTURE_MIN_RATE the block does not fit and its end is dropped
+        spx_uint32_t in_len = frames;
+        spx_uint32_t out_len = sizeof(decimated) / sizeof(int16_t);
+        speex_resampler_process_int(captureResampler, 0, captureBlock, &in_len, decimated, &out_len);
+        decimatedEnd = out_len;
+    }
+    return byte_read == sizeof(captureBlock);
 }
 
 void AudioKit::muteOutput(bool mute)
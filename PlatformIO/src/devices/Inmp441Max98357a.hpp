@@ -3,6 +3,7 @@
 #include <device.h>
 
 #include <driver/i2s.h>
+#include "AudioConvert.h"
 #include "IndicatorLight.h"
 
 
@@ -26,7 +27,8 @@
 
 #define I2S_SAMPLE_RATE   (16000)
 #define I2S_SAMPLE_BITS   (16)
-#define I2S_READ_LEN     512
+// the INMP441 sends 24 bit samples in 32 bit slots
+#define I2S_MIC_SAMPLE_BITS (32)
 
 // LEDs
 #define LED_FLASH 4
@@ -40,14 +42,18 @@ class Inmp441Max98357a : public Device
     void init();
     void updateColors(int colors);
     bool readAudio(uint8_t *data, size_t size);
+    void setGain(uint16_t gain);
     void setWriteMode(int sampleRate, int bitDepth, int numChannels);
     void writeAudio(uint8_t *data, size_t size, size_t *bytes_written);
+    bool isFullDuplex() { return true; };
     IndicatorLight *indicator_light = new IndicatorLight(LED_FLASH);
 
     int numAmpOutConfigurations() { return 1; };
     
   private:
-    char* i2s_read_buff = (char*) calloc(I2S_READ_LEN, sizeof(char));
+    // one device read of 32 bit slots
+    int32_t* i2s_read_buff = NULL;
+    int32_t gain = I2S_UNITY_GAIN;
 };
 
 Inmp441Max98357a::Inmp441Max98357a() {};
@@ -90,10 +96,12 @@ void Inmp441Max98357a::init() {
         Serial.println("I2S headphone driver installed.\n");
 
 
+  i2s_read_buff = (int32_t*) calloc(readSize, sizeof(int32_t));
+
   i2s_config_t i2s_config = {
     .mode = (i2s_mode_t)(I2S_MODE_MASTER|I2S_MODE_RX),
     .sample_rate = I2S_SAMPLE_RATE,
-    .bits_per_sample = i2s_bits_per_sample_t(I2S_SAMPLE_BITS),
+    .bits_per_sample = i2s_bits_per_sample_t(I2S_MIC_SAMPLE_BITS),
     .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
     .communication_format = i2s_comm_format_t(I2S_COMM_FORMAT_I2S | I2S_COMM_FORMAT_I2S_MSB),
     .intr_alloc_flags = 0,
@@ -160,14 +168,23 @@ void Inmp441Max98357a::writeAudio(uint8_t *data, size_t size, size_t *bytes_writ
 
 
 bool Inmp441Max98357a::readAudio(uint8_t *data, size_t size) {
-    size_t bytes_read;
-    i2s_read(I2S_PORT, (void*) i2s_read_buff, size, &bytes_read, portMAX_DELAY);
-    uint32_t j = 0;
-    uint32_t dac_value = 0;
-    for (int i = 0; i < size; i += 2) {
-        dac_value = ((((uint16_t) (i2s_read_buff[i + 1] & 0xf) << 8) | ((i2s_read_buff[i + 0]))));
-        data[j++] = 0;
-        data[j++] = dac_value * 256 / 2048;
+    // read the 32 bit slots in chunks of one device read and convert them to 16 bit PCM
+    int16_t *samples = (int16_t *)data;
+    size_t remaining = size / sizeof(int16_t);
+    while (remaining > 0) {
+        const size_t count = std::min(remaining, (size_t)readSize);
+        size_t bytes_read;
+        i2s_read(I2S_PORT, (void*) i2s_read_buff, count * sizeof(int32_t), &bytes_read, portMAX_DELAY);
+        if (bytes_read != count * sizeof(int32_t)) {
+            return false;
+        }
+        convertI2s32ToPcm16(i2s_read_buff, samples, count, gain);
+        samples += count;
+        remaining -= count;
     }
     return true;
 }
+
+void Inmp441Max98357a::setGain(uint16_t gain) {
+    this->gain = i2sGainFromSetting(gain);
+}
@@ -9,6 +9,9 @@
 #include "voice_memory_map.h"
 #include "wishbone_bus.h"
 #include <thread>
+#include <atomic>
+#include "DelaySumBeamformer.h"
+#include "PolyphaseResampler.h"
 extern "C" {
   #include "speex_resampler.h"
 }
@@ -36,8 +39,19 @@ const uint8_t PROGMEM gamma8[] = {
     215, 218, 220, 223, 225, 228, 231, 233, 236, 239, 241, 244, 247, 249, 252,
     255};
 
+// Approximate positions of the mics in meters, one in the center and seven on a circle.
+// Good enough for whole sample delays at 16 kHz, where a sample is about 2 cm of travel.
+const int MIC_CHANNELS = 8;
+const float micX[MIC_CHANNELS] = {0.0f, 0.0490f, 0.0306f, -0.0109f, -0.0441f, -0.0441f, -0.0109f, 0.0306f};
+const float micY[MIC_CHANNELS] = {0.0f, 0.0f, 0.0383f, 0.0478f, 0.0213f, -0.0213f, -0.0478f, -0.0383f};
+
 int err;
-SpeexResamplerState *resampler = speex_resampler_init(1, 44100, 44100, 0, &err);
+// two channels, so stereo streams are resampled per channel, mono uses the first one
+SpeexResamplerState *resampler = speex_resampler_init(2, 44100, 44100, 0, &err);
+// the common TTS rates use the precomputed filters, speex covers the rest
+const int POLYPHASE_BLOCK_FRAMES = 512;
+// stereo frames of one resampled block, enough for the largest ratio of the tables
+const int RESAMPLED_FRAMES = POLYPHASE_BLOCK_FRAMES * 441 / 160 + 1;
 
 class MatrixVoice : public Device
 {
@@ -48,11 +62,13 @@ public:
 	void updateBrightness(int brightness);
   void muteOutput(bool mute);
   void setVolume(uint16_t volume);
+  bool hasVolumeControl() { return true; };
   void setWriteMode(int sampleRate, int bitDepth, int numChannels); 
 	bool readAudio(uint8_t *data, size_t size);
   void writeAudio(uint8_t *data, size_t size, size_t *bytes_written);
   void ampOutput(int output);
-	int readSize = 512;
+  void setBeamDirection(int degrees);
+  void setResamplerQuality(int quality);
 	int writeSize = 1024;
 	int width = 2;
 	int rate = 16000;
@@ -66,10 +82,21 @@ private:
 	void interleave(const int16_t * in_L, const int16_t * in_R, int16_t * out, const size_t num_samples);
   int sampleRate, bitDepth, numChannels;
 	int brightness = 15;
+	// 512 samples per mic read, the array spans about 6 samples at 16 kHz
+	DelaySumBeamformer<MIC_CHANNELS, 512, 8> beamformer;
+	PolyphaseResampler<POLYPHASE_BLOCK_FRAMES> polyphase;
+	// speex quality, -1 uses the polyphase tables where there is one. Taken on the next setWriteMode,
+	// changing the speex filter while it runs is not safe
+	std::atomic<int> resamplerQuality{-1};
+	int speexQuality = 0;
+	// resampled block as it goes to the DAC
+	int16_t resampled[RESAMPLED_FRAMES * 2];
 };
 
 MatrixVoice::MatrixVoice()
 {
+	// a mic read delivers 512 samples
+	readSize = 512;
 };
 
 void MatrixVoice::init()
@@ -161,68 +188,91 @@ void MatrixVoice::setWriteMode(int sampleRate, int bitDepth, int numChannels) {
 	MatrixVoice::sampleRate = sampleRate;
 	MatrixVoice::bitDepth = bitDepth;
 	MatrixVoice::numChannels = numChannels;
-	speex_resampler_set_rate(resampler,sampleRate,44100);
-	speex_resampler_skip_zeros(resampler);	
+	const int quality = resamplerQuality;
+	if (quality >= 0) {
+		polyphase.disable();
+	}
+	if (sampleRate != 44100 && (quality >= 0 || !polyphase.setRates(sampleRate, 44100, numChannels))) {
+		// -1 falls back to speex quality 0 for rates without a table, whatever was set before
+		const int wanted = quality >= 0 ? quality : 0;
+		if (wanted != speexQuality) {
+			speex_resampler_set_quality(resampler, wanted);
+			speexQuality = wanted;
+		}
+		speex_resampler_set_rate(resampler,sampleRate,44100);
+		speex_resampler_skip_zeros(resampler);	
+		// mono goes to every other sample of the stereo block, the other half is copied after
+		speex_resampler_set_output_stride(resampler, 2);
+	}
 }; 
 
+void MatrixVoice::setResamplerQuality(int quality) {
+	resamplerQuality = quality;
+}
+
 bool MatrixVoice::readAudio(uint8_t *data, size_t size) {
 	mics->Read();
-	uint16_t voicebuffer[readSize];
-	for (uint32_t s = 0; s < readSize; s++) {
-	 	voicebuffer[s] = mics->Beam(s);
+	// the raw samples are interleaved, all channels of a sample next to each other
+	const size_t samples = std::min(size / width, (size_t)mics->NumberOfSamples());
+	beamformer.process(&mics->At(0, 0), samples, (int16_t *)data);
+	return samples * width == size;
+}
+
+void MatrixVoice::setBeamDirection(int degrees) {
+	if (degrees < 0) {
+		// no delays, all directions alike
+		const int delays[MIC_CHANNELS] = {0};
+		beamformer.setDelays(delays);
+	} else {
+		beamformer.steer(micX, micY, degrees, rate);
 	}
-  memcpy(data, voicebuffer, readSize * width);
-	return true;
 }
 
+// Resamples to 44.1 kHz stereo block by block into resampled. The resamplers carry their
+// filter state from one call to the next, so the blocks play seamlessly
 void MatrixVoice::writeAudio(uint8_t *data, size_t size, size_t *bytes_written) {
 	*bytes_written = size;
-	float sleep = 4000;
-	if (MatrixVoice::sampleRate == 44100) {
-		if (MatrixVoice::numChannels == 2) {
-			//Nothing to do, write to wishbone bus
-			wb.SpiWrite(matrix_hal::kDACBaseAddress, (const uint8_t *)data, sizeof(data));
-			std::this_thread::sleep_for(std::chrono::microseconds((int)sleep));
-		} else {
-			int16_t mono[size / sizeof(int16_t)];
-			int16_t stereo[size];
-			//Convert 8 bit to 16 bit
-			for (int i = 0; i < size; i += 2) {
-				mono[i/2] = ((data[i] & 0xff) | (data[i + 1] << 8));
+	const int16_t *input = (const int16_t *)data;
+	size_t frames = size / sizeof(int16_t) / MatrixVoice::numChannels;
+	while (frames > 0) {
+		size_t block;
+		size_t out_len;
+		if (MatrixVoice::sampleRate == 44100) {
+			block = std::min(frames, (size_t)RESAMPLED_FRAMES);
+			if (MatrixVoice::numChannels == 2) {
+				//Nothing to do, write to wishbone bus
+				playBytes((int16_t *)input, block * 2);
+				input += block * 2;
+				frames -= block;
+				continue;
 			}
-			MatrixVoice::interleave(mono, mono, stereo, size / sizeof(int16_t));
-			wb.SpiWrite(matrix_hal::kDACBaseAddress, (const uint8_t *)stereo, sizeof(stereo));
-			std::this_thread::sleep_for(std::chrono::microseconds((int)sleep) * 2);
-		}
-	} else {	
-		uint32_t in_len;
-		uint32_t out_len;
-		in_len = size / sizeof(int16_t);
-		out_len = size * (float)(44100 / MatrixVoice::sampleRate);
-		int16_t output[out_len];
-		int16_t input[in_len];
-		//Convert 8 bit to 16 bit
-		for (int i = 0; i < size; i += 2) {
-				input[i/2] = ((data[i] & 0xff) | (data[i + 1] << 8));
-		}
-
-		if (MatrixVoice::numChannels == 2) {
-				speex_resampler_process_interleaved_int(resampler, input, &in_len, output, &out_len); 
-				
-				//play it!
-				playBytes(output, out_len);      
+			MatrixVoice::interleave(input, input, resampled, block);
+			out_len = block;
+		} else if (polyphase.isActive()) {
+			block = std::min(frames, (size_t)POLYPHASE_BLOCK_FRAMES);
+			out_len = polyphase.process(input, block, resampled, 2);
 		} else {
-				speex_resampler_process_int(resampler, 0, input, &in_len, output, &out_len);
-				int16_t stereo[out_len * sizeof(int16_t)];
-				int16_t mono[out_len];
-				for (int i = 0; i < out_len; i++) {
-						mono[i] = output[i];                               
+			spx_uint32_t in_len = frames;
+			spx_uint32_t out_frames = RESAMPLED_FRAMES;
+			if (MatrixVoice::numChannels == 2) {
+				speex_resampler_process_interleaved_int(resampler, input, &in_len, resampled, &out_frames);
+			} else {
+				speex_resampler_process_int(resampler, 0, input, &in_len, resampled, &out_frames);
+				for (spx_uint32_t i = 0; i < out_frames; i++) {
+					resampled[2 * i + 1] = resampled[2 * i];
 				}
-				MatrixVoice::interleave(mono, mono, stereo, out_len);
-
-				//play it!                         
-				MatrixVoice::playBytes(stereo, out_len * sizeof(int16_t));      
-		}   
+			}
+			if (in_len == 0 && out_frames == 0) {
+				break;
+			}
+			// the rest of the input goes with the next block, speex stops when the output is full
+			block = in_len;
+			out_len = out_frames;
+		}
+		//play it!
+		playBytes(resampled, out_len * 2);
+		input += block * MatrixVoice::numChannels;
+		frames -= block;
 	}
 };
 
@@ -241,24 +291,14 @@ void MatrixVoice::playBytes(int16_t* input, uint32_t length) {
 	int index = 0;
 
 	while ( total - (index * sizeof(int16_t)) > MatrixVoice::writeSize) {
-		uint16_t dataT[MatrixVoice::writeSize / sizeof(int16_t)];
-		for (int i = 0; i < (MatrixVoice::writeSize / sizeof(int16_t)); i++) {
-			dataT[i] = input[i+index];                               
-		}
-
-		wb.SpiWrite(matrix_hal::kDACBaseAddress, (const uint8_t *)dataT, MatrixVoice::writeSize);
+		wb.SpiWrite(matrix_hal::kDACBaseAddress, (const uint8_t *)&input[index], MatrixVoice::writeSize);
 		std::this_thread::sleep_for(std::chrono::microseconds((int)sleep));
 
 		index = index + (MatrixVoice::writeSize / sizeof(int16_t));
 	}
 	int rest = total - (index * sizeof(int16_t));
 	if (rest > 0) {
-		int size = rest / sizeof(int16_t);
-		uint16_t dataL[size];
-		for (int i = 0; i < size; i++) {
-			dataL[i] = input[i+index];                               
-		}
-		wb.SpiWrite(matrix_hal::kDACBaseAddress, (const uint8_t *)dataL, size * sizeof(uint16_t));
+		wb.SpiWrite(matrix_hal::kDACBaseAddress, (const uint8_t *)&input[index], rest);
 		std::this_thread::sleep_for(std::chrono::microseconds((int)sleep) * (rest/MatrixVoice::writeSize));
 	}
-}
\ No newline at end of file
+}
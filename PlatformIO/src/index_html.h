@@ -102,6 +102,36 @@ input::-moz-focus-inner,input::-moz-focus-outer {border: 0;}
         <span class="range-slider__value">0</span>
       </div>
     </div>
+    <div class="input-container">
+      <label for="frame_ms">Audio frame:&nbsp;</label>
+      <select name="frame_ms">
+        <option value="16" %FRAME_MS_16%>16 ms</option>
+        <option value="32" %FRAME_MS_32%>32 ms</option>
+        <option value="64" %FRAME_MS_64%>64 ms</option>
+        <option value="128" %FRAME_MS_128%>128 ms</option>
+      </select>
+    </div>
+    <div class="input-container">
+      <label for="adpcm">Compress audio (ADPCM):&nbsp;</label>
+      <label class="switch">
+        <input type="checkbox" name="adpcm" %ADPCM%>
+        <span class="slider round"></span>
+      </label>
+    </div>
+    <div class="input-container">
+      <label for="vad">Voice gate when idle:&nbsp;</label>
+      <label class="switch">
+        <input type="checkbox" name="vad" %VAD%>
+        <span class="slider round"></span>
+      </label>
+    </div>
+    <div class="input-container">
+      <label for="vad_preroll_ms">Voice gate pre-roll (ms):&nbsp;</label>
+      <div class="range-slider">
+        <input type="range" min="0" max="1000" step="100" value="%VAD_PREROLL_MS%" class="range-slider__range" name="vad_preroll_ms">
+        <span class="range-slider__value">0</span>
+      </div>
+    </div>
     <div class="input-container">
       <label for="gain">Gain:&nbsp;</label>
       <div class="range-slider">  
@@ -109,8 +139,48 @@ input::-moz-focus-inner,input::-moz-focus-outer {border: 0;}
         <span class="range-slider__value">0</span>
       </div>
     </div>
+    <div class="input-container">
+      <label for="full_duplex">Listen while playing:&nbsp;</label>
+      <label class="switch">
+        <input type="checkbox" name="full_duplex" %FULL_DUPLEX%>
+        <span class="slider round"></span>
+      </label>
+    </div>
+    <div class="input-container">
+      <label for="play_start_ms">Buffer before playing (ms):&nbsp;</label>
+      <div class="range-slider">
+        <input type="range" min="0" max="1000" step="50" value="%PLAY_START_MS%" class="range-slider__range" name="play_start_ms">
+        <span class="range-slider__value">0</span>
+      </div>
+    </div>
+    <div class="input-container">
+      <label for="resampler_quality">Resampler quality (-1 = tables):&nbsp;</label>
+      <div class="range-slider">
+        <input type="range" min="-1" max="10" value="%RESAMPLER_QUALITY%" class="range-slider__range" name="resampler_quality">
+        <span class="range-slider__value">0</span>
+      </div>
+    </div>
+    <div class="input-container">
+      <label for="drop_policy">When behind, drop:&nbsp;</label>
+      <select name="drop_policy">
+        <option value="0" %DROP_NEWEST%>Newest frames</option>
+        <option value="1" %DROP_OLDEST%>Oldest frames</option>
+        <option value="2" %DROP_BLOCK%>Newest, after waiting</option>
+      </select>
+    </div>
+    <div class="input-container">
+      <label for="drop_ms">Latency bound / wait (ms):&nbsp;</label>
+      <div class="range-slider">
+        <input type="range" min="0" max="1000" step="10" value="%DROP_MS%" class="range-slider__range" name="drop_ms">
+        <span class="range-slider__value">0</span>
+      </div>
+    </div>
     <button type="submit" class="btn">Save</button>
   </form>
+  <h4>Audio stream</h4>
+  <pre>%AUDIO_STATS%</pre>
+  <h4>Playback</h4>
+  <pre>%PLAYBACK_STATS%</pre>
 </body>
 </html>
 <script>
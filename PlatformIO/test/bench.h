@@ -0,0 +1,25 @@
+#pragma once
+// Timing for the host benchmarks: cycles of the time stamp counter on x86, nanoseconds of the
+// steady clock elsewhere. BENCH_UNIT names what benchTicks() counts.
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+static const char *const BENCH_UNIT = "cycles";
+static inline uint64_t benchTicks() { return __rdtsc(); }
+#else
+static const char *const BENCH_UNIT = "ns";
+static inline uint64_t benchTicks()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+// Keeps the compiler from dropping a result nothing reads
+template <typename T>
+static inline void benchKeep(const T &value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
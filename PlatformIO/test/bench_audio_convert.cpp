@@ -0,0 +1,69 @@
+// Cycles per sample of the INMP441 capture conversion: convertI2s32ToPcm16 on one device read
+// (readSize 256), into a separate buffer and in place as readAudio does, and the byte-wise
+// conversion of the 16 bit slots readAudio did before, for comparison
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include "bench.h"
+#include "AudioConvert.h"
+
+static const int COUNT = 256;
+static const int ROUNDS = 20000;
+
+// the old readAudio: 12 of the bits of each 16 bit slot, scaled to 8
+static void convertBytes(const uint8_t *in, uint8_t *data, size_t size)
+{
+    uint32_t j = 0;
+    for (size_t i = 0; i < size; i += 2)
+    {
+        const uint32_t dac_value = (((uint16_t)(in[i + 1] & 0xf) << 8) | in[i + 0]);
+        data[j++] = 0;
+        data[j++] = dac_value * 256 / 2048;
+    }
+}
+
+template <typename Convert>
+static void run(const char *name, Convert convert)
+{
+    uint64_t best = UINT64_MAX;
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        const uint64_t start = benchTicks();
+        convert();
+        best = std::min(best, benchTicks() - start);
+    }
+    printf("%-24s %6.2f %s per sample\n", name, (double)best / COUNT, BENCH_UNIT);
+}
+
+int main()
+{
+    static int32_t slots[COUNT], inPlace[COUNT];
+    static int16_t out[COUNT];
+    static uint8_t bytes[COUNT * 2], converted[COUNT * 2];
+    srand(3);
+    for (int i = 0; i < COUNT; i++)
+    {
+        slots[i] = (int32_t)((uint32_t)((rand() % (1 << 24)) - (1 << 23)) << 8);
+        bytes[2 * i] = (uint8_t)rand();
+        bytes[2 * i + 1] = (uint8_t)rand();
+    }
+    const int32_t gain = i2sGainFromSetting(5);
+    run("convertI2s32ToPcm16", [&] {
+        convertI2s32ToPcm16(slots, out, COUNT, gain);
+        benchKeep(out);
+    });
+    run("convertI2s32ToPcm16 +42 dB", [&] {
+        convertI2s32ToPcm16(slots, out, COUNT, i2sGainFromSetting(12));
+        benchKeep(out);
+    });
+    run("in place (with a copy)", [&] {
+        std::copy(slots, slots + COUNT, inPlace);
+        convertI2s32ToPcm16(inPlace, (int16_t *)inPlace, COUNT, gain);
+        benchKeep(inPlace);
+    });
+    run("byte-wise (before)", [&] {
+        convertBytes(bytes, converted, sizeof(bytes));
+        benchKeep(converted);
+    });
+    return 0;
+}
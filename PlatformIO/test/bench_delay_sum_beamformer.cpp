@@ -0,0 +1,70 @@
+// Cycles per frame of DelaySumBeamformer as the Matrix Voice runs it, 8 mics and reads of
+// 512 samples, and of a straight loop over the interleaved samples for comparison
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "bench.h"
+#include "DelaySumBeamformer.h"
+
+static const int CHANNELS = 8;
+static const int MAX_DELAY = 8;
+static const int ROUNDS = 5000;
+// the mic positions of MatrixVoice.hpp
+static const float micX[CHANNELS] = {0.0f, 0.0490f, 0.0306f, -0.0109f, -0.0441f, -0.0441f, -0.0109f, 0.0306f};
+static const float micY[CHANNELS] = {0.0f, 0.0f, 0.0383f, 0.0478f, 0.0213f, -0.0213f, -0.0478f, -0.0383f};
+
+template <int BLOCK>
+static void run(const std::vector<int16_t> &in)
+{
+    static DelaySumBeamformer<CHANNELS, BLOCK, MAX_DELAY> former;
+    former.steer(micX, micY, 60, 16000);
+    int16_t out[BLOCK];
+    uint64_t best = UINT64_MAX;
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        const uint64_t start = benchTicks();
+        former.process(in.data(), BLOCK, out);
+        best = std::min(best, benchTicks() - start);
+        benchKeep(out);
+    }
+    printf("DelaySumBeamformer %4d samples: %7.0f %s per frame, %5.2f per sample\n", BLOCK, (double)best, BENCH_UNIT, (double)best / BLOCK);
+
+    // every output sample gathers its delayed inputs from the interleaved block
+    static int16_t previous[BLOCK * CHANNELS];
+    const int delays[CHANNELS] = {0, 2, 4, 6, 8, 6, 4, 2};
+    best = UINT64_MAX;
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        const uint64_t start = benchTicks();
+        for (int s = 0; s < BLOCK; s++)
+        {
+            int32_t sum = 0;
+            for (int c = 0; c < CHANNELS; c++)
+            {
+                const int at = s - delays[c];
+                sum += (at >= 0 ? in[at * CHANNELS + c] : previous[(BLOCK + at) * CHANNELS + c]) * (32768 / CHANNELS);
+            }
+            sum >>= 15;
+            out[s] = sum > 32767 ? 32767 : (sum < -32768 ? -32768 : sum);
+        }
+        std::copy(in.begin(), in.begin() + BLOCK * CHANNELS, previous);
+        best = std::min(best, benchTicks() - start);
+        benchKeep(out);
+    }
+    printf("interleaved loop   %4d samples: %7.0f %s per frame, %5.2f per sample\n", BLOCK, (double)best, BENCH_UNIT, (double)best / BLOCK);
+}
+
+int main()
+{
+    std::vector<int16_t> in(512 * CHANNELS);
+    srand(4);
+    for (size_t i = 0; i < in.size(); i++)
+    {
+        in[i] = (int16_t)(rand() % 20001 - 10000);
+    }
+    run<256>(in);
+    run<512>(in);
+    return 0;
+}
@@ -0,0 +1,115 @@
+// MQTT messages and bytes per second of one satellite at each frame_ms, for PCM and ADPCM
+// audioFrames, sized by AudioFrameLayout as initHeader does. The bytes count the WAV header
+// and the MQTT framing of PubSubClient. Then the messages and bytes per second the publish
+// path manages on the host, through a stand-in of beginPublish/write/endPublish which frames
+// the message into a socket buffer.
+#include <string.h>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "AudioFrameLayout.h"
+#include "ImaAdpcm.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int AUDIO_FRAME_MAX_BYTES = 4096; // as in General.hpp
+static const int PCM_HEADER_BYTES = 44;        // sizeof(wavfile_header)
+static const int ADPCM_HEADER_BYTES = 60;      // sizeof(wavfile_adpcm_header)
+static const std::string TOPIC = "hermes/audioServer/satellite/audioFrame";
+
+// What PubSubClient sends for a QoS 0 publish: the fixed header with the remaining length,
+// the topic with its length, the payload
+struct Publisher
+{
+    std::vector<uint8_t> socket = std::vector<uint8_t>(1 << 16);
+    size_t fill = 0;
+    size_t bytes = 0;
+
+    void put(const uint8_t *data, size_t len)
+    {
+        if (fill + len > socket.size())
+        {
+            fill = 0; // the network took it
+        }
+        memcpy(&socket[fill], data, len);
+        fill += len;
+        bytes += len;
+    }
+
+    bool beginPublish(const std::string &topic, size_t length)
+    {
+        uint8_t framing[5 + 2];
+        size_t n = 0;
+        framing[n++] = 0x30;
+        size_t remaining = 2 + topic.size() + length;
+        do
+        {
+            framing[n] = remaining & 0x7f;
+            remaining >>= 7;
+            framing[n++] |= remaining > 0 ? 0x80 : 0;
+        } while (remaining > 0);
+        framing[n++] = topic.size() >> 8;
+        framing[n++] = topic.size() & 0xff;
+        put(framing, n);
+        put((const uint8_t *)topic.data(), topic.size());
+        return true;
+    }
+    size_t write(const uint8_t *data, size_t len)
+    {
+        put(data, len);
+        return len;
+    }
+    int endPublish() { return 1; }
+};
+
+static size_t wireBytes(int payload)
+{
+    Publisher publisher;
+    publisher.beginPublish(TOPIC, payload);
+    return publisher.bytes + payload;
+}
+
+static void run(bool adpcm)
+{
+    // 16 kHz 16 bit mono, the 256 sample reads of most devices. The 512 of the Matrix Voice
+    // give the same messages
+    const int rate = 16000, width = 2, readSize = 256;
+    for (int frame_ms = 16; frame_ms <= 128; frame_ms *= 2)
+    {
+        const AudioFrameLayout layout(readSize * width, rate * width, frame_ms, AUDIO_FRAME_MAX_BYTES);
+        const int samples = layout.messageBytes / width;
+        const int header = adpcm ? ADPCM_HEADER_BYTES : PCM_HEADER_BYTES;
+        const int payload = header + (adpcm ? ImaAdpcmEncoder::blockSize(samples) : layout.messageBytes);
+        const double messagesPerSecond = (double)rate / samples;
+        const size_t wire = wireBytes(payload);
+
+        // one message after the other, as PublishTask sends them
+        Publisher publisher;
+        std::vector<uint8_t> message(payload);
+        const int count = 200000;
+        const Clock::time_point start = Clock::now();
+        const uint64_t ticks = benchTicks();
+        for (int i = 0; i < count; i++)
+        {
+            publisher.beginPublish(TOPIC, payload);
+            publisher.write(message.data(), header);
+            publisher.write(&message[header], payload - header);
+            publisher.endPublish();
+        }
+        const uint64_t spent = benchTicks() - ticks;
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        benchKeep(publisher.fill);
+
+        printf("%-5s %3d ms: %5.1f messages/s %6.0f bytes/s (%4.1f%% overhead) | host %5.2f M messages/s %6.0f MB/s, %4.0f %s per message\n",
+               adpcm ? "ADPCM" : "PCM", frame_ms, messagesPerSecond, messagesPerSecond * wire,
+               100.0 * (wire - (payload - header)) / wire, count / seconds / 1e6, count * (double)wire / seconds / 1e6,
+               (double)spent / count, BENCH_UNIT);
+    }
+}
+
+int main()
+{
+    run(false);
+    run(true);
+    return 0;
+}
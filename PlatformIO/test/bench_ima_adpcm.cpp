@@ -0,0 +1,51 @@
+// Cycles ImaAdpcmEncoder takes per audioFrame message, for the block sizes of each frame_ms
+// at 16 kHz, on speech like audio and on a loud square wave
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#include "bench.h"
+#include "ImaAdpcm.h"
+
+static void run(const char *name, const std::vector<int16_t> &pcm)
+{
+    for (size_t count = 256; count <= 2048; count *= 2)
+    {
+        ImaAdpcmEncoder encoder;
+        std::vector<uint8_t> block(ImaAdpcmEncoder::blockSize(count));
+        uint64_t best = UINT64_MAX;
+        for (int round = 0; round < 20; round++)
+        {
+            const uint64_t start = benchTicks();
+            for (size_t i = 0; i + count <= pcm.size(); i += count)
+            {
+                encoder.encodeBlock(&pcm[i], count, block.data());
+            }
+            best = std::min(best, benchTicks() - start);
+            benchKeep(block[4]);
+        }
+        const size_t frames = pcm.size() / count;
+        printf("%-6s %4zu samples (%3zu ms): %7.0f %s per frame, %5.2f per sample\n", name, count, count / 16,
+               (double)best / frames, BENCH_UNIT, (double)best / (frames * count));
+    }
+}
+
+int main()
+{
+    // 4 s at 16 kHz
+    std::vector<int16_t> pcm(64 * 1024);
+    srand(2);
+    for (size_t i = 0; i < pcm.size(); i++)
+    {
+        const double t = i / 16000.0;
+        pcm[i] = (int16_t)(8000 * sin(2 * M_PI * (200 + 400 * t) * t) + 2000 * sin(2 * M_PI * 1800 * t) + rand() % 400 - 200);
+    }
+    run("speech", pcm);
+    for (size_t i = 0; i < pcm.size(); i++)
+    {
+        pcm[i] = ((i / 16) & 1) ? 30000 : -30000;
+    }
+    run("square", pcm);
+    return 0;
+}
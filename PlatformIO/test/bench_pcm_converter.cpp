@@ -0,0 +1,68 @@
+// Throughput of PcmConverter on the playback blocks of I2Stask (PLAYBACK_BLOCK_MAX_BYTES of
+// input), for every input format into mono and stereo, and of the copy loop AudioKit used to
+// double 16 bit mono to stereo before, for comparison
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include "bench.h"
+#include "PcmConverter.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int BLOCK_BYTES = 1024; // PLAYBACK_BLOCK_MAX_BYTES of General.hpp
+static const int ROUNDS = 20000;
+
+static uint8_t in[BLOCK_BYTES];
+static int16_t out[BLOCK_BYTES * 2];
+
+template <typename Convert>
+static void run(const char *name, Convert convert)
+{
+    uint64_t best = UINT64_MAX;
+    size_t frames = 0;
+    const Clock::time_point start = Clock::now();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        const uint64_t ticks = benchTicks();
+        frames = convert();
+        best = std::min(best, benchTicks() - ticks);
+        benchKeep(out);
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    printf("%-24s %5.2f %s per output frame, %6.0f MB/s of input\n", name, (double)best / frames, BENCH_UNIT, (double)ROUNDS * BLOCK_BYTES / seconds / 1e6);
+}
+
+int main()
+{
+    srand(5);
+    for (int i = 0; i < BLOCK_BYTES; i++)
+    {
+        in[i] = (uint8_t)rand();
+    }
+    for (int bits = 8; bits <= 32; bits += 8)
+    {
+        for (int channels = 1; channels <= 2; channels++)
+        {
+            for (int outChannels = 1; outChannels <= 2; outChannels++)
+            {
+                PcmConverter converter;
+                converter.configure(bits, channels, outChannels);
+                char name[32];
+                snprintf(name, sizeof(name), "%2d bit %s to %s", bits, channels == 1 ? "mono" : "stereo", outChannels == 1 ? "mono" : "stereo");
+                run(name, [&] { return converter.convert(in, BLOCK_BYTES, out) / outChannels; });
+            }
+        }
+    }
+    // the old AudioKit writeAudio: every 16 bit mono sample twice
+    run("16 bit mono, copy loop", [] {
+        const uint16_t *data1 = (const uint16_t *)in;
+        uint16_t *data2 = (uint16_t *)out;
+        for (int idx = 0; idx < BLOCK_BYTES / 2; idx++)
+        {
+            data2[2 * idx] = data1[idx];
+            data2[2 * idx + 1] = data1[idx];
+        }
+        return (size_t)BLOCK_BYTES / 2;
+    });
+    return 0;
+}
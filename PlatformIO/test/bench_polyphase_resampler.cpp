@@ -0,0 +1,105 @@
+// PolyphaseResampler against the speex resampler, for every rate pair of PolyphaseTables.h:
+// the time to switch to the rates (setRates, speex_resampler_init and set_rate on a running
+// resampler as the firmware does), the cycles per output sample in the blocks the devices
+// use, and the SNR of a 1 kHz and a 5 kHz tone against a fitted sine. Speex runs at quality 0,
+// the Matrix Voice fallback, 3, the AudioKit capture fallback, and 10 as the ceiling.
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "bench.h"
+#include "sine_fit.h"
+#include "PolyphaseResampler.h"
+#include "speex_resampler.h"
+
+static const int BLOCK = 512; // POLYPHASE_BLOCK_FRAMES of MatrixVoice.hpp, the capture reads 256
+static const int ROUNDS = 5;
+static const int SETUP_ROUNDS = 200;
+static const int SPEEX_QUALITIES[] = {0, 3, 10};
+
+static std::vector<int16_t> tone(int rate, double frequency)
+{
+    std::vector<int16_t> in(rate);
+    for (int n = 0; n < rate; n++)
+    {
+        in[n] = (int16_t)lrint(10000 * sin(2 * M_PI * frequency * n / rate));
+    }
+    return in;
+}
+
+// 1 s of a tone through process(in, frames, out), which returns the frames written. The SNR
+// skips the first 10 ms, where the filter fills
+template <typename Process>
+static void measure(const PolyphaseTable &table, size_t block, Process process, double &ticks, double snr[2])
+{
+    std::vector<int16_t> out(table.outRate + 1024);
+    const double frequencies[2] = {1000, 5000};
+    ticks = 1e30;
+    for (int f = 0; f < 2; f++)
+    {
+        const std::vector<int16_t> in = tone(table.inRate, frequencies[f]);
+        for (int round = 0; round < (f == 0 ? ROUNDS : 1); round++)
+        {
+            size_t produced = 0;
+            const uint64_t start = benchTicks();
+            for (size_t done = 0; done + block <= in.size(); done += block)
+            {
+                produced += process(&in[done], block, &out[produced]);
+            }
+            ticks = f == 0 ? std::min(ticks, (double)(benchTicks() - start) / produced) : ticks;
+            const size_t skip = table.outRate / 100;
+            snr[f] = sineFitSnr(&out[skip], produced - skip, frequencies[f], table.outRate);
+        }
+    }
+}
+
+int main()
+{
+    for (const PolyphaseTable &table : polyphaseTables)
+    {
+        const size_t block = table.outRate == 16000 ? 256 : BLOCK;
+        printf("%5d Hz to %5d Hz\n", table.inRate, table.outRate);
+
+        PolyphaseResampler<BLOCK> polyphase;
+        uint64_t setup = UINT64_MAX;
+        for (int round = 0; round < SETUP_ROUNDS; round++)
+        {
+            const uint64_t start = benchTicks();
+            polyphase.setRates(table.inRate, table.outRate, 1);
+            setup = std::min(setup, benchTicks() - start);
+        }
+        double ticks, snr[2];
+        measure(table, block, [&](const int16_t *in, size_t frames, int16_t *out) { return polyphase.process(in, frames, out, 1); }, ticks, snr);
+        printf("  polyphase %2d taps  setRates %9.0f %s, %7.2f %s per sample, SNR %5.1f dB at 1 kHz, %5.1f dB at 5 kHz\n",
+               table.taps, (double)setup, BENCH_UNIT, ticks, BENCH_UNIT, snr[0], snr[1]);
+
+        for (int quality : SPEEX_QUALITIES)
+        {
+            int err;
+            uint64_t init = UINT64_MAX, rate = UINT64_MAX;
+            for (int round = 0; round < SETUP_ROUNDS / 10; round++)
+            {
+                uint64_t start = benchTicks();
+                SpeexResamplerState *resampler = speex_resampler_init(1, table.inRate, table.outRate, quality, &err);
+                init = std::min(init, benchTicks() - start);
+                // from the rates of another table, as a device switching between WAVs
+                speex_resampler_set_rate(resampler, table.outRate, table.outRate);
+                start = benchTicks();
+                speex_resampler_set_rate(resampler, table.inRate, table.outRate);
+                rate = std::min(rate, benchTicks() - start);
+                speex_resampler_destroy(resampler);
+            }
+            SpeexResamplerState *resampler = speex_resampler_init(1, table.inRate, table.outRate, quality, &err);
+            measure(table, block, [&](const int16_t *in, size_t frames, int16_t *out) {
+                spx_uint32_t in_len = frames;
+                spx_uint32_t out_len = frames * table.up / table.down + 2;
+                speex_resampler_process_int(resampler, 0, in, &in_len, out, &out_len);
+                return (size_t)out_len;
+            }, ticks, snr);
+            speex_resampler_destroy(resampler);
+            printf("  speex quality %2d   init %9.0f %s, set_rate %9.0f %s, %7.2f %s per sample, SNR %5.1f dB at 1 kHz, %5.1f dB at 5 kHz\n",
+                   quality, (double)init, BENCH_UNIT, (double)rate, BENCH_UNIT, ticks, BENCH_UNIT, snr[0], snr[1]);
+        }
+    }
+    return 0;
+}
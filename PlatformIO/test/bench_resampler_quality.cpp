@@ -0,0 +1,80 @@
+// What resampler_quality buys on the Matrix Voice: per speex quality 0 - 10 and per rate the
+// TTS engines deliver, the time to set the resampler up (speex_resampler_init, and set_rate on
+// the running resampler as setWriteMode does), the cycles per 44.1 kHz output sample and the
+// SNR of a 1 kHz and a 5 kHz tone against a least squares sine fit in double precision. The
+// tone is at -10 dBFS, rounding to 16 bits alone keeps the SNR around 80 dB
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "bench.h"
+#include "sine_fit.h"
+#include "speex_resampler.h"
+
+static const int RATES[] = {16000, 22050, 24000, 48000};
+static const int OUT_RATE = 44100;
+static const int BLOCK = 512; // POLYPHASE_BLOCK_FRAMES of MatrixVoice.hpp
+static const int ROUNDS = 3;
+static const int SETUP_ROUNDS = 10;
+
+// 1 s of the tone in blocks, the ticks per output sample and the SNR after the first 10 ms
+static double run(SpeexResamplerState *resampler, int rate, double frequency, double &ticks)
+{
+    std::vector<int16_t> in(rate), out(OUT_RATE + 1024);
+    for (int n = 0; n < rate; n++)
+    {
+        in[n] = (int16_t)lrint(10000 * sin(2 * M_PI * frequency * n / rate));
+    }
+    speex_resampler_reset_mem(resampler);
+    speex_resampler_skip_zeros(resampler);
+    size_t produced = 0;
+    const uint64_t start = benchTicks();
+    for (size_t done = 0; done + BLOCK <= in.size(); done += BLOCK)
+    {
+        spx_uint32_t in_len = BLOCK;
+        spx_uint32_t out_len = out.size() - produced;
+        speex_resampler_process_int(resampler, 0, &in[done], &in_len, &out[produced], &out_len);
+        produced += out_len;
+    }
+    ticks = (double)(benchTicks() - start) / produced;
+    const size_t skip = OUT_RATE / 100;
+    return sineFitSnr(&out[skip], produced - skip, frequency, OUT_RATE);
+}
+
+int main()
+{
+    for (int rate : RATES)
+    {
+        printf("%5d Hz to %d Hz\n", rate, OUT_RATE);
+        for (int quality = 0; quality <= 10; quality++)
+        {
+            int err;
+            uint64_t init = UINT64_MAX, setRate = UINT64_MAX;
+            for (int round = 0; round < SETUP_ROUNDS; round++)
+            {
+                uint64_t start = benchTicks();
+                SpeexResamplerState *resampler = speex_resampler_init(1, rate, OUT_RATE, quality, &err);
+                init = std::min(init, benchTicks() - start);
+                // from 44.1 kHz, which needs no filter, as after playing a 44.1 kHz WAV
+                speex_resampler_set_rate(resampler, OUT_RATE, OUT_RATE);
+                start = benchTicks();
+                speex_resampler_set_rate(resampler, rate, OUT_RATE);
+                setRate = std::min(setRate, benchTicks() - start);
+                speex_resampler_destroy(resampler);
+            }
+            SpeexResamplerState *resampler = speex_resampler_init(1, rate, OUT_RATE, quality, &err);
+            double ticks = 1e30, t;
+            double snr1k = 0;
+            for (int round = 0; round < ROUNDS; round++)
+            {
+                snr1k = run(resampler, rate, 1000, t);
+                ticks = std::min(ticks, t);
+            }
+            const double snr5k = run(resampler, rate, 5000, t);
+            speex_resampler_destroy(resampler);
+            printf("  quality %2d: init %9.0f %s, set_rate %9.0f %s, %8.2f %s per sample, SNR %5.1f dB at 1 kHz, %5.1f dB at 5 kHz\n",
+                   quality, (double)init, BENCH_UNIT, (double)setRate, BENCH_UNIT, ticks, BENCH_UNIT, snr1k, snr5k);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Samples per second through Esp32RingBuffer on the host ring buffer, drained the way the
+// playback loop used to (one pop per sample) and the way it does now (popInto per block).
+// Then bytes per second from a producer to a consumer thread, through SpscRingBuffer and
+// through Esp32RingBuffer on the pthread stand-in of the FreeRTOS ring buffer.
+#include <chrono>
+#include <thread>
+#include "Esp32RingBuffer.h"
+#include "SpscRingBuffer.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const size_t BLOCK_SAMPLES = 512;
+static const size_t ROUNDS = 20000;
+
+template <typename Drain>
+static void run(const char *name, Drain drain)
+{
+    Esp32RingBuffer<uint8_t, uint16_t, 4096> ring;
+    static uint8_t block[BLOCK_SAMPLES * 2];
+    static uint16_t out[BLOCK_SAMPLES];
+    const Clock::time_point start = Clock::now();
+    for (size_t r = 0; r < ROUNDS; r++)
+    {
+        ring.push(block, sizeof(block));
+        drain(ring, out);
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    printf("%-16s %6.1f Msamples/s\n", name, ROUNDS * BLOCK_SAMPLES / seconds / 1e6);
+}
+
+static const size_t STREAM_BYTES = 256 << 20;
+static const size_t STREAM_CHUNK = 1024;
+
+template <typename Ring>
+static void stream(const char *name)
+{
+    Ring ring;
+    const Clock::time_point start = Clock::now();
+    std::thread producer([&ring] {
+        static uint8_t chunk[STREAM_CHUNK];
+        for (size_t sent = 0; sent < STREAM_BYTES; sent += STREAM_CHUNK)
+        {
+            while (!ring.push(chunk, STREAM_CHUNK))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+    static uint16_t out[STREAM_CHUNK / 2];
+    size_t received = 0;
+    while (received < STREAM_BYTES)
+    {
+        const size_t popped = ring.popInto(out, STREAM_CHUNK / 2);
+        if (popped == 0)
+        {
+            std::this_thread::yield();
+        }
+        received += popped * 2;
+    }
+    producer.join();
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    printf("%-16s %6.0f MB/s between two threads\n", name, STREAM_BYTES / seconds / 1e6);
+}
+
+int main()
+{
+    run("pop per sample", [](Esp32RingBuffer<uint8_t, uint16_t, 4096> &ring, uint16_t *out) {
+        for (size_t i = 0; i < BLOCK_SAMPLES; i++)
+        {
+            ring.pop(out[i]);
+        }
+    });
+    run("popInto", [](Esp32RingBuffer<uint8_t, uint16_t, 4096> &ring, uint16_t *out) {
+        ring.popInto(out, BLOCK_SAMPLES);
+    });
+    stream<SpscRingBuffer<uint8_t, uint16_t, 1 << 15>>("SpscRingBuffer");
+    stream<Esp32RingBuffer<uint8_t, uint16_t, 1 << 15>>("Esp32RingBuffer");
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Throughput of the block loop of MatrixVoice::writeAudio on the host: per rate and channel
+// count the cycles per 44.1 kHz stereo output frame and per second of audio, with the
+// precomputed polyphase filters and with speex at the qualities resampler_quality offers.
+// The input comes the way I2Stask hands it over, 1024 bytes of 16 bit samples per call
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+#include "bench.h"
+#include "PolyphaseResampler.h"
+#include "speex_resampler.h"
+
+// as in MatrixVoice.hpp
+static const int POLYPHASE_BLOCK_FRAMES = 512;
+static const int RESAMPLED_FRAMES = POLYPHASE_BLOCK_FRAMES * 441 / 160 + 1;
+// PLAYBACK_BLOCK_MAX_BYTES of General.hpp
+static const int CALL_BYTES = 1024;
+static const int ROUNDS = 3;
+
+struct Writer
+{
+    SpeexResamplerState *resampler;
+    PolyphaseResampler<POLYPHASE_BLOCK_FRAMES> polyphase;
+    int16_t resampled[RESAMPLED_FRAMES * 2];
+    int rate;
+    int channels;
+    size_t played = 0;
+
+    // quality -1 takes the polyphase filters
+    Writer(int sampleRate, int numChannels, int quality) : rate(sampleRate), channels(numChannels)
+    {
+        int err;
+        resampler = speex_resampler_init(2, 44100, 44100, quality < 0 ? 0 : quality, &err);
+        if (quality >= 0 || !polyphase.setRates(rate, 44100, channels))
+        {
+            polyphase.disable();
+            speex_resampler_set_rate(resampler, rate, 44100);
+            speex_resampler_skip_zeros(resampler);
+            speex_resampler_set_output_stride(resampler, 2);
+        }
+    }
+
+    ~Writer() { speex_resampler_destroy(resampler); }
+
+    // writeAudio, playBytes only counts the frames
+    void write(const int16_t *input, size_t frames)
+    {
+        while (frames > 0)
+        {
+            size_t block;
+            size_t out_len;
+            if (rate == 44100)
+            {
+                block = std::min(frames, (size_t)RESAMPLED_FRAMES);
+                if (channels == 2)
+                {
+                    played += block;
+                    input += block * 2;
+                    frames -= block;
+                    continue;
+                }
+                for (size_t i = 0; i < block; i++)
+                {
+                    resampled[2 * i] = resampled[2 * i + 1] = input[i];
+                }
+                out_len = block;
+            }
+            else if (polyphase.isActive())
+            {
+                block = std::min(frames, (size_t)POLYPHASE_BLOCK_FRAMES);
+                out_len = polyphase.process(input, block, resampled, 2);
+            }
+            else
+            {
+                spx_uint32_t in_len = frames;
+                spx_uint32_t out_frames = RESAMPLED_FRAMES;
+                if (channels == 2)
+                {
+                    speex_resampler_process_interleaved_int(resampler, input, &in_len, resampled, &out_frames);
+                }
+                else
+                {
+                    speex_resampler_process_int(resampler, 0, input, &in_len, resampled, &out_frames);
+                    for (spx_uint32_t i = 0; i < out_frames; i++)
+                    {
+                        resampled[2 * i + 1] = resampled[2 * i];
+                    }
+                }
+                if (in_len == 0 && out_frames == 0)
+                {
+                    break;
+                }
+                block = in_len;
+                out_len = out_frames;
+            }
+            benchKeep(resampled);
+            played += out_len;
+            input += block * channels;
+            frames -= block;
+        }
+    }
+};
+
+// 1 s of a tone per channel through a new writer, the best of ROUNDS
+static void run(int rate, int channels, int quality)
+{
+    std::vector<int16_t> in(rate * channels);
+    for (int f = 0; f < rate; f++)
+    {
+        for (int c = 0; c < channels; c++)
+        {
+            in[f * channels + c] = (int16_t)lrint(10000 * sin(2 * M_PI * (440 + 100 * c) * f / rate));
+        }
+    }
+    const size_t callFrames = CALL_BYTES / 2 / channels;
+    uint64_t best = UINT64_MAX;
+    size_t played = 0;
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        Writer writer(rate, channels, quality);
+        const uint64_t start = benchTicks();
+        for (size_t done = 0; done < (size_t)rate; done += callFrames)
+        {
+            writer.write(&in[done * channels], std::min(callFrames, rate - done));
+        }
+        best = std::min(best, benchTicks() - start);
+        played = writer.played;
+    }
+    char path[16];
+    snprintf(path, sizeof(path), quality < 0 ? (rate == 44100 ? "copy" : "polyphase") : "speex %d", quality);
+    printf("%5d Hz %d channel%s %-10s %8.2f %s per output frame, %7.2f M%s per second of audio\n", rate, channels, channels > 1 ? "s" : " ",
+           path, (double)best / played, BENCH_UNIT, best / 1e6, BENCH_UNIT);
+}
+
+int main()
+{
+    const int rates[] = {8000, 11025, 16000, 22050, 24000, 32000, 44100, 48000};
+    for (int rate : rates)
+    {
+        for (int channels = 1; channels <= 2; channels++)
+        {
+            if (rate == 44100 || PolyphaseResampler<POLYPHASE_BLOCK_FRAMES>::hasTable(rate, 44100))
+            {
+                run(rate, channels, -1);
+            }
+            if (rate != 44100)
+            {
+                for (int quality : {0, 3, 10})
+                {
+                    run(rate, channels, quality);
+                }
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,233 @@
+// The voice activity gate over recorded audio, as queueAudioFrame runs it in Idle: the
+// bandwidth saved and the onset latency, for several pre-roll lengths.
+//
+//   bench_voice_activity_gate recording.wav...
+//
+// The recordings are 16 kHz 16 bit WAVs (of more channels the first is taken). The onsets
+// come from a label file next to each, recording.txt, one onset per line in seconds, as
+// Audacity exports its labels (start, end and text separated by tabs). Per onset there is
+// the detection delay, from the onset until the frame which opens the gate is captured, and
+// what of the onset is clipped: the time from the onset to the first sample published, after
+// the pre-roll. Without recordings a synthetic one with known onsets is used.
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "VoiceActivityGate.h"
+
+static const int RATE = 16000;
+static const int FRAME_MS = 16; // the default frame_ms
+static const int FRAME = RATE * FRAME_MS / 1000;
+
+struct Recording
+{
+    std::string name;
+    std::vector<int16_t> samples;
+    std::vector<double> onsets; // seconds
+};
+
+static uint32_t le32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+static uint16_t le16(const uint8_t *p) { return p[0] | p[1] << 8; }
+
+static bool readWav(const char *path, Recording &recording)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        printf("%s: cannot open\n", path);
+        return false;
+    }
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        bytes.insert(bytes.end(), buffer, buffer + n);
+    }
+    fclose(file);
+    if (bytes.size() < 12 || memcmp(&bytes[0], "RIFF", 4) != 0 || memcmp(&bytes[8], "WAVE", 4) != 0)
+    {
+        printf("%s: not a WAV file\n", path);
+        return false;
+    }
+    int format = 0, channels = 0, rate = 0, bits = 0;
+    for (size_t pos = 12; pos + 8 <= bytes.size();)
+    {
+        const size_t length = le32(&bytes[pos + 4]);
+        const uint8_t *chunk = &bytes[pos + 8];
+        const size_t available = std::min(length, bytes.size() - pos - 8);
+        if (memcmp(&bytes[pos], "fmt ", 4) == 0 && available >= 16)
+        {
+            format = le16(chunk);
+            channels = le16(chunk + 2);
+            rate = le32(chunk + 4);
+            bits = le16(chunk + 14);
+        }
+        else if (memcmp(&bytes[pos], "data", 4) == 0)
+        {
+            if (format != 1 || bits != 16 || rate != RATE || channels < 1)
+            {
+                printf("%s: %d Hz %d bit format %d, only 16 kHz 16 bit PCM is supported\n", path, rate, bits, format);
+                return false;
+            }
+            for (size_t i = 0; i + 2 * channels <= available; i += 2 * channels)
+            {
+                recording.samples.push_back((int16_t)le16(chunk + i));
+            }
+            return true;
+        }
+        pos += 8 + length + (length & 1);
+    }
+    printf("%s: no data chunk\n", path);
+    return false;
+}
+
+static void readLabels(const char *path, Recording &recording)
+{
+    std::string labels = path;
+    const size_t dot = labels.rfind('.');
+    labels = (dot == std::string::npos ? labels : labels.substr(0, dot)) + ".txt";
+    FILE *file = fopen(labels.c_str(), "r");
+    if (file == NULL)
+    {
+        return;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char *end;
+        const double onset = strtod(line, &end);
+        if (end != line)
+        {
+            recording.onsets.push_back(onset);
+        }
+    }
+    fclose(file);
+}
+
+// 2 s of room noise, then words of 0.6 s with growing pauses, the pauses from 1.5 s on longer
+// than the hangover
+static Recording synthetic()
+{
+    Recording recording;
+    recording.name = "synthetic";
+    srand(1);
+    const double onsets[] = {2.0, 3.1, 5.2, 8.0};
+    recording.samples.resize(10 * RATE);
+    for (size_t i = 0; i < recording.samples.size(); i++)
+    {
+        const double t = (double)i / RATE;
+        double v = rand() % 401 - 200;
+        for (double onset : onsets)
+        {
+            if (t >= onset && t < onset + 0.6)
+            {
+                v += 8000 * (sin(2 * M_PI * 150 * t) + 0.5 * sin(2 * M_PI * 300 * t) + 0.25 * sin(2 * M_PI * 450 * t)) / 1.75;
+            }
+        }
+        recording.samples[i] = (int16_t)v;
+    }
+    recording.onsets.assign(onsets, onsets + 4);
+    return recording;
+}
+
+static void run(const Recording &recording, int preroll_ms)
+{
+    const int frames = recording.samples.size() / FRAME;
+    VoiceActivityDetector detector;
+    std::vector<bool> open(frames), published(frames);
+    // as the pre-roll of queueAudioFrame: the closed frames kept, at most prerollFrames
+    const int prerollFrames = preroll_ms / FRAME_MS;
+    int held = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        open[f] = detector.process(&recording.samples[f * FRAME], FRAME, FRAME_MS);
+        if (!open[f])
+        {
+            held = std::min(held + 1, prerollFrames);
+            continue;
+        }
+        for (int p = f - held; p <= f; p++)
+        {
+            published[p] = true;
+        }
+        held = 0;
+    }
+    int sent = 0;
+    for (bool p : published)
+    {
+        sent += p;
+    }
+
+    double delaySum = 0, delayMax = 0, clippedSum = 0, clippedMax = 0;
+    int detected = 0, missed = 0;
+    for (size_t o = 0; o < recording.onsets.size(); o++)
+    {
+        const double onset = recording.onsets[o];
+        const double next = o + 1 < recording.onsets.size() ? recording.onsets[o + 1] : 1e9;
+        int f = (int)(onset * RATE) / FRAME;
+        while (f < frames && !open[f] && (double)f * FRAME / RATE < next)
+        {
+            f++;
+        }
+        if (f >= frames || !open[f])
+        {
+            missed++;
+            continue;
+        }
+        // the gate decides once the whole frame is in, an open gate at the onset waits for nothing
+        const double delay = std::max((double)(f + 1) * FRAME / RATE - onset, 0.0);
+        int first = f;
+        while (first > 0 && published[first - 1])
+        {
+            first--;
+        }
+        const double clipped = std::max((double)first * FRAME / RATE - onset, 0.0);
+        delaySum += delay;
+        delayMax = std::max(delayMax, delay);
+        clippedSum += clipped;
+        clippedMax = std::max(clippedMax, clipped);
+        detected++;
+    }
+
+    printf("%-24s pre-roll %4d ms: %5.1f %% of the bandwidth saved", recording.name.c_str(), preroll_ms, 100.0 * (frames - sent) / std::max(frames, 1));
+    if (detected > 0)
+    {
+        printf(", onset detected after %3.0f ms (at most %3.0f), clipped %3.0f ms (at most %3.0f)",
+               1000 * delaySum / detected, 1000 * delayMax, 1000 * clippedSum / detected, 1000 * clippedMax);
+    }
+    if (missed > 0)
+    {
+        printf(", %d of %d onsets missed", missed, (int)recording.onsets.size());
+    }
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<Recording> recordings;
+    for (int i = 1; i < argc; i++)
+    {
+        Recording recording;
+        recording.name = argv[i];
+        if (readWav(argv[i], recording))
+        {
+            readLabels(argv[i], recording);
+            recordings.push_back(recording);
+        }
+    }
+    if (argc == 1)
+    {
+        recordings.push_back(synthetic());
+    }
+    for (const Recording &recording : recordings)
+    {
+        for (int preroll_ms : {0, 250, 500, 1000})
+        {
+            run(recording, preroll_ms);
+        }
+    }
+    return recordings.size() == (size_t)std::max(argc - 1, 1) ? 0 : 1;
+}
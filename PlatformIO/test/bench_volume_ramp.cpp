@@ -0,0 +1,47 @@
+// Cycles per sample of VolumeRamp::process on one playback block (PLAYBACK_BLOCK_MAX_BYTES of
+// 16 bit mono becomes 512 frames): at unity, which is skipped, at a steady volume, and while
+// a change ramps over the first RAMP_FRAMES frames of the block, mono and stereo
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#include "bench.h"
+#include "VolumeRamp.h"
+
+static const int FRAMES = 512;
+static const int ROUNDS = 20000;
+
+// volume1 and volume2 take turns per block, the same two make it steady
+static void run(const char *name, int channels, int volume1, int volume2)
+{
+    std::vector<int16_t> source(FRAMES * channels), samples(FRAMES * channels);
+    srand(4);
+    for (int16_t &sample : source)
+    {
+        sample = (int16_t)(rand() % 65536 - 32768);
+    }
+    VolumeRamp ramp;
+    ramp.setVolume(volume1);
+    uint64_t best = UINT64_MAX;
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        ramp.setVolume(round & 1 ? volume2 : volume1);
+        std::copy(source.begin(), source.end(), samples.begin());
+        const uint64_t start = benchTicks();
+        ramp.process(samples.data(), FRAMES, channels);
+        best = std::min(best, benchTicks() - start);
+        benchKeep(samples);
+    }
+    printf("%-16s %d channel%s %6.2f %s per sample\n", name, channels, channels > 1 ? "s" : " ", (double)best / (FRAMES * channels), BENCH_UNIT);
+}
+
+int main()
+{
+    for (int channels : {1, 2})
+    {
+        run("unity", channels, 100, 100);
+        run("volume 50", channels, 50, 50);
+        run("ramping 50/70", channels, 50, 70);
+    }
+    return 0;
+}
@@ -0,0 +1,39 @@
+#pragma once
+// Minimal checks for the host tests: CHECK reports and counts a failure, the test carries on,
+// main returns checkResult() so ctest sees the outcome
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            checkFailures++;                                                  \
+        }                                                                     \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                                       \
+    do                                                                                                   \
+    {                                                                                                    \
+        const long long checkActual = (long long)(actual);                                               \
+        const long long checkExpected = (long long)(expected);                                           \
+        if (checkActual != checkExpected)                                                                \
+        {                                                                                                \
+            printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, checkActual, checkExpected); \
+            checkFailures++;                                                                             \
+        }                                                                                                \
+    } while (0)
+
+static inline int checkResult()
+{
+    if (checkFailures > 0)
+    {
+        printf("%d checks failed\n", checkFailures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,23 @@
+#pragma once
+// Host stand-in for the parts of the Arduino core the tested headers use
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+
+class HostSerial
+{
+public:
+    void println(const char *text) { puts(text); }
+
+    void printf(const char *format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        vprintf(format, args);
+        va_end(args);
+    }
+};
+
+static HostSerial Serial;
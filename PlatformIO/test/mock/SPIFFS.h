@@ -0,0 +1,93 @@
+#pragma once
+// Host stand-in for SPIFFS, its files are kept in the directory SPIFFS.root points to. Like the
+// Arduino File, copies share the open file
+#include <stdint.h>
+#include <stdio.h>
+#include <memory>
+#include <string>
+
+class File
+{
+public:
+    File() {}
+    explicit File(FILE *file)
+    {
+        if (file != NULL)
+        {
+            handle.reset(file, fclose);
+        }
+    }
+
+    operator bool() const { return handle != nullptr; }
+
+    void close() { handle.reset(); }
+
+    size_t read(uint8_t *buffer, size_t len) { return handle ? fread(buffer, 1, len, handle.get()) : 0; }
+
+    size_t write(const uint8_t *buffer, size_t len)
+    {
+        if (!handle || (limit > 0 && position() + len > limit))
+        {
+            return 0;
+        }
+        return fwrite(buffer, 1, len, handle.get());
+    }
+
+    bool seek(uint32_t pos) { return handle && fseek(handle.get(), pos, SEEK_SET) == 0; }
+
+    size_t position() { return handle ? ftell(handle.get()) : 0; }
+
+    size_t size()
+    {
+        if (!handle)
+        {
+            return 0;
+        }
+        const long pos = ftell(handle.get());
+        fseek(handle.get(), 0, SEEK_END);
+        const long end = ftell(handle.get());
+        fseek(handle.get(), pos, SEEK_SET);
+        return end;
+    }
+
+    int available() { return size() - position(); }
+
+    // bytes a file may grow to before write() fails as on a full flash, 0 for no limit
+    size_t limit = 0;
+
+private:
+    std::shared_ptr<FILE> handle;
+};
+
+class HostSPIFFS
+{
+public:
+    std::string root = ".";
+    size_t fileLimit = 0; // File::limit of the files opened for writing
+
+    File open(const char *path, const char *mode = "r")
+    {
+        File file(fopen((root + path).c_str(), mode[0] == 'w' ? "wb" : "rb"));
+        if (mode[0] == 'w')
+        {
+            file.limit = fileLimit;
+        }
+        return file;
+    }
+
+    bool exists(const char *path)
+    {
+        FILE *file = fopen((root + path).c_str(), "rb");
+        if (file != NULL)
+        {
+            fclose(file);
+        }
+        return file != NULL;
+    }
+
+    bool remove(const char *path) { return ::remove((root + path).c_str()) == 0; }
+
+    bool rename(const char *from, const char *to) { return ::rename((root + from).c_str(), (root + to).c_str()) == 0; }
+};
+
+static HostSPIFFS SPIFFS;
@@ -0,0 +1,159 @@
+#pragma once
+// Host stand-in for the ESP-IDF ring buffer, byte buffers only
+//
+// Like the real one, every call takes a lock, here a pthread mutex. A send waits up to its
+// timeout for room, a receive hands out the contiguous data up to the wrap around, which
+// stays in use until it is returned. Ticks are milliseconds.
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portMAX_DELAY ((TickType_t)0xffffffff)
+
+typedef enum
+{
+    RINGBUF_TYPE_NOSPLIT = 0,
+    RINGBUF_TYPE_ALLOWSPLIT,
+    RINGBUF_TYPE_BYTEBUF
+} RingbufferType_t;
+
+struct HostRingbuffer
+{
+    pthread_mutex_t lock;
+    pthread_cond_t returned;
+    uint8_t *data;
+    size_t size;
+    size_t read;      // start of the buffered bytes
+    size_t used;      // buffered bytes, the ones handed out included
+    size_t handedOut; // bytes received but not returned yet
+};
+
+typedef HostRingbuffer *RingbufHandle_t;
+
+static inline RingbufHandle_t xRingbufferCreate(size_t xBufferSize, RingbufferType_t xBufferType)
+{
+    (void)xBufferType;
+    RingbufHandle_t rb = new HostRingbuffer;
+    pthread_mutex_init(&rb->lock, NULL);
+    pthread_cond_init(&rb->returned, NULL);
+    rb->data = new uint8_t[xBufferSize];
+    rb->size = xBufferSize;
+    rb->read = rb->used = rb->handedOut = 0;
+    return rb;
+}
+
+static inline void vRingbufferDelete(RingbufHandle_t rb)
+{
+    pthread_cond_destroy(&rb->returned);
+    pthread_mutex_destroy(&rb->lock);
+    delete[] rb->data;
+    delete rb;
+}
+
+static inline void hostRingbufferCopyIn(RingbufHandle_t rb, const uint8_t *src, size_t len)
+{
+    size_t write = (rb->read + rb->used) % rb->size;
+    const size_t first = len < rb->size - write ? len : rb->size - write;
+    memcpy(&rb->data[write], src, first);
+    memcpy(rb->data, &src[first], len - first);
+    rb->used += len;
+}
+
+static inline BaseType_t xRingbufferSend(RingbufHandle_t rb, const void *pvItem, size_t xItemSize, TickType_t xTicksToWait)
+{
+    if (xItemSize > rb->size)
+    {
+        return pdFALSE;
+    }
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += xTicksToWait / 1000;
+    deadline.tv_nsec += (long)(xTicksToWait % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    pthread_mutex_lock(&rb->lock);
+    while (rb->size - rb->used < xItemSize)
+    {
+        if (xTicksToWait == 0 || pthread_cond_timedwait(&rb->returned, &rb->lock, &deadline) == ETIMEDOUT)
+        {
+            pthread_mutex_unlock(&rb->lock);
+            return pdFALSE;
+        }
+    }
+    hostRingbufferCopyIn(rb, (const uint8_t *)pvItem, xItemSize);
+    pthread_mutex_unlock(&rb->lock);
+    return pdTRUE;
+}
+
+static inline BaseType_t xRingbufferSendFromISR(RingbufHandle_t rb, const void *pvItem, size_t xItemSize, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    (void)pxHigherPriorityTaskWoken;
+    return xRingbufferSend(rb, pvItem, xItemSize, 0);
+}
+
+// the waiting for data of the real ring buffer is not needed by the tests, receives never block
+static inline void *xRingbufferReceiveUpTo(RingbufHandle_t rb, size_t *pxItemSize, TickType_t xTicksToWait, size_t xMaxSize)
+{
+    (void)xTicksToWait;
+    void *item = NULL;
+    pthread_mutex_lock(&rb->lock);
+    const size_t start = (rb->read + rb->handedOut) % rb->size;
+    size_t length = rb->used - rb->handedOut;
+    length = length < rb->size - start ? length : rb->size - start;
+    length = length < xMaxSize ? length : xMaxSize;
+    // the byte buffer lends out one item at a time
+    if (length > 0 && rb->handedOut == 0)
+    {
+        item = &rb->data[start];
+        rb->handedOut = length;
+        *pxItemSize = length;
+    }
+    pthread_mutex_unlock(&rb->lock);
+    return item;
+}
+
+static inline void *xRingbufferReceiveUpToFromISR(RingbufHandle_t rb, size_t *pxItemSize, size_t xMaxSize)
+{
+    return xRingbufferReceiveUpTo(rb, pxItemSize, 0, xMaxSize);
+}
+
+static inline void vRingbufferReturnItem(RingbufHandle_t rb, void *pvItem)
+{
+    (void)pvItem;
+    pthread_mutex_lock(&rb->lock);
+    rb->read = (rb->read + rb->handedOut) % rb->size;
+    rb->used -= rb->handedOut;
+    rb->handedOut = 0;
+    pthread_cond_broadcast(&rb->returned);
+    pthread_mutex_unlock(&rb->lock);
+}
+
+static inline void vRingbufferReturnItemFromISR(RingbufHandle_t rb, void *pvItem, BaseType_t *pxHigherPriorityTaskWoken = NULL)
+{
+    (void)pxHigherPriorityTaskWoken;
+    vRingbufferReturnItem(rb, pvItem);
+}
+
+static inline size_t xRingbufferGetCurFreeSize(RingbufHandle_t rb)
+{
+    pthread_mutex_lock(&rb->lock);
+    const size_t free = rb->size - rb->used;
+    pthread_mutex_unlock(&rb->lock);
+    return free;
+}
+
+static inline size_t xRingbufferGetMaxItemSize(RingbufHandle_t rb)
+{
+    return rb->size;
+}
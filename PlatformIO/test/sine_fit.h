@@ -0,0 +1,53 @@
+#pragma once
+// Quality of a resampled tone for the host benchmarks: a sine of the known frequency, with
+// amplitude, phase and DC free, is fitted to the output by least squares in double precision.
+// The fit is the reference, whatever it leaves (aliases, images, ripple and rounding) counts
+// as noise. The filter delay does not matter, it only moves the phase.
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// SNR in dB of count samples at rate against the best fitting sine at frequency
+static inline double sineFitSnr(const int16_t *samples, size_t count, double frequency, int rate)
+{
+    // normal equations of sin, cos and 1
+    double m[3][4] = {{0}};
+    for (size_t n = 0; n < count; n++)
+    {
+        const double w = 2 * M_PI * frequency * n / rate;
+        const double basis[3] = {sin(w), cos(w), 1.0};
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = 0; j < 3; j++)
+            {
+                m[i][j] += basis[i] * basis[j];
+            }
+            m[i][3] += basis[i] * samples[n];
+        }
+    }
+    // Gauss-Jordan, the matrix is well conditioned over many periods
+    for (int i = 0; i < 3; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            if (k != i)
+            {
+                const double factor = m[k][i] / m[i][i];
+                for (int j = i; j < 4; j++)
+                {
+                    m[k][j] -= factor * m[i][j];
+                }
+            }
+        }
+    }
+    const double a = m[0][3] / m[0][0], b = m[1][3] / m[1][1], dc = m[2][3] / m[2][2];
+    double signal = 0, noise = 0;
+    for (size_t n = 0; n < count; n++)
+    {
+        const double w = 2 * M_PI * frequency * n / rate;
+        const double tone = a * sin(w) + b * cos(w);
+        signal += tone * tone;
+        noise += (samples[n] - tone - dc) * (samples[n] - tone - dc);
+    }
+    return 10 * log10(signal / (noise > 0 ? noise : 1e-30));
+}
@@ -0,0 +1,80 @@
+// convertI2s32ToPcm16 on synthetic 24 bit samples in 32 bit slots: unity keeps the top 16
+// bits, boosts bring up the bits below and saturate, and the conversion works in place
+#include <stdlib.h>
+#include "check.h"
+#include "AudioConvert.h"
+
+// a 24 bit sample left aligned in its slot, the low byte as the INMP441 sends it (zero)
+static int32_t slot(int32_t sample24) { return (int32_t)((uint32_t)sample24 << 8); }
+
+int main()
+{
+    // the settings: 5 is unity, 6 dB per step, clamped to 1..12
+    CHECK_EQ(i2sGainFromSetting(5), I2S_UNITY_GAIN);
+    CHECK_EQ(i2sGainFromSetting(6), 2 * I2S_UNITY_GAIN);
+    CHECK_EQ(i2sGainFromSetting(4), I2S_UNITY_GAIN / 2);
+    CHECK_EQ(i2sGainFromSetting(1), 1);
+    CHECK_EQ(i2sGainFromSetting(0), 1);
+    CHECK_EQ(i2sGainFromSetting(12), I2S_UNITY_GAIN << 7);
+    CHECK_EQ(i2sGainFromSetting(2047), I2S_UNITY_GAIN << 7);
+
+    const int COUNT = 4096;
+    static int32_t in[COUNT];
+    static int16_t out[COUNT];
+    srand(3);
+    for (int i = 0; i < COUNT; i++)
+    {
+        in[i] = slot((rand() % (1 << 24)) - (1 << 23));
+    }
+    in[0] = slot(0x7fffff);
+    in[1] = slot(-0x800000);
+    in[2] = slot(1 << 8);
+    in[3] = slot(-(1 << 8));
+
+    // unity: exactly the top 16 bits
+    convertI2s32ToPcm16(in, out, COUNT, I2S_UNITY_GAIN);
+    int wrong = 0;
+    for (int i = 0; i < COUNT; i++)
+    {
+        wrong += out[i] != (int16_t)(in[i] >> 16);
+    }
+    CHECK_EQ(wrong, 0);
+    CHECK_EQ(out[0], 32767);
+    CHECK_EQ(out[1], -32768);
+
+    // +12 dB: four times the sample, the two bits below the top 16 come in, saturated
+    const int32_t boost = i2sGainFromSetting(7);
+    convertI2s32ToPcm16(in, out, COUNT, boost);
+    wrong = 0;
+    for (int i = 0; i < COUNT; i++)
+    {
+        int32_t expected = in[i] >> 14;
+        expected = expected > 32767 ? 32767 : (expected < -32768 ? -32768 : expected);
+        wrong += out[i] != expected;
+    }
+    CHECK_EQ(wrong, 0);
+    CHECK_EQ(out[2], 4);
+    CHECK_EQ(out[3], -4);
+
+    // the largest gain does not overflow before saturating
+    convertI2s32ToPcm16(in, out, 2, i2sGainFromSetting(12));
+    CHECK_EQ(out[0], 32767);
+    CHECK_EQ(out[1], -32768);
+
+    // in place, as the devices convert their read buffer
+    static int32_t buffer[COUNT];
+    for (int i = 0; i < COUNT; i++)
+    {
+        buffer[i] = in[i];
+    }
+    convertI2s32ToPcm16(buffer, (int16_t *)buffer, COUNT, I2S_UNITY_GAIN);
+    const int16_t *converted = (const int16_t *)buffer;
+    wrong = 0;
+    for (int i = 0; i < COUNT; i++)
+    {
+        wrong += converted[i] != (int16_t)(in[i] >> 16);
+    }
+    CHECK_EQ(wrong, 0);
+
+    return checkResult();
+}
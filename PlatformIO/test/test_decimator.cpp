@@ -0,0 +1,91 @@
+// The capture tables of PolyphaseResampler, which take the ES8388 mic from the playback rate
+// down to 16 kHz: flat up to 6 kHz, and whatever would alias from 8.8 kHz up is at least
+// 60 dB down. Also prints the time per 16 kHz output frame.
+#include <math.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "check.h"
+#include "PolyphaseResampler.h"
+
+static const int BLOCK = 256; // CAPTURE_BLOCK_FRAMES of AudioKit.hpp
+
+// level in dB of a sine at frequency through rate to 16 kHz, measured where it lands
+static double level(int rate, double frequency)
+{
+    PolyphaseResampler<BLOCK> decimator;
+    decimator.setRates(rate, 16000, 1);
+    const int frames = rate / 4;
+    std::vector<int16_t> in(frames);
+    std::vector<int16_t> out(frames);
+    for (int i = 0; i < frames; i++)
+    {
+        in[i] = (int16_t)(16000 * sin(2 * M_PI * frequency * i / rate));
+    }
+    size_t produced = 0;
+    for (int p = 0; p + BLOCK <= frames; p += BLOCK)
+    {
+        produced += decimator.process(&in[p], BLOCK, &out[produced], 1);
+    }
+    // an alias lands mirrored into 0 - 8 kHz
+    double landed = fmod(frequency, 16000);
+    landed = landed > 8000 ? 16000 - landed : landed;
+    // least squares amplitude at that frequency, after the filter has filled
+    double s = 0, c = 0;
+    int count = 0;
+    for (size_t i = 100; i < produced; i++)
+    {
+        s += out[i] * sin(2 * M_PI * landed * i / 16000);
+        c += out[i] * cos(2 * M_PI * landed * i / 16000);
+        count++;
+    }
+    const double amplitude = 2 * sqrt(s * s + c * c) / count;
+    return 20 * log10(std::max(amplitude, 1e-3) / 16000);
+}
+
+int main()
+{
+    // the AudioKit clocks at the rate of the WAV it plays, 48 kHz TTS included
+    const int rates[] = {22050, 24000, 32000, 44100, 48000};
+    for (int rate : rates)
+    {
+        CHECK(PolyphaseResampler<BLOCK>::hasTable(rate, 16000));
+        double passMin = 0, passMax = -100;
+        for (double f = 100; f <= 6000; f += 100)
+        {
+            const double l = level(rate, f);
+            passMin = std::min(passMin, l);
+            passMax = std::max(passMax, l);
+        }
+        double stopWorst = -200, stopWorstAt = 0;
+        for (double f = 8800; f < rate / 2.0; f += 97)
+        {
+            const double l = level(rate, f);
+            if (l > stopWorst)
+            {
+                stopWorst = l;
+                stopWorstAt = f;
+            }
+        }
+
+        PolyphaseResampler<BLOCK> decimator;
+        decimator.setRates(rate, 16000, 1);
+        static int16_t in[BLOCK], out[BLOCK];
+        for (int i = 0; i < BLOCK; i++)
+        {
+            in[i] = (int16_t)rand();
+        }
+        size_t produced = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int k = 0; k < 5000; k++)
+        {
+            produced += decimator.process(in, BLOCK, out, 1);
+        }
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / produced;
+
+        printf("%5d Hz: pass band %+.3f to %+.3f dB, stop band %.1f dB at worst (%.0f Hz), %.1f ns per output frame\n", rate, passMin, passMax, stopWorst, stopWorstAt, ns);
+        CHECK(passMin > -0.1 && passMax < 0.1);
+        CHECK(stopWorst < -60.0);
+    }
+    return checkResult();
+}
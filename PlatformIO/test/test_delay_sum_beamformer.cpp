@@ -0,0 +1,103 @@
+// DelaySumBeamformer on synthetic plane waves over a ring of 8 mics: the look direction adds
+// up in phase, other directions are attenuated, and blocks of any size give the same beam
+#include <math.h>
+#include <vector>
+#include "check.h"
+#include "DelaySumBeamformer.h"
+
+static const int CHANNELS = 8;
+static const int RATE = 16000;
+static const int BLOCK = 256;
+static const int MAX_DELAY = 8;
+
+// interleaved samples of a sine plane wave from azimuth over the mics at x, y
+static std::vector<int16_t> planeWave(const float *x, const float *y, float azimuth, double frequency, int count)
+{
+    const double ux = cos(azimuth * M_PI / 180);
+    const double uy = sin(azimuth * M_PI / 180);
+    std::vector<int16_t> out(count * CHANNELS);
+    for (int s = 0; s < count; s++)
+    {
+        for (int c = 0; c < CHANNELS; c++)
+        {
+            // mics closer to the source hear the wave earlier
+            const double lead = (x[c] * ux + y[c] * uy) / 343.0;
+            out[s * CHANNELS + c] = (int16_t)(10000 * sin(2 * M_PI * frequency * ((double)s / RATE + lead)));
+        }
+    }
+    return out;
+}
+
+static double amplitude(const std::vector<int16_t> &beam, int skip)
+{
+    double sum = 0;
+    for (size_t i = skip; i < beam.size(); i++)
+    {
+        sum += (double)beam[i] * beam[i];
+    }
+    return sqrt(2 * sum / (beam.size() - skip)) / 10000;
+}
+
+static std::vector<int16_t> beam(DelaySumBeamformer<CHANNELS, BLOCK, MAX_DELAY> &former, const std::vector<int16_t> &in, const std::vector<int> &blocks)
+{
+    const int count = in.size() / CHANNELS;
+    std::vector<int16_t> out(count);
+    int done = 0;
+    for (size_t b = 0; done < count; b++)
+    {
+        const int n = std::min(blocks[b % blocks.size()], count - done);
+        former.process(&in[done * CHANNELS], n, &out[done]);
+        done += n;
+    }
+    return out;
+}
+
+int main()
+{
+    // the Matrix Voice ring, 8 mics on a circle of 4 cm
+    float x[CHANNELS], y[CHANNELS];
+    for (int c = 0; c < CHANNELS; c++)
+    {
+        x[c] = 0.04f * cosf(2 * (float)M_PI * c / CHANNELS);
+        y[c] = 0.04f * sinf(2 * (float)M_PI * c / CHANNELS);
+    }
+    const int COUNT = RATE / 2;
+
+    DelaySumBeamformer<CHANNELS, BLOCK, MAX_DELAY> former;
+    former.steer(x, y, 45, RATE);
+    const double onAxis = amplitude(beam(former, planeWave(x, y, 45, 1000, COUNT), {BLOCK}), MAX_DELAY);
+    DelaySumBeamformer<CHANNELS, BLOCK, MAX_DELAY> other;
+    other.steer(x, y, 45, RATE);
+    const double offAxis = amplitude(beam(other, planeWave(x, y, 225, 3000, COUNT), {BLOCK}), MAX_DELAY);
+    DelaySumBeamformer<CHANNELS, BLOCK, MAX_DELAY> onAxisHigh;
+    onAxisHigh.steer(x, y, 45, RATE);
+    const double onAxis3k = amplitude(beam(onAxisHigh, planeWave(x, y, 45, 3000, COUNT), {BLOCK}), MAX_DELAY);
+    printf("gain at 45 degrees: %.2f at 1 kHz, %.2f at 3 kHz; from 225 degrees at 3 kHz: %.2f\n", onAxis, onAxis3k, offAxis);
+    // the delays are whole samples, at 1 kHz that costs next to nothing
+    CHECK(onAxis > 0.95 && onAxis < 1.01);
+    CHECK(onAxis3k > 0.8);
+    CHECK(offAxis < 0.5 * onAxis3k);
+
+    // the history carries the delays across blocks of any size
+    const std::vector<int16_t> wave = planeWave(x, y, 100, 700, COUNT);
+    DelaySumBeamformer<CHANNELS, BLOCK, MAX_DELAY> whole, split;
+    whole.steer(x, y, 100, RATE);
+    split.steer(x, y, 100, RATE);
+    const std::vector<int16_t> a = beam(whole, wave, {BLOCK});
+    const std::vector<int16_t> b = beam(split, wave, {1, 255, 17, 100, 3});
+    CHECK(a == b);
+
+    // full scale in, full scale out, with all the weight on one channel as well
+    std::vector<int16_t> full(BLOCK * CHANNELS, -32768);
+    int16_t out[BLOCK];
+    DelaySumBeamformer<CHANNELS, BLOCK, MAX_DELAY> even;
+    even.process(full.data(), BLOCK, out);
+    CHECK_EQ(out[BLOCK - 1], -32768);
+    DelaySumBeamformer<CHANNELS, BLOCK, MAX_DELAY> single;
+    int16_t weights[CHANNELS] = {0, 0, 0, 32767, 0, 0, 0, 0};
+    single.setWeights(weights);
+    single.process(full.data(), BLOCK, out);
+    CHECK_EQ(out[BLOCK - 1], -32767);
+
+    return checkResult();
+}
@@ -0,0 +1,147 @@
+// The drop policies of DropPolicy.h between a capture thread and a throttled broker stand-in,
+// which takes longer per frame than the capture period and stalls now and then. Every frame
+// is either published or counted as dropped, in order, DROP_OLDEST keeps the latency within
+// drop_ms and DROP_BLOCK never holds up the capture for longer than drop_ms.
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include "check.h"
+#include "DropPolicy.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int FRAMES = 400;
+static const int FRAME_US = 2000; // capture period
+static const int PUBLISH_US = 3000; // the broker takes longer per frame
+static const int STALL_MS = 60; // and stalls every 300 ms
+static const int DROP_MS = 20;
+// the threads are not scheduled to the microsecond, least of all under a parallel ctest
+static const double SLACK_MS = 10;
+
+struct Frame
+{
+    uint32_t sequence;
+    int64_t queuedTime;
+};
+
+static int64_t micros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// xTaskNotifyGive and ulTaskNotifyTake with a timeout
+struct Notification
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool given = false;
+
+    void give()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        given = true;
+        condition.notify_one();
+    }
+    void take(int64_t timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait_for(lock, std::chrono::microseconds(timeout), [this] { return given; });
+        given = false;
+    }
+};
+
+struct Result
+{
+    uint32_t published = 0;
+    uint32_t dropped = 0;
+    bool ordered = true;
+    double longestLatencyMs = 0; // queued until published
+    double longestWaitMs = 0;    // capture waiting for a slot
+};
+
+static Result run(int policy)
+{
+    static SpscQueue<Frame, 4> queue;
+    queue.clear();
+    Notification released;
+    std::atomic<uint32_t> dropped{0};
+    std::atomic<bool> done{false};
+    Result result;
+
+    std::thread capture([&] {
+        Clock::time_point next = Clock::now();
+        for (uint32_t sequence = 0; sequence < FRAMES; sequence++)
+        {
+            next += std::chrono::microseconds(FRAME_US);
+            std::this_thread::sleep_until(next);
+            const int64_t start = micros();
+            Frame *frame = acquireFrame(queue, policy, DROP_MS, micros, [&](int64_t timeout) { released.take(timeout); });
+            result.longestWaitMs = std::max(result.longestWaitMs, (micros() - start) / 1000.0);
+            if (frame == NULL)
+            {
+                dropped++;
+                continue;
+            }
+            frame->sequence = sequence;
+            frame->queuedTime = micros();
+            queue.commit();
+        }
+        done = true;
+    });
+
+    int64_t last = -1;
+    int64_t stallAt = micros() + 300000;
+    while (!done || !queue.isEmpty())
+    {
+        Frame *frame = frontFrame(queue, policy, DROP_MS, micros(), dropped);
+        if (frame == NULL)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+        }
+        result.longestLatencyMs = std::max(result.longestLatencyMs, (micros() - frame->queuedTime) / 1000.0);
+        result.ordered &= (int64_t)frame->sequence > last;
+        last = frame->sequence;
+        std::this_thread::sleep_for(std::chrono::microseconds(PUBLISH_US));
+        if (micros() >= stallAt)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(STALL_MS));
+            stallAt = micros() + 300000;
+        }
+        queue.release();
+        result.published++;
+        released.give();
+    }
+    capture.join();
+    result.dropped = dropped;
+    return result;
+}
+
+int main()
+{
+    const char *names[] = {"newest", "oldest", "block"};
+    Result results[3];
+    for (int policy = DROP_NEWEST; policy <= DROP_BLOCK; policy++)
+    {
+        const Result &r = results[policy] = run(policy);
+        printf("drop %-6s: published %u, dropped %u, latency up to %.1f ms, capture waited up to %.1f ms\n",
+               names[policy], r.published, r.dropped, r.longestLatencyMs, r.longestWaitMs);
+        // the broker can not keep up, every frame is accounted for either way
+        CHECK(r.dropped > 0);
+        CHECK_EQ(r.published + r.dropped, FRAMES);
+        CHECK(r.ordered);
+    }
+    // without a bound the stalls show up in the latency
+    CHECK(results[DROP_NEWEST].longestLatencyMs > DROP_MS + SLACK_MS);
+    CHECK(results[DROP_OLDEST].longestLatencyMs <= DROP_MS + SLACK_MS);
+    // only DROP_BLOCK waits, and no longer than drop_ms
+    CHECK(results[DROP_NEWEST].longestWaitMs < SLACK_MS);
+    CHECK(results[DROP_OLDEST].longestWaitMs < SLACK_MS);
+    CHECK(results[DROP_BLOCK].longestWaitMs > 1.0);
+    CHECK(results[DROP_BLOCK].longestWaitMs <= DROP_MS + SLACK_MS);
+
+    return checkResult();
+}
@@ -0,0 +1,159 @@
+// A simulated device with a capture and a playback thread gated as CaptureTask and I2Stask
+// are, by DuplexGate.h: the audioGroup bits, wbSemaphore and a playBytes session of 480 ms.
+// On a full duplex device the capture frames keep flowing during the session and the played
+// blocks come back as reference. With full_duplex off, or on a device which can not, the
+// stream stops while playing, the one port is never used both ways at once, and the stream
+// resumes afterwards.
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "check.h"
+#include "DuplexGate.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int BLOCK_MS = 16; // a read or a write of the device
+static const int SESSION_BLOCKS = 30;
+
+struct SimulatedDevice
+{
+    bool canDuplex;
+    std::atomic<int> portUsers{0}; // the one port of a half duplex device
+    std::atomic<int> conflicts{0};
+
+    void use(Clock::time_point &next)
+    {
+        if (!canDuplex && portUsers++ > 0)
+        {
+            conflicts++;
+        }
+        next = std::max(next + std::chrono::milliseconds(BLOCK_MS), Clock::now());
+        std::this_thread::sleep_until(next);
+        if (!canDuplex)
+        {
+            portUsers--;
+        }
+    }
+};
+
+struct Outcome
+{
+    int framesDuring = 0; // captured while the session played
+    int framesAfter = 0;
+    int referenceBlocks = 0;
+    int conflicts = 0;
+};
+
+static Outcome run(bool configured, bool deviceCan)
+{
+    SimulatedDevice device;
+    device.canDuplex = deviceCan;
+    std::atomic<int> bits{0};
+    std::timed_mutex wbSemaphore;
+    std::atomic<bool> stop{false};
+    std::atomic<int> toPlay{0};
+    std::vector<Clock::time_point> frames;
+    std::mutex framesMutex;
+    Outcome outcome;
+    const bool duplex = isFullDuplex(configured, deviceCan);
+
+    std::thread capture([&] {
+        Clock::time_point next = Clock::now();
+        while (!stop)
+        {
+            const bool locked = captureTakesSemaphore(duplex);
+            if ((bits & STREAM) && (!locked || wbSemaphore.try_lock_for(std::chrono::seconds(5))))
+            {
+                device.use(next);
+                {
+                    std::lock_guard<std::mutex> lock(framesMutex);
+                    frames.push_back(Clock::now());
+                }
+                if (locked)
+                {
+                    wbSemaphore.unlock();
+                }
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                next = Clock::now();
+            }
+        }
+    });
+
+    std::thread playback([&] {
+        Clock::time_point next = Clock::now();
+        while (!stop)
+        {
+            if ((bits & PLAY) && wbSemaphore.try_lock_for(std::chrono::seconds(5)))
+            {
+                next = Clock::now();
+                for (; toPlay > 0; toPlay--)
+                {
+                    device.use(next);
+                    outcome.referenceBlocks += duplex;
+                }
+                wbSemaphore.unlock();
+                // StreamAudioEvent
+                bits = (bits & ~PLAY) | STREAM;
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+    });
+
+    // Idle streams, then a playBytes session, then Idle again
+    bits = STREAM;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    toPlay = SESSION_BLOCKS;
+    const Clock::time_point start = Clock::now();
+    bits = (bits & ~playClearsBits(duplex)) | PLAY; // PlayAudioEvent
+    while (toPlay > 0 || (bits & PLAY))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const Clock::time_point end = Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    stop = true;
+    capture.join();
+    playback.join();
+
+    // a frame being read when the session starts still completes
+    for (const Clock::time_point &at : frames)
+    {
+        outcome.framesDuring += at > start + std::chrono::milliseconds(2 * BLOCK_MS) && at <= end;
+        outcome.framesAfter += at > end;
+    }
+    outcome.conflicts = device.conflicts;
+    return outcome;
+}
+
+int main()
+{
+    const int sessionFrames = SESSION_BLOCKS - 2;
+
+    const Outcome duplex = run(true, true);
+    printf("full duplex: %d frames captured during %d played blocks, %d reference blocks\n", duplex.framesDuring, SESSION_BLOCKS, duplex.referenceBlocks);
+    CHECK(duplex.framesDuring >= sessionFrames * 8 / 10);
+    CHECK_EQ(duplex.referenceBlocks, SESSION_BLOCKS);
+    CHECK(duplex.framesAfter > 0);
+
+    const bool devices[][2] = {{false, true}, {true, false}};
+    for (const bool *config : devices)
+    {
+        const Outcome half = run(config[0], config[1]);
+        printf("full_duplex %s on a device which %s: %d frames captured during the session, %d after, %d port conflicts\n",
+               config[0] ? "on" : "off", config[1] ? "can" : "can not", half.framesDuring, half.framesAfter, half.conflicts);
+        CHECK_EQ(half.framesDuring, 0);
+        CHECK(half.framesAfter > 0);
+        CHECK_EQ(half.referenceBlocks, 0);
+        CHECK_EQ(half.conflicts, 0);
+    }
+
+    return checkResult();
+}
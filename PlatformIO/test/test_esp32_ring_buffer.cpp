@@ -0,0 +1,79 @@
+// Esp32RingBuffer on the host ring buffer: popInto must hand out the bytes in order across
+// the wrap around, never split an output item and agree with pop
+#include "check.h"
+#include "Esp32RingBuffer.h"
+
+int main()
+{
+    // 128 bytes, small enough to wrap around every few blocks
+    Esp32RingBuffer<uint8_t, uint16_t, 64> ring;
+    CHECK_EQ(ring.maxSize(), 128);
+    CHECK(ring.isEmpty());
+    CHECK_EQ(ring.freeSize(), 128);
+
+    uint8_t in[128];
+    uint16_t out[64];
+    uint8_t written = 0;
+    uint8_t read = 0;
+    size_t through = 0;
+    for (int round = 0; round < 1000; round++)
+    {
+        // odd byte counts, so output items straddle pushes
+        const size_t pushed = 1 + (round * 37) % 99;
+        if (pushed > ring.freeSize())
+        {
+            continue;
+        }
+        for (size_t i = 0; i < pushed; i++)
+        {
+            in[i] = written++;
+        }
+        const size_t before = ring.size();
+        CHECK(ring.push(in, pushed));
+        CHECK_EQ(ring.size(), before + pushed);
+        CHECK_EQ(ring.freeSize(), 128 - before - pushed);
+
+        const size_t wanted = 1 + (round * 11) % 40;
+        const size_t expected = std::min(wanted, ring.size() / 2);
+        const size_t popped = ring.popInto(out, wanted);
+        CHECK_EQ(popped, expected);
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(out);
+        for (size_t i = 0; i < popped * 2; i++)
+        {
+            CHECK_EQ(bytes[i], read);
+            read++;
+        }
+        through += popped * 2;
+        CHECK_EQ(ring.available(), ring.size() / 2);
+    }
+    // many times around the buffer
+    CHECK(through > 100 * 128);
+
+    // a lone byte is no output item
+    ring.clear();
+    CHECK(ring.isEmpty());
+    const uint8_t odd = 0x5a;
+    CHECK(ring.push(odd));
+    CHECK_EQ(ring.popInto(out, 4), 0);
+    CHECK_EQ(ring.size(), 1);
+
+    // pop of single items sees the same data as popInto
+    const uint8_t pair[3] = {0x12, 0x34, 0x56};
+    CHECK(ring.push(pair, 3));
+    uint16_t sample = 0;
+    CHECK(ring.pop(sample));
+    CHECK_EQ(sample, 0x125a);
+    CHECK(ring.pop(sample));
+    CHECK_EQ(sample, 0x5634);
+    CHECK(!ring.pop(sample));
+
+    // a full buffer refuses more
+    ring.clear();
+    CHECK(ring.push(in, 128));
+    CHECK(ring.isFull());
+    CHECK(!ring.push(in, 1));
+    CHECK_EQ(ring.popInto(out, 64), 64);
+    CHECK(ring.isEmpty());
+
+    return checkResult();
+}
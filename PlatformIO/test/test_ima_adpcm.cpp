@@ -0,0 +1,185 @@
+// ImaAdpcmEncoder against golden blocks and a reference IMA-ADPCM decoder: every block
+// decodes to the samples of its PCM frame behind the header sample, which repeats the last
+// one of the block before exactly, and the stream keeps a reasonable SNR
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "check.h"
+#include "ImaAdpcm.h"
+
+// Golden blocks of an encoder independent of this one, Python's audioop (lin2adpcm and
+// adpcm2lin, the IMA reference algorithm). Per block of 32 samples it started from the
+// header state, the last sample of the block before and the step index it ended on, its
+// codes with the nibbles swapped into WAV order (audioop puts the first sample high)
+static const int GOLDEN_COUNT = 32;
+static const int16_t goldenPcm[3 * GOLDEN_COUNT] = {
+    0, 3257, 6270, 8812, 10692, 11769, 11963, 11258, 9708, 7429, 4592, 1410,
+    -1877, -5024, -7793, -9978, -11413, -11991, -11668, -10470, -8485, -5863, -2801, 471,
+    3708, 6667, 9125, 10898, 11852, 11917, 11087, 9424, 7053, 4153, 942, -2341,
+    -5448, -8146, -10232, -11549, -12000, -11549, -10232, -8146, -5448, -2341, 942, 4153,
+    7053, 9424, 11087, 11917, 11852, 10898, 9125, 6667, 3708, 471, -2801, -5863,
+    -8485, -10470, -11668, -11991, -30000, -30000, -30000, -30000, -30000, -30000, -30000, -30000,
+    30000, 30000, 30000, 30000, 30000, 30000, 30000, 30000, -30000, -30000, -30000, -30000,
+    -30000, -30000, -30000, -30000, 30000, 30000, 30000, 30000, 30000, 30000, 30000, 30000,
+};
+static const uint8_t goldenBlocks[3][4 + GOLDEN_COUNT / 2] = {
+    {0x00, 0x00, 0x00, 0x00, 0x70, 0x77, 0x77, 0x77, 0x27, 0xdb, 0xba, 0xbb, 0x99, 0x20, 0x44, 0x34, 0x34, 0x22, 0x01, 0xb9},
+    {0xd0, 0x24, 0x3a, 0x00, 0xbd, 0xbd, 0xcb, 0xa9, 0x18, 0x31, 0x45, 0x33, 0x24, 0x11, 0x98, 0xda, 0xcb, 0xac, 0xab, 0x89},
+    {0x29, 0xd1, 0x3d, 0x00, 0xff, 0x09, 0x08, 0x08, 0x77, 0x02, 0x08, 0x08, 0xbf, 0x80, 0x80, 0x08, 0x37, 0x08, 0x80, 0x80},
+};
+// what adpcm2lin decodes from those blocks, the header sample first
+static const int16_t goldenDecoded[3][GOLDEN_COUNT + 1] = {
+    {0, 0, 11, 41, 104, 240, 533, 1164, 2521, 5431, 7509, 4863, 1084, -1432, -4634, -7543, -10189, -11219, -12155, -11871, -10580, -8468, -5912, -2820, 89, 3491, 6693, 8771, 10661, 11691, 12003, 11151, 9344},
+    {9424, 6843, 4439, 1004, -2198, -5107, -8509, -9881, -11959, -12337, -11307, -10371, -8383, -5543, -2141, 1061, 3970, 7372, 9659, 10905, 12039, 11696, 10760, 9340, 6500, 3854, 762, -2980, -5496, -8698, -10776, -11910, -12253},
+    {-11991, -16675, -26720, -31026, -29721, -30907, -29829, -30809, -29918, -17761, 8298, 26919, 30304, 27227, 30025, 27482, 29794, -1739, -30408, -26684, -30069, -26992, -29790, -32333, -30021, 1512, 30181, 26457, 29842, 32767, 29969, 32512, 30200},
+};
+
+// decodes one WAV block as IMA has it, the header sample and two codes per following byte
+static size_t decodeBlock(const uint8_t *block, size_t blockAlign, int16_t *out)
+{
+    const size_t samplesPerBlock = (blockAlign - 4) * 2 + 1;
+    int32_t predictor = (int16_t)(block[0] | (block[1] << 8));
+    int index = block[2];
+    out[0] = (int16_t)predictor;
+    for (size_t n = 1; n < samplesPerBlock; n++)
+    {
+        const uint8_t byte = block[4 + (n - 1) / 2];
+        const uint8_t code = ((n - 1) & 1) ? byte >> 4 : byte & 0x0f;
+        const int32_t step = imaStepTable[index];
+        int32_t delta = step >> 3;
+        if (code & 4)
+        {
+            delta += step;
+        }
+        if (code & 2)
+        {
+            delta += step >> 1;
+        }
+        if (code & 1)
+        {
+            delta += step >> 2;
+        }
+        predictor += (code & 8) ? -delta : delta;
+        predictor = predictor > 32767 ? 32767 : (predictor < -32768 ? -32768 : predictor);
+        index += imaIndexTable[code];
+        index = index < 0 ? 0 : (index > 88 ? 88 : index);
+        out[n] = (int16_t)predictor;
+    }
+    return samplesPerBlock;
+}
+
+static double snr(const std::vector<int16_t> &a, const std::vector<int16_t> &b)
+{
+    double signal = 0;
+    double error = 0;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        signal += (double)a[i] * a[i];
+        error += (double)(a[i] - b[i]) * (a[i] - b[i]);
+    }
+    return 10 * log10(signal / (error > 0 ? error : 1));
+}
+
+int main()
+{
+    {
+        ImaAdpcmEncoder encoder;
+        uint8_t block[4 + GOLDEN_COUNT / 2];
+        int16_t out[GOLDEN_COUNT + 1];
+        for (int b = 0; b < 3; b++)
+        {
+            CHECK_EQ(encoder.encodeBlock(&goldenPcm[b * GOLDEN_COUNT], GOLDEN_COUNT, block), sizeof(block));
+            CHECK(memcmp(block, goldenBlocks[b], sizeof(block)) == 0);
+            CHECK_EQ(decodeBlock(goldenBlocks[b], sizeof(block), out), GOLDEN_COUNT + 1);
+            CHECK(memcmp(out, goldenDecoded[b], sizeof(out)) == 0);
+        }
+    }
+
+    // the sizes the capture uses: 16 ms and 64 ms at 16 kHz
+    const size_t counts[] = {256, 1024};
+    for (size_t count : counts)
+    {
+        CHECK_EQ(ImaAdpcmEncoder::blockSize(count), 4 + count / 2);
+        CHECK_EQ(ImaAdpcmEncoder::samplesPerBlock(count), (ImaAdpcmEncoder::blockSize(count) - 4) * 2 + 1);
+
+        // 1 s of a 440 Hz tone, then a sweep from 200 Hz to 2 kHz with noise, at 16 kHz
+        const size_t total = 32000 / count * count;
+        std::vector<int16_t> pcm(total);
+        srand(2);
+        for (size_t i = 0; i < total; i++)
+        {
+            const double t = i / 16000.0 - 1.0;
+            pcm[i] = (int16_t)(t < 0 ? 12000 * sin(2 * M_PI * 440 * t) : 12000 * sin(2 * M_PI * (200 + 900 * t) * t) + rand() % 200 - 100);
+        }
+
+        ImaAdpcmEncoder encoder;
+        std::vector<uint8_t> block(ImaAdpcmEncoder::blockSize(count));
+        std::vector<int16_t> decoded;
+        int16_t out[1025];
+        size_t headerExact = 0;
+        size_t blocks = 0;
+        for (size_t i = 0; i < total; i += count)
+        {
+            CHECK_EQ(encoder.encodeBlock(&pcm[i], count, block.data()), block.size());
+            const size_t n = decodeBlock(block.data(), block.size(), out);
+            CHECK_EQ(n, ImaAdpcmEncoder::samplesPerBlock(count));
+            headerExact += out[0] == pcm[i > 0 ? i - 1 : 0];
+            decoded.insert(decoded.end(), out + 1, out + n);
+            blocks++;
+        }
+        // without the repeated header samples the decoded stream lines up with the PCM
+        CHECK_EQ(decoded.size(), pcm.size());
+        CHECK_EQ(headerExact, blocks);
+        const std::vector<int16_t> tone(pcm.begin(), pcm.begin() + total / 2);
+        const std::vector<int16_t> sweep(pcm.begin() + total / 2, pcm.end());
+        const double toneDb = snr(tone, std::vector<int16_t>(decoded.begin(), decoded.begin() + total / 2));
+        const double sweepDb = snr(sweep, std::vector<int16_t>(decoded.begin() + total / 2, decoded.end()));
+        printf("%4zu samples per block: %zu blocks, SNR %.1f dB tone, %.1f dB sweep\n", count, blocks, toneDb, sweepDb);
+        // 4 bits per sample give about 30 dB on a tone in the speech band, less as it rises
+        CHECK(toneDb > 30.0);
+        CHECK(sweepDb > 20.0);
+    }
+
+    // full scale square wave: the predictor saturates instead of wrapping and settles on
+    // each plateau
+    {
+        ImaAdpcmEncoder encoder;
+        std::vector<int16_t> pcm(2048);
+        for (size_t i = 0; i < pcm.size(); i++)
+        {
+            pcm[i] = ((i / 32) & 1) ? 32767 : -32768;
+        }
+        uint8_t block[4 + 128];
+        int16_t out[257];
+        std::vector<int16_t> decoded;
+        for (size_t i = 0; i < pcm.size(); i += 256)
+        {
+            encoder.encodeBlock(&pcm[i], 256, block);
+            decodeBlock(block, sizeof(block), out);
+            decoded.insert(decoded.end(), out + 1, out + 257);
+        }
+        for (size_t i = 31; i < pcm.size(); i += 32)
+        {
+            CHECK(abs(decoded[i] - pcm[i]) < 1024);
+        }
+    }
+
+    // a reset encoder produces the same stream again
+    {
+        int16_t pcm[256];
+        for (int i = 0; i < 256; i++)
+        {
+            pcm[i] = (int16_t)(i * 97);
+        }
+        ImaAdpcmEncoder encoder;
+        uint8_t first[132], again[132];
+        encoder.encodeBlock(pcm, 256, first);
+        encoder.encodeBlock(pcm, 256, again);
+        encoder.reset();
+        encoder.encodeBlock(pcm, 256, again);
+        CHECK(memcmp(first, again, sizeof(first)) == 0);
+    }
+
+    return checkResult();
+}
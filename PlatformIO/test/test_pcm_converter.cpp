@@ -0,0 +1,108 @@
+// PcmConverter over every input format it takes: each sample matches a plain reference
+// conversion, whether the input comes in one piece or split at arbitrary bytes
+#include <stdlib.h>
+#include <vector>
+#include "check.h"
+#include "PcmConverter.h"
+
+// the 16 bit value of a sample of any width, as WAV stores it
+static int16_t reference(const uint8_t *p, int bytes)
+{
+    switch (bytes)
+    {
+    case 1:
+        return (int16_t)((p[0] - 128) * 256);
+    case 2:
+        return (int16_t)(p[0] | (p[1] << 8));
+    default:
+        // the top 16 bits of 24 and 32 bit samples
+        return (int16_t)(p[bytes - 2] | (p[bytes - 1] << 8));
+    }
+}
+
+static std::vector<int16_t> expected(const std::vector<uint8_t> &in, int bytes, int inChannels, int outChannels)
+{
+    std::vector<int16_t> out;
+    const size_t frameBytes = bytes * inChannels;
+    for (size_t f = 0; f + frameBytes <= in.size(); f += frameBytes)
+    {
+        const int16_t left = reference(&in[f], bytes);
+        const int16_t right = inChannels > 1 ? reference(&in[f + bytes], bytes) : left;
+        if (outChannels == 1)
+        {
+            out.push_back(inChannels > 1 ? (int16_t)(((int32_t)left + right) >> 1) : left);
+        }
+        else
+        {
+            out.push_back(left);
+            out.push_back(right);
+        }
+    }
+    return out;
+}
+
+int main()
+{
+    srand(4);
+    const int depths[] = {8, 16, 24, 32};
+    int combinations = 0;
+    for (int bits : depths)
+    {
+        for (int inChannels = 1; inChannels <= 3; inChannels++)
+        {
+            for (int outChannels = 0; outChannels <= 2; outChannels++)
+            {
+                const int bytes = bits / 8;
+                const int resultChannels = outChannels > 0 ? outChannels : (inChannels > 2 ? 2 : inChannels);
+                std::vector<uint8_t> in(997 * bytes * inChannels);
+                for (auto &b : in)
+                {
+                    b = (uint8_t)rand();
+                }
+                const std::vector<int16_t> want = expected(in, bytes, inChannels, resultChannels);
+
+                // one piece, then split into pieces of 1 to 40 bytes
+                for (int split = 0; split < 2; split++)
+                {
+                    PcmConverter converter;
+                    CHECK(converter.configure(bits, inChannels, outChannels));
+                    CHECK_EQ(converter.outputChannels(), resultChannels);
+                    std::vector<int16_t> out(want.size() + 2);
+                    size_t produced = 0;
+                    size_t offset = 0;
+                    while (offset < in.size())
+                    {
+                        const size_t piece = split ? std::min((size_t)(1 + rand() % 40), in.size() - offset) : in.size();
+                        produced += converter.convert(&in[offset], piece, &out[produced]);
+                        offset += piece;
+                    }
+                    out.resize(produced);
+                    if (out != want)
+                    {
+                        printf("%d bits, %d to %d channels, %s: differs\n", bits, inChannels, resultChannels, split ? "split" : "whole");
+                    }
+                    CHECK(out == want);
+                }
+                combinations++;
+            }
+        }
+    }
+    printf("%d format combinations converted\n", combinations);
+
+    // formats it can not convert
+    PcmConverter converter;
+    CHECK(!converter.configure(12, 1, 2));
+    CHECK(!converter.configure(16, 0, 2));
+    CHECK(!converter.configure(32, 16, 2));
+    // a new format drops the incomplete frame of the old one
+    CHECK(converter.configure(16, 2, 2));
+    const uint8_t odd[3] = {1, 2, 3};
+    int16_t out[4];
+    CHECK_EQ(converter.convert(odd, 3, out), 0);
+    CHECK(converter.configure(16, 1, 1));
+    const uint8_t sample[2] = {0x34, 0x12};
+    CHECK_EQ(converter.convert(sample, 2, out), 1);
+    CHECK_EQ(out[0], 0x1234);
+
+    return checkResult();
+}
@@ -0,0 +1,136 @@
+// Playback of a streamed utterance whose chunks arrive with network jitter, simulated in 1 ms
+// steps: the chunks are pushed into audioData, the high watermark from playStartBytes sends
+// PLAY as audioDataFilled does, and I2Stask pops a block every 16 ms once playing. For each
+// jitter and play_start_ms it reports the time to first audio, from the first chunk to the
+// start of playback, and the underruns. A threshold of the jitter plus a chunk plus a block
+// plays without underruns and the start waits no longer than threshold and jitter.
+#include <stdlib.h>
+#include <deque>
+#include <vector>
+#include "check.h"
+#include "PlaybackStart.h"
+#include "SpscRingBuffer.h"
+
+static const int RATE = 16000; // mono 16 bit, as the TTS sends it
+static const int BYTES_PER_MS = RATE * 2 / 1000;
+static const int CHUNK_MS = 50;  // playBytesStreaming chunks, produced in real time
+static const int BLOCK_MS = 16;  // what I2Stask pops at a time
+static const int BLOCK_BYTES = BLOCK_MS * BYTES_PER_MS;
+
+static SpscRingBuffer<uint8_t, uint16_t, (1U << 15)> audioData;
+static bool playing = false;
+static void audioDataFilled() { playing = true; }
+
+struct Outcome
+{
+    int timeToFirstAudio = -1; // ms from the first chunk to the start of playback
+    int underruns = 0;
+};
+
+// chunk k is ready at (k + 1) * CHUNK_MS and arrives up to jitter ms later, in order
+static Outcome simulate(int utterance_ms, int jitter, int play_start_ms, unsigned seed)
+{
+    srand(seed);
+    const int chunks = utterance_ms / CHUNK_MS;
+    std::vector<int> arrival(chunks);
+    for (int k = 0; k < chunks; k++)
+    {
+        const int delay = jitter > 0 ? rand() % (jitter + 1) : 0;
+        arrival[k] = std::max(k > 0 ? arrival[k - 1] : 0, (k + 1) * CHUNK_MS + delay);
+    }
+
+    audioData.clear();
+    audioData.setWatermarks(playStartBytes(RATE, 1, 16, play_start_ms, audioData.maxSize()), audioDataFilled, 0, NULL);
+    playing = false;
+    std::vector<uint8_t> chunk(CHUNK_MS * BYTES_PER_MS);
+    uint16_t block[BLOCK_BYTES / 2];
+    Outcome outcome;
+    int next = 0;          // chunk to push
+    bool complete = false; // all chunks pushed, as finish_playback marks it
+    int nextBlock = 0;     // when I2Stask pops the next block
+    bool starved = false;
+    for (int t = 0; !(complete && playing && audioData.isEmpty()); t++)
+    {
+        // a full buffer holds the push back, as push_i2s_data waits for SPACE
+        while (next < chunks && arrival[next] <= t && audioData.push(chunk.data(), chunk.size()))
+        {
+            next++;
+        }
+        if (next < chunks && arrival[next] <= t)
+        {
+            audioDataFilled();
+        }
+        if (next == chunks && !complete)
+        {
+            complete = true;
+            playing = true;
+        }
+        if (playing && outcome.timeToFirstAudio < 0)
+        {
+            outcome.timeToFirstAudio = t - arrival[0];
+            nextBlock = t;
+        }
+        if (playing && t == nextBlock)
+        {
+            const size_t popped = audioData.popInto(block, BLOCK_BYTES / 2);
+            if (popped * 2 < (size_t)BLOCK_BYTES && !complete)
+            {
+                // counted once per gap, the concealment covers the rest of it
+                outcome.underruns += !starved;
+                starved = true;
+            }
+            else
+            {
+                starved = false;
+            }
+            nextBlock += BLOCK_MS;
+        }
+    }
+    return outcome;
+}
+
+int main()
+{
+    // the threshold: bytes of the format, at most half the buffer, no overflow
+    CHECK_EQ(playStartBytes(16000, 1, 16, 100, 1 << 15), 3200);
+    CHECK_EQ(playStartBytes(16000, 1, 16, -5, 1 << 15), 0);
+    CHECK_EQ(playStartBytes(16000, 1, 16, 5000, 1 << 15), 1 << 14);
+    CHECK_EQ(playStartBytes(48000, 2, 32, 2147483647, 1 << 15), 1 << 14);
+
+    const int jitters[] = {0, 50, 100, 200};
+    const int starts[] = {0, 50, 100, 200, 400};
+    for (int jitter : jitters)
+    {
+        for (int play_start_ms : starts)
+        {
+            // 3 s of speech, a few runs of different jitter
+            int worstStart = 0;
+            int underruns = 0;
+            for (unsigned seed = 1; seed <= 5; seed++)
+            {
+                const Outcome outcome = simulate(3000, jitter, play_start_ms, seed);
+                worstStart = std::max(worstStart, outcome.timeToFirstAudio);
+                underruns += outcome.underruns;
+                CHECK(outcome.timeToFirstAudio <= play_start_ms + jitter);
+                CHECK(outcome.timeToFirstAudio + CHUNK_MS + jitter >= play_start_ms);
+                if (play_start_ms >= jitter + CHUNK_MS + BLOCK_MS)
+                {
+                    CHECK_EQ(outcome.underruns, 0);
+                }
+            }
+            printf("jitter %3d ms, play_start_ms %3d: first audio after %3d ms at most, %2d underruns in 5 runs\n", jitter, play_start_ms, worstStart, underruns);
+            if (play_start_ms == 0 && jitter > 0)
+            {
+                // without a threshold the jitter shows
+                CHECK(underruns > 0);
+            }
+        }
+    }
+
+    // an utterance shorter than the threshold starts once it is complete
+    const Outcome shortOne = simulate(200, 50, 400, 1);
+    CHECK(shortOne.timeToFirstAudio >= 150 && shortOne.timeToFirstAudio <= 200);
+    CHECK_EQ(shortOne.underruns, 0);
+
+    return checkResult();
+}
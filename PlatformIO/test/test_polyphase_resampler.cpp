@@ -0,0 +1,110 @@
+// The generated polyphase tables and PolyphaseResampler: every phase has unity DC gain, DC
+// passes exactly, the output count follows the ratio and blocks of any size give the same
+// output as one long run
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+#include "check.h"
+#include "PolyphaseResampler.h"
+
+static const int BLOCK = 512;
+
+static std::vector<int16_t> resample(const PolyphaseTable &table, const std::vector<int16_t> &in, int channels, int outChannels, const std::vector<int> &blocks)
+{
+    PolyphaseResampler<BLOCK> resampler;
+    resampler.setRates(table.inRate, table.outRate, channels);
+    const size_t frames = in.size() / channels;
+    std::vector<int16_t> out;
+    std::vector<int16_t> buffer(resampler.maxOutput(BLOCK) * outChannels);
+    size_t done = 0;
+    for (size_t b = 0; done < frames; b++)
+    {
+        const size_t n = std::min((size_t)blocks[b % blocks.size()], frames - done);
+        const size_t produced = resampler.process(&in[done * channels], n, buffer.data(), outChannels);
+        CHECK(produced <= resampler.maxOutput(n));
+        out.insert(out.end(), buffer.begin(), buffer.begin() + produced * outChannels);
+        done += n;
+    }
+    return out;
+}
+
+int main()
+{
+    srand(6);
+    // the tables are the pairs the devices resample and no more, they all stay in flash: the
+    // Matrix Voice plays at 44.1 kHz, the AudioKit mic goes down to 16 kHz
+    CHECK_EQ(sizeof(polyphaseTables) / sizeof(polyphaseTables[0]), 8);
+    for (int rate : {16000, 22050, 24000})
+    {
+        CHECK(PolyphaseResampler<BLOCK>::hasTable(rate, 44100));
+        CHECK(!PolyphaseResampler<BLOCK>::hasTable(rate, 48000));
+    }
+    for (int rate : {22050, 24000, 32000, 44100, 48000})
+    {
+        CHECK(PolyphaseResampler<BLOCK>::hasTable(rate, 16000));
+    }
+    for (const PolyphaseTable &table : polyphaseTables)
+    {
+        // the tables describe the ratio exactly and fit the history of the resampler
+        CHECK_EQ((long long)table.inRate * table.up, (long long)table.outRate * table.down);
+        CHECK(table.taps <= POLYPHASE_MAX_TAPS);
+        CHECK_EQ(table.taps % 8, 0);
+        CHECK(PolyphaseResampler<BLOCK>::hasTable(table.inRate, table.outRate));
+
+        // every phase sums to unity, so DC passes at every output position
+        int wrongSums = 0;
+        for (int phase = 0; phase < table.up; phase++)
+        {
+            int32_t sum = 0;
+            for (int k = 0; k < table.taps; k++)
+            {
+                sum += table.coefficients[phase * table.taps + k];
+            }
+            wrongSums += sum != 32768;
+        }
+        CHECK_EQ(wrongSums, 0);
+
+        // DC in, the same DC out once the filter is filled, stereo and mono written as stereo
+        const size_t frames = table.inRate / 4;
+        std::vector<int16_t> dc(frames * 2);
+        for (size_t f = 0; f < frames; f++)
+        {
+            dc[2 * f] = -12345;
+            dc[2 * f + 1] = 32767;
+        }
+        const std::vector<int16_t> stereo = resample(table, dc, 2, 2, {BLOCK});
+        const std::vector<int16_t> mono = resample(table, std::vector<int16_t>(frames, 20000), 1, 2, {BLOCK});
+        const size_t settled = (size_t)table.taps * table.up / table.down + 1;
+        int wrongDc = 0;
+        for (size_t f = settled; f < stereo.size() / 2; f++)
+        {
+            wrongDc += stereo[2 * f] != -12345 || stereo[2 * f + 1] != 32767;
+            wrongDc += mono[2 * f] != 20000 || mono[2 * f + 1] != 20000;
+        }
+        CHECK_EQ(wrongDc, 0);
+
+        // the output follows the ratio to a frame
+        const double expected = (double)frames * table.up / table.down;
+        CHECK(fabs(stereo.size() / 2 - expected) <= 1.0);
+
+        // noise in blocks of random size matches one frame at a time and whole blocks
+        std::vector<int16_t> noise(frames * 2);
+        for (auto &s : noise)
+        {
+            s = (int16_t)(rand() % 65536 - 32768);
+        }
+        const std::vector<int16_t> whole = resample(table, noise, 2, 2, {BLOCK});
+        const std::vector<int16_t> split = resample(table, noise, 2, 2, {1, 511, 37, 3, 200});
+        CHECK(whole == split);
+        printf("%5d Hz to %5d Hz: %3d phases of %2d taps, %zu frames out of %zu\n", table.inRate, table.outRate, table.up, table.taps, whole.size() / 2, frames);
+    }
+
+    // no table, no output
+    PolyphaseResampler<BLOCK> none;
+    CHECK(!none.setRates(11025, 44100, 1));
+    CHECK(!none.isActive());
+    int16_t in[4] = {1, 2, 3, 4}, out[16];
+    CHECK_EQ(none.process(in, 4, out, 2), 0);
+
+    return checkResult();
+}
@@ -0,0 +1,98 @@
+// Runs the speex resampler over every quality and the rates the satellites see, built once
+// per inner product kernel of resample_kernels.h (KERNEL names it).
+//
+//   test_resample_kernel_generic out.raw           writes the output of the generic loops
+//   test_resample_kernel_X --compare out.raw       checks kernel X is bit-exact against it
+//   test_resample_kernel_X --bench                 prints the time per output sample
+#include <algorithm>
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "check.h"
+#include "speex_resampler.h"
+
+static const int RATES[] = {8000, 11025, 16000, 22050, 24000, 32000, 44100, 48000};
+
+int main(int argc, char **argv)
+{
+    const bool bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+    const char *compare = argc > 2 && strcmp(argv[1], "--compare") == 0 ? argv[2] : NULL;
+    const char *write = argc == 2 && !bench ? argv[1] : NULL;
+
+    // full scale noise, so the saturation is exercised as well
+    srand(1);
+    std::vector<int16_t> in(2 * 48000);
+    for (auto &s : in)
+    {
+        s = (int16_t)(rand() % 65536 - 32768);
+    }
+    std::vector<int16_t> out(2 * 200000);
+    std::vector<int16_t> all;
+    double seconds = 0;
+    size_t samples = 0;
+    for (int quality = 0; quality <= 10; quality++)
+    {
+        for (int rate : RATES)
+        {
+            for (int channels = 1; channels <= 2; channels++)
+            {
+                int err;
+                SpeexResamplerState *resampler = speex_resampler_init(channels, rate, 44100, quality, &err);
+                const int frames = bench ? 48000 : 4800;
+                int done = 0;
+                while (done < frames)
+                {
+                    // chunks of odd sizes, so the input sits at every alignment
+                    spx_uint32_t in_len = std::min(1 + rand() % 997, frames - done);
+                    spx_uint32_t out_len = out.size() / channels;
+                    const auto start = std::chrono::steady_clock::now();
+                    speex_resampler_process_interleaved_int(resampler, &in[done * channels], &in_len, out.data(), &out_len);
+                    seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    samples += out_len * channels;
+                    if (!bench)
+                    {
+                        all.insert(all.end(), out.begin(), out.begin() + out_len * channels);
+                    }
+                    done += in_len;
+                }
+                speex_resampler_destroy(resampler);
+            }
+        }
+    }
+
+    if (bench)
+    {
+        printf("%-9s %.2f ns per output sample over all qualities\n", KERNEL, seconds * 1e9 / samples);
+        return 0;
+    }
+    if (write != NULL)
+    {
+        FILE *f = fopen(write, "wb");
+        CHECK(f != NULL && fwrite(all.data(), sizeof(int16_t), all.size(), f) == all.size());
+        if (f != NULL)
+        {
+            fclose(f);
+        }
+    }
+    if (compare != NULL)
+    {
+        std::vector<int16_t> reference(all.size() + 1);
+        FILE *f = fopen(compare, "rb");
+        CHECK(f != NULL);
+        if (f != NULL)
+        {
+            const size_t read = fread(reference.data(), sizeof(int16_t), reference.size(), f);
+            fclose(f);
+            CHECK_EQ(read, all.size());
+            size_t differ = 0;
+            for (size_t i = 0; i < std::min(read, all.size()); i++)
+            {
+                differ += reference[i] != all[i];
+            }
+            printf("%s: %zu of %zu samples differ from the generic loops\n", KERNEL, differ, all.size());
+            CHECK_EQ(differ, 0);
+        }
+    }
+    return checkResult();
+}
@@ -0,0 +1,212 @@
+// SoundBank on a directory standing in for SPIFFS: uploads in parts replace a sound only once
+// complete, one with a gap or too large for the flash leaves the old sound, playing reads the
+// data chunk and nothing around it, and a sound the playback does not take is dropped again
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "check.h"
+#include "SoundBank.h"
+
+static void put16(std::vector<uint8_t> &wav, uint32_t v)
+{
+    wav.push_back(v & 0xff);
+    wav.push_back(v >> 8);
+}
+
+static void put32(std::vector<uint8_t> &wav, uint32_t v)
+{
+    put16(wav, v & 0xffff);
+    put16(wav, v >> 16);
+}
+
+static void putChunk(std::vector<uint8_t> &wav, const char *id, const std::vector<uint8_t> &data, uint32_t length)
+{
+    wav.insert(wav.end(), id, id + 4);
+    put32(wav, length);
+    wav.insert(wav.end(), data.begin(), data.end());
+    if (data.size() & 1)
+    {
+        wav.push_back(0);
+    }
+}
+
+// a PCM WAV of the samples with a LIST chunk before and after the data, as WAV editors write
+// them. dataLength is what the data chunk claims
+static std::vector<uint8_t> wavFile(const std::vector<uint8_t> &samples, int format = 1, uint32_t dataLength = 0)
+{
+    std::vector<uint8_t> fmt;
+    put16(fmt, format);
+    put16(fmt, 1);
+    put32(fmt, 22050);
+    put32(fmt, 44100);
+    put16(fmt, 2);
+    put16(fmt, 16);
+    const std::vector<uint8_t> list = {'I', 'N', 'F', 'O', 'I', 'S', 'F', 'T', 3, 0, 0, 0, 'a', 'b', 0};
+    std::vector<uint8_t> wav = {'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E'};
+    putChunk(wav, "fmt ", fmt, fmt.size());
+    putChunk(wav, "LIST", list, list.size());
+    putChunk(wav, "data", samples, dataLength > 0 ? dataLength : samples.size());
+    putChunk(wav, "LIST", list, list.size());
+    const uint32_t riff = wav.size() - 8;
+    memcpy(&wav[4], &riff, 4);
+    return wav;
+}
+
+// uploads the file in parts of partBytes, how the upload ended
+static SoundBank::UploadResult upload(SoundBank &bank, const std::string &name, const std::vector<uint8_t> &wav, size_t partBytes)
+{
+    SoundBank::UploadResult result = SoundBank::UPLOAD_PART;
+    for (size_t index = 0; index < wav.size() && result == SoundBank::UPLOAD_PART; index += partBytes)
+    {
+        result = bank.write(name, &wav[index], std::min(partBytes, wav.size() - index), index, wav.size());
+    }
+    return result;
+}
+
+// plays the sound to its end, what the playback got
+static std::vector<uint8_t> playAll(SoundBank &bank, const std::string &name)
+{
+    std::vector<uint8_t> played;
+    if (!bank.play(name, []() { return true; }))
+    {
+        return played;
+    }
+    uint8_t block[7];
+    while (!bank.finished())
+    {
+        const size_t received = bank.read(block, sizeof(block));
+        if (received == 0)
+        {
+            break;
+        }
+        played.insert(played.end(), block, block + received);
+    }
+    bank.finish();
+    return played;
+}
+
+int main()
+{
+    char root[] = "/tmp/sound_bank_XXXXXX";
+    CHECK(mkdtemp(root) != NULL);
+    SPIFFS.root = root;
+    mkdir((SPIFFS.root + "/sounds").c_str(), 0700);
+
+    std::vector<uint8_t> samples(101);
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        samples[i] = (uint8_t)(i * 7 + 1);
+    }
+    const std::vector<uint8_t> wav = wavFile(samples);
+    SoundBank bank;
+
+    CHECK(isValidSoundName("hotword"));
+    CHECK(isValidSoundName("a-b_9"));
+    CHECK(!isValidSoundName(""));
+    CHECK(!isValidSoundName("../x"));
+    CHECK(!isValidSoundName(std::string(SOUND_NAME_MAX_LENGTH + 1, 'a')));
+
+    // stored in parts, the samples come out and neither LIST chunk
+    {
+        CHECK_EQ(bank.write("beep", &wav[0], 10, 0, wav.size()), SoundBank::UPLOAD_PART);
+        CHECK(!SPIFFS.exists("/sounds/beep.wav"));
+        CHECK_EQ(upload(bank, "beep", wav, 10), SoundBank::UPLOAD_STORED);
+        CHECK(SPIFFS.exists("/sounds/beep.wav"));
+        CHECK(!SPIFFS.exists("/sounds/beep.tmp"));
+        CHECK(playAll(bank, "beep") == samples);
+        CHECK_EQ(bank.format().rate, 22050);
+        CHECK_EQ(bank.format().bits, 16);
+        CHECK_EQ(bank.format().channels, 1);
+        CHECK(!bank.isPlaying());
+    }
+
+    // a part missing: dropped, the rest of it skipped, the stored sound stays
+    {
+        const std::vector<uint8_t> other = wavFile(std::vector<uint8_t>(50, 9));
+        CHECK_EQ(bank.write("beep", &other[0], 10, 0, other.size()), SoundBank::UPLOAD_PART);
+        CHECK_EQ(bank.write("beep", &other[20], 10, 20, other.size()), SoundBank::UPLOAD_INCOMPLETE);
+        CHECK_EQ(bank.write("beep", &other[30], 10, 30, other.size()), SoundBank::UPLOAD_SKIPPED);
+        CHECK(!SPIFFS.exists("/sounds/beep.tmp"));
+        CHECK(playAll(bank, "beep") == samples);
+    }
+
+    // larger than the flash takes: dropped, the stored sound stays
+    {
+        SPIFFS.fileLimit = 40;
+        CHECK_EQ(upload(bank, "beep", wavFile(std::vector<uint8_t>(200, 3)), 16), SoundBank::UPLOAD_FULL);
+        SPIFFS.fileLimit = 0;
+        CHECK(!SPIFFS.exists("/sounds/beep.tmp"));
+        CHECK(playAll(bank, "beep") == samples);
+    }
+
+    // a data chunk which claims more than the file has plays what there is
+    {
+        std::vector<uint8_t> cut = wavFile(samples, 1, 100000);
+        cut.resize(cut.size() - 20);
+        CHECK_EQ(upload(bank, "cut", cut, 64), SoundBank::UPLOAD_STORED);
+        const std::vector<uint8_t> played = playAll(bank, "cut");
+        // the pad byte and the 4 bytes left of the LIST chunk come along
+        CHECK_EQ(played.size(), samples.size() + 1 + 4);
+        CHECK(std::equal(samples.begin(), samples.end(), played.begin()));
+    }
+
+    // no PCM, not RIFF or not there: nothing plays and nothing is asked to
+    {
+        CHECK_EQ(upload(bank, "adpcm", wavFile(samples, 0x11), 64), SoundBank::UPLOAD_STORED);
+        const std::vector<uint8_t> text(40, 'x');
+        CHECK_EQ(upload(bank, "text", text, 64), SoundBank::UPLOAD_STORED);
+        int asked = 0;
+        CHECK(!bank.play("adpcm", [&]() { return ++asked > 0; }));
+        CHECK(!bank.play("text", [&]() { return ++asked > 0; }));
+        CHECK(!bank.play("missing", [&]() { return ++asked > 0; }));
+        CHECK(!bank.play("../beep", [&]() { return ++asked > 0; }));
+        CHECK_EQ(asked, 0);
+        CHECK(!bank.isPlaying());
+    }
+
+    // the playback takes the sound: it is set up by the time it is asked, and it is not
+    // replaced while it plays
+    {
+        bool ready = false;
+        CHECK(bank.play("beep", [&]() {
+            ready = bank.isPlaying() && bank.format().dataBytes == samples.size();
+            return true;
+        }));
+        CHECK(ready);
+        CHECK(bank.isPlaying());
+        CHECK(!bank.play("cut", []() { return true; }));
+        CHECK_EQ(bank.write("beep", &wav[0], 10, 0, wav.size()), SoundBank::UPLOAD_PLAYING);
+        CHECK_EQ(bank.write("cut", &wav[0], 10, 0, wav.size()), SoundBank::UPLOAD_PART);
+        bank.finish();
+        CHECK(!bank.isPlaying());
+    }
+
+    // the state ignores the PlayAudioEvent: the sound is dropped, nothing stays playing and the
+    // next one plays
+    {
+        CHECK(!bank.play("beep", []() { return false; }));
+        CHECK(!bank.isPlaying());
+        CHECK_EQ(upload(bank, "beep", wav, 100), SoundBank::UPLOAD_STORED);
+        CHECK(playAll(bank, "beep") == samples);
+    }
+
+    // an empty upload removes the sound
+    {
+        CHECK_EQ(bank.write("beep", NULL, 0, 0, 0), SoundBank::UPLOAD_REMOVED);
+        CHECK(!SPIFFS.exists("/sounds/beep.wav"));
+        CHECK(playAll(bank, "beep").empty());
+    }
+
+    for (const char *name : {"cut", "adpcm", "text"})
+    {
+        SPIFFS.remove(soundPath(name, ".wav").c_str());
+    }
+    SPIFFS.remove("/sounds/cut.tmp");
+    rmdir((SPIFFS.root + "/sounds").c_str());
+    rmdir(root);
+    return checkResult();
+}
@@ -0,0 +1,123 @@
+// SpscQueue between a capture and a publish thread: a stalled publisher must not hold up
+// capture, full slots are dropped by the producer and what arrives is in order and intact
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include "check.h"
+#include "SpscQueue.h"
+
+typedef std::chrono::steady_clock Clock;
+
+struct Frame
+{
+    uint32_t sequence;
+    uint32_t data[128];
+};
+
+int main()
+{
+    // one thread: FIFO order and the full and empty edges
+    {
+        SpscQueue<int, 4> queue;
+        CHECK(queue.isEmpty());
+        CHECK(queue.front() == NULL);
+        for (int i = 0; i < 4; i++)
+        {
+            int *slot = queue.acquire();
+            CHECK(slot != NULL);
+            *slot = i;
+            queue.commit();
+        }
+        CHECK(queue.isFull());
+        CHECK(queue.acquire() == NULL);
+        for (int i = 0; i < 4; i++)
+        {
+            CHECK_EQ(*queue.front(), i);
+            queue.release();
+        }
+        CHECK(queue.isEmpty());
+        *queue.acquire() = 7;
+        queue.commit();
+        queue.clear();
+        CHECK(queue.isEmpty());
+    }
+
+    // capture every 200 us, the publisher stalls for 20 ms out of every 30
+    {
+        static SpscQueue<Frame, 4> queue;
+        const uint32_t FRAMES = 2000;
+        std::atomic<bool> done{false};
+        uint32_t captured = 0;
+        uint32_t dropped = 0;
+        double longestCapture = 0;
+        std::thread capture([&] {
+            Frame overrun;
+            Clock::time_point next = Clock::now();
+            for (uint32_t sequence = 0; sequence < FRAMES; sequence++)
+            {
+                next += std::chrono::microseconds(200);
+                std::this_thread::sleep_until(next);
+                const Clock::time_point start = Clock::now();
+                Frame *frame = queue.acquire();
+                Frame *target = frame != NULL ? frame : &overrun;
+                target->sequence = sequence;
+                for (int i = 0; i < 128; i++)
+                {
+                    target->data[i] = sequence * 131 + i;
+                }
+                if (frame != NULL)
+                {
+                    queue.commit();
+                    captured++;
+                }
+                else
+                {
+                    dropped++;
+                }
+                longestCapture = std::max(longestCapture, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+            }
+            done = true;
+        });
+
+        uint32_t published = 0;
+        uint32_t corrupt = 0;
+        int64_t last = -1;
+        bool ordered = true;
+        Clock::time_point stallAt = Clock::now() + std::chrono::milliseconds(10);
+        while (!done || !queue.isEmpty())
+        {
+            if (Clock::now() >= stallAt)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                stallAt = Clock::now() + std::chrono::milliseconds(10);
+            }
+            Frame *frame = queue.front();
+            if (frame == NULL)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            ordered &= (int64_t)frame->sequence > last;
+            last = frame->sequence;
+            for (int i = 0; i < 128; i++)
+            {
+                corrupt += frame->data[i] != frame->sequence * 131 + i;
+            }
+            queue.release();
+            published++;
+        }
+        capture.join();
+
+        printf("captured %u, dropped %u, published %u, longest capture step %.3f ms\n", captured, dropped, published, longestCapture);
+        CHECK_EQ(captured + dropped, FRAMES);
+        CHECK_EQ(published, captured);
+        CHECK(dropped > 0);
+        CHECK(ordered);
+        CHECK_EQ(corrupt, 0);
+        // the stalls take 20 ms, capture never waits for them
+        CHECK(longestCapture < 10.0);
+    }
+
+    return checkResult();
+}
@@ -0,0 +1,116 @@
+// SpscRingBuffer between two threads: a producer pushing chunks of random size and a
+// consumer popping blocks of random size see every byte in order across many thousand wrap
+// arounds. Also fills and drains through the spans on one thread.
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+#include "check.h"
+#include "SpscRingBuffer.h"
+
+static const size_t TOTAL = 64 << 20;
+
+static uint8_t pattern(size_t position) { return (uint8_t)(position * 7 + (position >> 8)); }
+
+int main()
+{
+    {
+        SpscRingBuffer<uint8_t, uint16_t, 1 << 15> ring;
+        std::thread producer([&ring] {
+            std::mt19937 random(1);
+            std::vector<uint8_t> chunk(4000);
+            size_t sent = 0;
+            while (sent < TOTAL)
+            {
+                const size_t n = std::min((size_t)(1 + random() % chunk.size()), TOTAL - sent);
+                for (size_t i = 0; i < n; i++)
+                {
+                    chunk[i] = pattern(sent + i);
+                }
+                while (!ring.push(chunk.data(), n))
+                {
+                    std::this_thread::yield();
+                }
+                sent += n;
+            }
+        });
+        std::mt19937 random(2);
+        std::vector<uint16_t> out(2000);
+        size_t received = 0, errors = 0;
+        while (received < TOTAL)
+        {
+            const size_t popped = ring.popInto(out.data(), 1 + random() % out.size());
+            if (popped == 0)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            const uint8_t *bytes = reinterpret_cast<const uint8_t *>(out.data());
+            for (size_t i = 0; i < popped * sizeof(uint16_t); i++)
+            {
+                errors += bytes[i] != pattern(received + i);
+            }
+            received += popped * sizeof(uint16_t);
+        }
+        producer.join();
+        printf("two threads: %zu MB through, %zu bytes wrong\n", received >> 20, errors);
+        CHECK_EQ(received, TOTAL);
+        CHECK_EQ(errors, 0);
+        CHECK(ring.isEmpty());
+    }
+
+    {
+        // spans of every length against a small buffer, so they keep hitting the wrap around
+        SpscRingBuffer<uint8_t, uint16_t, 16> ring;
+        size_t written = 0, read = 0, errors = 0, shortSpans = 0;
+        for (int k = 0; k < 100000; k++)
+        {
+            size_t n;
+            uint8_t *w = ring.writeSpan(n);
+            CHECK(n <= ring.freeSize());
+            shortSpans += n < ring.freeSize();
+            n = std::min(n, (size_t)(k % 13));
+            for (size_t i = 0; i < n; i++)
+            {
+                w[i] = pattern(written + i);
+            }
+            ring.commitWrite(n);
+            written += n;
+
+            const uint8_t *r = ring.readSpan(n);
+            CHECK(n <= ring.size());
+            n = std::min(n, (size_t)(k % 11));
+            for (size_t i = 0; i < n; i++)
+            {
+                errors += r[i] != pattern(read + i);
+            }
+            ring.commitRead(n);
+            read += n;
+        }
+        printf("spans: %zu bytes through, %zu spans cut at the wrap around\n", read, shortSpans);
+        CHECK_EQ(errors, 0);
+        CHECK(shortSpans > 0);
+        CHECK_EQ(ring.size(), written - read);
+    }
+
+    {
+        // all or nothing, and only whole output items come out
+        SpscRingBuffer<uint8_t, uint16_t, 4> ring;
+        uint8_t bytes[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+        CHECK(!ring.push(bytes, 9));
+        CHECK(ring.isEmpty());
+        CHECK(ring.push(bytes, 3));
+        CHECK_EQ(ring.available(), 1);
+        uint16_t out[4];
+        CHECK_EQ(ring.popInto(out, 4), 1);
+        CHECK_EQ(out[0], 0x0201);
+        CHECK(ring.push(bytes + 2, 7));
+        CHECK(ring.isFull());
+        CHECK(ring.popFromISR(out[0]));
+        CHECK_EQ(out[0], 0x0303);
+        ring.clear();
+        CHECK(ring.isEmpty());
+        CHECK_EQ(ring.freeSize(), ring.maxSize());
+    }
+    return checkResult();
+}
@@ -0,0 +1,124 @@
+// The block loop of MatrixVoice::writeAudio on the host: resampling to 44.1 kHz stereo gives
+// the same samples however the input is chunked, and as many as the ratio says
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+#include "check.h"
+#include "PolyphaseResampler.h"
+#include "speex_resampler.h"
+
+// as in MatrixVoice.hpp
+static const int POLYPHASE_BLOCK_FRAMES = 512;
+static const int RESAMPLED_FRAMES = POLYPHASE_BLOCK_FRAMES * 441 / 160 + 1;
+
+struct Writer
+{
+    SpeexResamplerState *resampler;
+    PolyphaseResampler<POLYPHASE_BLOCK_FRAMES> polyphase;
+    int16_t resampled[RESAMPLED_FRAMES * 2];
+    int channels;
+    std::vector<int16_t> played;
+
+    Writer(int rate, int numChannels, bool usePolyphase) : channels(numChannels)
+    {
+        int err;
+        resampler = speex_resampler_init(2, 44100, 44100, 0, &err);
+        if (!usePolyphase || !polyphase.setRates(rate, 44100, channels))
+        {
+            polyphase.disable();
+            speex_resampler_set_rate(resampler, rate, 44100);
+            speex_resampler_skip_zeros(resampler);
+            speex_resampler_set_output_stride(resampler, 2);
+        }
+    }
+
+    ~Writer() { speex_resampler_destroy(resampler); }
+
+    // writeAudio without the 44.1 kHz shortcut, playBytes appends to played
+    void write(const int16_t *input, size_t frames)
+    {
+        while (frames > 0)
+        {
+            size_t block;
+            size_t out_len;
+            if (polyphase.isActive())
+            {
+                block = std::min(frames, (size_t)POLYPHASE_BLOCK_FRAMES);
+                out_len = polyphase.process(input, block, resampled, 2);
+            }
+            else
+            {
+                spx_uint32_t in_len = frames;
+                spx_uint32_t out_frames = RESAMPLED_FRAMES;
+                if (channels == 2)
+                {
+                    speex_resampler_process_interleaved_int(resampler, input, &in_len, resampled, &out_frames);
+                }
+                else
+                {
+                    speex_resampler_process_int(resampler, 0, input, &in_len, resampled, &out_frames);
+                    for (spx_uint32_t i = 0; i < out_frames; i++)
+                    {
+                        resampled[2 * i + 1] = resampled[2 * i];
+                    }
+                }
+                if (in_len == 0 && out_frames == 0)
+                {
+                    break;
+                }
+                block = in_len;
+                out_len = out_frames;
+            }
+            played.insert(played.end(), resampled, resampled + out_len * 2);
+            input += block * channels;
+            frames -= block;
+        }
+    }
+};
+
+int main()
+{
+    const int rates[] = {8000, 11025, 16000, 22050, 24000, 32000, 48000};
+    srand(7);
+    for (int rate : rates)
+    {
+        for (int channels = 1; channels <= 2; channels++)
+        {
+            for (int usePolyphase = 0; usePolyphase <= 1; usePolyphase++)
+            {
+                if (usePolyphase && !PolyphaseResampler<POLYPHASE_BLOCK_FRAMES>::hasTable(rate, 44100))
+                {
+                    continue;
+                }
+                // 2 s of a tone per channel
+                const size_t frames = 2 * rate;
+                std::vector<int16_t> in(frames * channels);
+                for (size_t f = 0; f < frames; f++)
+                {
+                    for (int c = 0; c < channels; c++)
+                    {
+                        in[f * channels + c] = (int16_t)(10000 * sin(2 * M_PI * (440 + 100 * c) * f / rate));
+                    }
+                }
+                Writer whole(rate, channels, usePolyphase);
+                whole.write(in.data(), frames);
+                // chunks of 1 to 3000 frames, the way MQTT messages arrive
+                Writer chunked(rate, channels, usePolyphase);
+                size_t done = 0;
+                while (done < frames)
+                {
+                    const size_t n = std::min((size_t)(1 + rand() % 3000), frames - done);
+                    chunked.write(&in[done * channels], n);
+                    done += n;
+                }
+                const double expected = (double)frames * 44100 / rate;
+                const double produced = whole.played.size() / 2;
+                printf("%5d Hz %d channel(s) %s: %.0f frames for %.0f expected\n", rate, channels, usePolyphase ? "polyphase" : "speex    ", produced, expected);
+                CHECK(whole.played == chunked.played);
+                // speex keeps its filter delay inside, at most a filter length
+                CHECK(produced <= expected + 1 && produced >= expected - 100);
+            }
+        }
+    }
+    return checkResult();
+}
@@ -0,0 +1,149 @@
+// StreamingChunks: chunks in any order and in parts play in order, the limits on early chunks
+// hold, and requests interleaved with each other or with playBytes do not mix
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "check.h"
+#include "StreamingChunks.h"
+
+// every byte of a chunk is its index, so what was played shows where it came from
+struct Recorder
+{
+    std::string events;
+    std::vector<uint8_t> played;
+    int finished = 0;
+    std::vector<int> given;   // chunks given up on
+    std::vector<int> dropped; // chunks dropped for the byte cap
+
+    void play(const uint8_t *data, size_t len, bool chunkStart, bool requestStart)
+    {
+        if (chunkStart)
+        {
+            events += requestStart ? "S" : "s";
+            events += std::to_string(data[0]);
+        }
+        played.insert(played.end(), data, data + len);
+    }
+    void finish()
+    {
+        finished++;
+        events += "F";
+    }
+    void lost(int chunkIndex, bool wasDropped)
+    {
+        (wasDropped ? dropped : given).push_back(chunkIndex);
+    }
+};
+
+// sends chunk index of request in parts of at most part bytes
+static void send(StreamingChunks &chunks, Recorder &player, const std::string &request, int index, bool last, size_t size = 100, size_t part = 1000)
+{
+    std::vector<uint8_t> chunk(size, (uint8_t)index);
+    for (size_t offset = 0; offset < size; offset += part)
+    {
+        chunks.receive(request, index, last, &chunk[offset], std::min(part, size - offset), offset, size, player);
+    }
+}
+
+int main()
+{
+    {
+        // out of order and in parts, each chunk plays once, in order, and the request finishes
+        StreamingChunks chunks;
+        Recorder player;
+        const int order[] = {1, 0, 3, 2, 2, 0, 5, 4};
+        for (int index : order)
+        {
+            send(chunks, player, "a", index, index == 5, 100, 33);
+        }
+        CHECK(player.events == "FS0s1s2s3s4s5F");
+        std::vector<uint8_t> expected;
+        for (int i = 0; i <= 5; i++)
+        {
+            expected.insert(expected.end(), 100, (uint8_t)i);
+        }
+        CHECK(player.played == expected);
+        CHECK_EQ(chunks.pendingSize(), 0);
+        // repeats after the end are ignored
+        send(chunks, player, "a", 5, true);
+        CHECK_EQ(player.finished, 2);
+    }
+
+    {
+        // a missing first chunk is given up on past the count, the next one starts the request
+        StreamingChunks chunks;
+        Recorder player;
+        for (int index = 1; index <= (int)StreamingChunks::MAX_PENDING_CHUNKS + 1; index++)
+        {
+            send(chunks, player, "a", index, false);
+        }
+        CHECK(player.given == std::vector<int>{0});
+        CHECK(player.events.substr(0, 3) == "FS1");
+        CHECK_EQ(chunks.pendingChunks(), 0);
+        send(chunks, player, "a", 0, false);
+        CHECK_EQ(player.played.size(), 100 * (StreamingChunks::MAX_PENDING_CHUNKS + 1));
+    }
+
+    {
+        // large early chunks never hold more than the cap, the one which does not fit is
+        // dropped and the missing one given up on, the rest plays on
+        StreamingChunks chunks;
+        Recorder player;
+        const size_t size = StreamingChunks::MAX_PENDING_BYTES / 3;
+        send(chunks, player, "a", 0, false, size, 1460);
+        size_t largest = 0;
+        for (int index = 2; index <= 6; index++)
+        {
+            std::vector<uint8_t> chunk(size, (uint8_t)index);
+            for (size_t offset = 0; offset < size; offset += 1460)
+            {
+                chunks.receive("a", index, index == 6, &chunk[offset], std::min((size_t)1460, size - offset), offset, size, player);
+                largest = std::max(largest, chunks.pendingSize());
+            }
+        }
+        printf("cap: at most %zu of %zu bytes held, %d dropped, %d given up on, %s\n", largest, StreamingChunks::MAX_PENDING_BYTES, (int)player.dropped.size(), (int)player.given.size(), player.events.c_str());
+        CHECK(largest <= StreamingChunks::MAX_PENDING_BYTES);
+        CHECK(player.dropped == std::vector<int>{5});
+        CHECK(player.given == std::vector<int>{1});
+        CHECK(player.events == "FS0s2s3s4s6F");
+        // the missing chunk comes too late
+        send(chunks, player, "a", 1, false, size, 1460);
+        CHECK_EQ(player.played.size(), 5 * size);
+    }
+
+    {
+        // a playBytes request takes over in the middle of a request, the rest of it is not
+        // played, and the pending chunks are gone
+        StreamingChunks chunks;
+        Recorder player;
+        send(chunks, player, "a", 0, false);
+        send(chunks, player, "a", 2, false);
+        CHECK_EQ(chunks.pendingChunks(), 1);
+        chunks.takeOver();
+        CHECK_EQ(chunks.pendingChunks(), 0);
+        CHECK_EQ(chunks.pendingSize(), 0);
+        send(chunks, player, "a", 1, false);
+        send(chunks, player, "a", 3, true);
+        CHECK(player.events == "FS0");
+        // the next request starts from its first chunk
+        send(chunks, player, "b", 0, false);
+        send(chunks, player, "b", 1, true);
+        CHECK(player.events == "FS0FS0s1F");
+    }
+
+    {
+        // two requests interleaved, the later one ends the earlier, whose late chunks are
+        // ignored instead of starting it again
+        StreamingChunks chunks;
+        Recorder player;
+        send(chunks, player, "a", 0, false);
+        send(chunks, player, "b", 0, false);
+        send(chunks, player, "a", 1, false);
+        send(chunks, player, "b", 1, false);
+        send(chunks, player, "a", 2, true);
+        send(chunks, player, "b", 2, true);
+        CHECK(player.events == "FS0FS0s1s2F");
+        CHECK_EQ(player.played.size(), 400);
+    }
+    return checkResult();
+}
@@ -0,0 +1,76 @@
+// UnderrunConcealer under injected starvation: gaps of any length between blocks of any size
+// never make the output jump by more than the signal itself does
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+#include "check.h"
+#include "UnderrunConcealer.h"
+
+static int largestJump(const std::vector<int16_t> &out, int channels)
+{
+    int largest = 0;
+    for (size_t i = channels; i < out.size(); i++)
+    {
+        largest = std::max(largest, abs(out[i] - out[i - channels]));
+    }
+    return largest;
+}
+
+int main()
+{
+    const int CHANNELS = 2;
+    // a 440 Hz tone at 16 kHz moves by at most 10000 * 2 pi * 440 / 16000 = 1728 per sample
+    const int AMPLITUDE = 10000;
+    const int SIGNAL_STEP = (int)ceil(AMPLITUDE * 2 * M_PI * 440 / 16000);
+    int16_t block[512 * CHANNELS];
+    size_t position = 0;
+    srand(5);
+
+    UnderrunConcealer concealer;
+    std::vector<int16_t> out;
+    std::vector<int16_t> cut;
+    int gaps = 0;
+    for (int round = 0; round < 2000; round++)
+    {
+        const size_t frames = 1 + rand() % 512;
+        for (size_t f = 0; f < frames; f++, position++)
+        {
+            block[f * CHANNELS] = block[f * CHANNELS + 1] = (int16_t)(AMPLITUDE * sin(2 * M_PI * 440 * position / 16000));
+        }
+        cut.insert(cut.end(), block, block + frames * CHANNELS);
+        concealer.play(block, frames, CHANNELS);
+        CHECK(!concealer.isConcealing());
+        out.insert(out.end(), block, block + frames * CHANNELS);
+
+        // one round in three the ring runs dry, for 1 to 200 frames
+        if (rand() % 3 == 0)
+        {
+            const size_t gap = 1 + rand() % 200;
+            int16_t fill[200 * CHANNELS];
+            concealer.conceal(fill, gap, CHANNELS);
+            CHECK(concealer.isConcealing());
+            out.insert(out.end(), fill, fill + gap * CHANNELS);
+            cut.insert(cut.end(), gap * CHANNELS, 0);
+            gaps++;
+        }
+    }
+
+    const int concealedJump = largestJump(out, CHANNELS);
+    const int cutJump = largestJump(cut, CHANNELS);
+    printf("%d gaps: largest jump %d concealed, %d cut to silence, %d in the tone\n", gaps, concealedJump, cutJump, SIGNAL_STEP);
+    // the fades add at most 1/64 of full scale per frame on top of the tone
+    CHECK(concealedJump <= SIGNAL_STEP + 32768 / 64);
+    CHECK(cutJump > 4 * SIGNAL_STEP);
+
+    // a long gap ends in silence, and after a reset a stream starts at full level
+    int16_t fill[128 * CHANNELS];
+    concealer.conceal(fill, 128, CHANNELS);
+    CHECK_EQ(fill[127 * CHANNELS], 0);
+    concealer.reset();
+    int16_t first[2] = {1000, -1000};
+    concealer.play(first, 1, CHANNELS);
+    CHECK_EQ(first[0], 1000);
+    CHECK_EQ(first[1], -1000);
+
+    return checkResult();
+}
@@ -0,0 +1,110 @@
+// VoiceActivityDetector on synthetic audio: quiet noise keeps the gate closed, a voiced burst
+// opens it within a frame and the hangover bridges short pauses. PrerollBuffer keeps the
+// newest bytes in order.
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+#include "check.h"
+#include "VoiceActivityGate.h"
+
+static const int RATE = 16000;
+static const int FRAME = 256; // 16 ms
+
+// white noise of the given peak
+static void noise(int16_t *out, int count, int peak)
+{
+    for (int i = 0; i < count; i++)
+    {
+        out[i] = (int16_t)(rand() % (2 * peak + 1) - peak);
+    }
+}
+
+// a vowel like tone, 150 Hz with a few harmonics, on top of the noise
+static void voice(int16_t *out, int count, int start, int peak)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const double t = (double)(start + i) / RATE;
+        const double v = sin(2 * M_PI * 150 * t) + 0.5 * sin(2 * M_PI * 300 * t) + 0.25 * sin(2 * M_PI * 450 * t);
+        out[i] = (int16_t)(out[i] + peak * v / 1.75);
+    }
+}
+
+int main()
+{
+    srand(1);
+    int16_t frame[FRAME];
+
+    // 2 s of quiet room noise, 1 s of speech, 0.3 s pause, 0.5 s of speech, 2 s of noise
+    VoiceActivityDetector detector;
+    std::vector<bool> open;
+    int sample = 0;
+    const int noiseEnd = 2 * RATE / FRAME;
+    const int speechEnd = noiseEnd + RATE / FRAME;
+    const int pauseEnd = speechEnd + 3 * RATE / 10 / FRAME;
+    const int speech2End = pauseEnd + RATE / 2 / FRAME;
+    const int total = speech2End + 2 * RATE / FRAME;
+    for (int f = 0; f < total; f++, sample += FRAME)
+    {
+        noise(frame, FRAME, 200);
+        if ((f >= noiseEnd && f < speechEnd) || (f >= pauseEnd && f < speech2End))
+        {
+            voice(frame, FRAME, sample, 8000);
+        }
+        open.push_back(detector.process(frame, FRAME, 16));
+    }
+
+    // the floor settles within the first half second, after that noise stays out
+    int falseOpen = 0;
+    for (int f = RATE / 2 / FRAME; f < noiseEnd; f++)
+    {
+        falseOpen += open[f];
+    }
+    CHECK_EQ(falseOpen, 0);
+    // speech opens the gate on its first frame, so nothing of the onset is lost
+    CHECK(open[noiseEnd]);
+    int closedInSpeech = 0;
+    for (int f = noiseEnd; f < speech2End; f++)
+    {
+        closedInSpeech += !open[f];
+    }
+    // the pause is shorter than the hangover
+    CHECK_EQ(closedInSpeech, 0);
+    // and after the hangover (800 ms) the gate closes again
+    CHECK(!open[speech2End + 900 / 16]);
+    int opened = 0;
+    for (bool o : open)
+    {
+        opened += o;
+    }
+    printf("gate open for %d of %d frames, %.0f %% of the bandwidth saved\n", opened, total, 100.0 * (total - opened) / total);
+
+    // pre-roll: the newest frames in order, older ones overwritten
+    PrerollBuffer<1024> preroll;
+    preroll.reset(3 * 100);
+    uint8_t bytes[100];
+    size_t lost = 0;
+    for (int f = 0; f < 5; f++)
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            bytes[i] = (uint8_t)(f * 100 + i);
+        }
+        lost += preroll.push(bytes, 100);
+    }
+    CHECK_EQ(lost, 200);
+    CHECK_EQ(preroll.size(), 300);
+    for (int f = 2; f < 5; f++)
+    {
+        CHECK(preroll.pop(bytes, 100));
+        CHECK_EQ(bytes[0], (uint8_t)(f * 100));
+        CHECK_EQ(bytes[99], (uint8_t)(f * 100 + 99));
+    }
+    CHECK(preroll.isEmpty());
+    CHECK(!preroll.pop(bytes, 1));
+    // a frame larger than the pre-roll is not stored at all
+    CHECK_EQ(preroll.push(bytes, 400), 400);
+    CHECK(preroll.isEmpty());
+
+    return checkResult();
+}
@@ -0,0 +1,119 @@
+// VolumeRamp: unity leaves samples alone, the first block is at the volume set before, a volume
+// change ramps smoothly over blocks of any size without steps at the block edges, and full
+// scale input never wraps
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "check.h"
+#include "VolumeRamp.h"
+
+// runs frames of stereo DC through ramp in blocks of the given sizes, changing the volume
+// to volume2 at frame change
+static std::vector<int16_t> run(const std::vector<int> &blocks, int16_t level, int volume1, int volume2, size_t change, size_t frames)
+{
+    VolumeRamp ramp;
+    ramp.setVolume(volume1);
+    std::vector<int16_t> out(frames * 2, level);
+    size_t done = 0;
+    for (size_t b = 0; done < frames; b++)
+    {
+        if (done >= change)
+        {
+            ramp.setVolume(volume2);
+        }
+        const size_t n = std::min((size_t)blocks[b % blocks.size()], frames - done);
+        ramp.process(&out[done * 2], n, 2);
+        done += n;
+    }
+    return out;
+}
+
+int main()
+{
+    // unity is bit exact, also for the most negative sample
+    {
+        VolumeRamp ramp;
+        ramp.setVolume(100);
+        int16_t samples[512];
+        for (int i = 0; i < 512; i++)
+        {
+            samples[i] = (int16_t)(rand() - RAND_MAX / 2);
+        }
+        samples[0] = -32768;
+        samples[1] = 32767;
+        int16_t copy[512];
+        memcpy(copy, samples, sizeof(copy));
+        ramp.process(samples, 256, 2);
+        CHECK(memcmp(samples, copy, sizeof(copy)) == 0);
+    }
+
+    // the volume set before playing applies from the first sample on, there is no ramp down
+    // from unity
+    {
+        VolumeRamp ramp;
+        ramp.setVolume(30);
+        std::vector<int16_t> first(64 * 2, 30000);
+        ramp.process(first.data(), 64, 2);
+        const int16_t level = (30000 * (30 * 30 * 32768 / 10000)) >> 15;
+        CHECK_EQ(first[0], level);
+        CHECK_EQ(first[63 * 2 + 1], level);
+    }
+
+    // 100 to 30, starting at frame 1000, in blocks of 256 and in odd blocks
+    const size_t FRAMES = 4000;
+    const std::vector<int16_t> whole = run({256}, 30000, 100, 30, 1024, FRAMES);
+    const std::vector<int16_t> odd = run({1, 7, 100, 33, 256}, 30000, 100, 30, 1024, FRAMES);
+    int largestStep = 0;
+    bool monotonic = true;
+    for (size_t f = 1; f < FRAMES; f++)
+    {
+        const int step = whole[f * 2] - whole[(f - 1) * 2];
+        largestStep = std::max(largestStep, abs(step));
+        monotonic &= step <= 0;
+        CHECK_EQ(whole[f * 2], whole[f * 2 + 1]);
+    }
+    printf("100 to 30: largest step between frames %d\n", largestStep);
+    CHECK(monotonic);
+    // 30000 * (1 - 0.09) spread over 256 frames is about 107 per frame
+    CHECK(largestStep <= 120);
+    CHECK_EQ(whole[FRAMES * 2 - 1], (30000 * (30 * 30 * 32768 / 10000)) >> 15);
+    // the ramp does not care where the blocks end, it only starts at the next block
+    int lastDifferent = -1;
+    for (size_t i = 0; i < whole.size(); i++)
+    {
+        lastDifferent = whole[i] != odd[i] ? (int)i : lastDifferent;
+    }
+    int largestOddStep = 0;
+    for (size_t f = 1; f < FRAMES; f++)
+    {
+        largestOddStep = std::max(largestOddStep, abs(odd[f * 2] - odd[(f - 1) * 2]));
+    }
+    CHECK(largestOddStep <= 120);
+    CHECK(lastDifferent < (int)(1024 + 256 + 256) * 2);
+
+    // up from silence to full volume with full scale samples: no wrap around
+    {
+        VolumeRamp ramp;
+        ramp.setVolume(0);
+        std::vector<int16_t> settle(512 * 2, 1000);
+        ramp.process(settle.data(), 512, 2);
+        CHECK_EQ(settle[0], 0);
+        CHECK_EQ(settle[511 * 2], 0);
+        ramp.setVolume(100);
+        std::vector<int16_t> up(1000 * 2, -32768);
+        for (size_t f = 0; f < 1000; f += 64)
+        {
+            ramp.process(&up[f * 2], std::min((size_t)64, 1000 - f), 2);
+        }
+        bool inRange = true;
+        for (size_t f = 1; f < 1000; f++)
+        {
+            inRange &= up[f * 2] <= 0 && up[f * 2] <= up[(f - 1) * 2];
+        }
+        CHECK(inRange);
+        CHECK(up[0] > -512);
+        CHECK_EQ(up[999 * 2], -32768);
+    }
+
+    return checkResult();
+}
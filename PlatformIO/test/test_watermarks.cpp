@@ -0,0 +1,180 @@
+// The watermark callbacks of SpscRingBuffer and of Esp32RingBuffer on the host ring buffer:
+// onFilled on every push which leaves the high watermark buffered, onDrained only when a pop
+// or clear crosses the low watermark, neither for the ISR methods nor the spans. Then a
+// producer and a consumer thread which wait for each other on the callbacks alone, the way
+// playback waits for PLAY and SPACE, and how long the wake ups take.
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "check.h"
+#include "Esp32RingBuffer.h"
+#include "SpscRingBuffer.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static int filledCalls = 0;
+static int drainedCalls = 0;
+static void countFilled() { filledCalls++; }
+static void countDrained() { drainedCalls++; }
+
+// an event group bit, set by the callbacks, waited for and cleared by the other side
+struct Event
+{
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool set = false;
+    Clock::time_point setAt;
+
+    void signal()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            set = true;
+            setAt = Clock::now();
+        }
+        changed.notify_all();
+    }
+
+    // wait for the bit and clear it, returns the microseconds since it was set
+    double wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait_for(lock, std::chrono::seconds(1), [this] { return set; });
+        set = false;
+        return std::chrono::duration<double, std::micro>(Clock::now() - setAt).count();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        set = false;
+    }
+};
+
+static Event play;
+static Event space;
+static void signalPlay() { play.signal(); }
+static void signalSpace() { space.signal(); }
+
+template <typename Ring>
+static void callbacks(const char *name)
+{
+    Ring ring;
+    uint8_t bytes[64] = {0};
+    uint16_t out[32];
+    filledCalls = drainedCalls = 0;
+    ring.setWatermarks(48, countFilled, 16, countDrained);
+
+    // below the high watermark nothing, at and above it every push
+    CHECK(ring.push(bytes, 40));
+    CHECK_EQ(filledCalls, 0);
+    CHECK(ring.push(bytes, 8));
+    CHECK_EQ(filledCalls, 1);
+    CHECK(ring.push(bytes[0]));
+    CHECK_EQ(filledCalls, 2);
+    CHECK(ring.pushFromISR(bytes, 4));
+    CHECK_EQ(filledCalls, 2);
+
+    // 53 bytes, pops which stay above 16 do not drain, the one crossing it does, once
+    CHECK_EQ(ring.popInto(out, 10), 10);
+    CHECK_EQ(drainedCalls, 0);
+    CHECK_EQ(ring.popInto(out, 8), 8);
+    CHECK_EQ(drainedCalls, 0);
+    CHECK_EQ(ring.popInto(out, 2), 2);
+    CHECK_EQ(drainedCalls, 1);
+    CHECK_EQ(ring.popInto(out, 1), 1);
+    CHECK_EQ(drainedCalls, 1);
+
+    // the ISR pop does not call back, a clear from above the watermark does
+    CHECK(ring.push(bytes, 20));
+    CHECK(ring.popFromISR(out[0]));
+    CHECK_EQ(drainedCalls, 1);
+    ring.clear();
+    CHECK_EQ(drainedCalls, 2);
+    CHECK(ring.isEmpty());
+    ring.clear();
+    CHECK_EQ(drainedCalls, 2);
+
+    // a moved low watermark counts from then on
+    CHECK(ring.push(bytes, 40));
+    ring.setLowWatermark(30);
+    CHECK_EQ(ring.popInto(out, 5), 5);
+    CHECK_EQ(drainedCalls, 3);
+    printf("%-16s %d filled, %d drained\n", name, filledCalls, drainedCalls);
+}
+
+// the spans move data without the callbacks
+static void spans()
+{
+    SpscRingBuffer<uint8_t, uint16_t, 64> ring;
+    filledCalls = drainedCalls = 0;
+    ring.setWatermarks(16, countFilled, 8, countDrained);
+    size_t n;
+    ring.writeSpan(n);
+    ring.commitWrite(32);
+    ring.readSpan(n);
+    ring.commitRead(32);
+    CHECK_EQ(filledCalls, 0);
+    CHECK_EQ(drainedCalls, 0);
+}
+
+// playback: the consumer starts once the high watermark is reached and pops 512 bytes per
+// period, the producer pushes 1460 byte chunks and waits for room only through onDrained
+template <typename Ring>
+static void wakeups(const char *name)
+{
+    static const size_t TOTAL = 1 << 20;
+    static const size_t CHUNK = 1460;
+    Ring ring;
+    play.clear();
+    space.clear();
+    ring.setWatermarks(8000, signalPlay, 0, signalSpace);
+    double started = 0;
+    std::vector<double> resumed;
+    std::thread consumer([&] {
+        uint16_t out[256];
+        started = play.wait();
+        size_t received = 0;
+        Clock::time_point next = Clock::now();
+        while (received < TOTAL)
+        {
+            next += std::chrono::microseconds(20);
+            std::this_thread::sleep_until(next);
+            received += ring.popInto(out, 256) * sizeof(uint16_t);
+        }
+    });
+    std::vector<uint8_t> chunk(CHUNK);
+    for (size_t sent = 0; sent < TOTAL; sent += CHUNK)
+    {
+        const size_t n = std::min(CHUNK, TOTAL - sent);
+        // as push_i2s_data: wake up when the chunk fits
+        ring.setLowWatermark(ring.maxSize() - n);
+        space.clear();
+        while (!ring.push(chunk.data(), n))
+        {
+            resumed.push_back(space.wait());
+        }
+    }
+    consumer.join();
+    std::sort(resumed.begin(), resumed.end());
+    const double median = resumed.empty() ? 0 : resumed[resumed.size() / 2];
+    const double longest = resumed.empty() ? 0 : resumed.back();
+    printf("%-16s consumer started %.0f us after the watermark, producer waited %zu times, woken after %.0f us median\n", name, started, resumed.size(), median);
+    // a missed wake up shows as the one second timeout. Esp32RingBuffer mostly waits for room
+    // inside the send timeout of the FreeRTOS ring buffer instead
+    CHECK(started < 500000);
+    CHECK(longest < 500000);
+}
+
+int main()
+{
+    callbacks<SpscRingBuffer<uint8_t, uint16_t, 32>>("SpscRingBuffer");
+    callbacks<Esp32RingBuffer<uint8_t, uint16_t, 32>>("Esp32RingBuffer");
+    spans();
+    wakeups<SpscRingBuffer<uint8_t, uint16_t, 1 << 14>>("SpscRingBuffer");
+    wakeups<Esp32RingBuffer<uint8_t, uint16_t, 1 << 14>>("Esp32RingBuffer");
+    return checkResult();
+}
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Report gaps, reordering and one-way latency of satellite audio per site.
+
+Subscribes to <siteid>/audioStats of all satellites, which publish it once enabled with
+{"audio_stats":"true"} on <siteid>/audio. Latency is the time the stats message arrives
+here minus the capture time on the satellite, so this host should sync its clock with
+the same NTP server as the satellites.
+
+usage: audio_stats.py [--host HOST] [--port PORT] [--user USER] [--password PASSWORD] [--interval SECONDS]
+"""
+import argparse
+import json
+import threading
+import time
+
+import paho.mqtt.client as mqtt
+
+
+class SiteStats:
+    def __init__(self):
+        self.reset()
+        self.last_seq = None
+
+    def reset(self):
+        self.frames = 0
+        self.missing = 0
+        self.reordered = 0
+        self.unsynced = 0
+        self.latencies = []
+        self.dropped = 0
+
+    def add(self, stats, received_us):
+        seq = stats["seq"]
+        if self.last_seq is not None:
+            if seq > self.last_seq:
+                self.missing += seq - self.last_seq - 1
+            else:
+                self.reordered += 1
+        if self.last_seq is None or seq > self.last_seq:
+            self.last_seq = seq
+        self.frames += 1
+        self.dropped = stats.get("dropped", 0)
+        if stats.get("synced"):
+            self.latencies.append((received_us - stats["captured_us"]) / 1000.0)
+        else:
+            self.unsynced += 1
+
+
+def percentile(values, p):
+    index = min(len(values) - 1, int(round(p / 100.0 * (len(values) - 1))))
+    return values[index]
+
+
+def report(sites, lock):
+    with lock:
+        for site, stats in sorted(sites.items()):
+            line = "%-16s frames %5d missing %4d reordered %3d dropped on device %5d" % (
+                site, stats.frames, stats.missing, stats.reordered, stats.dropped)
+            if stats.latencies:
+                latencies = sorted(stats.latencies)
+                line += " latency ms min %.1f p50 %.1f p90 %.1f p99 %.1f max %.1f" % (
+                    latencies[0], percentile(latencies, 50), percentile(latencies, 90),
+                    percentile(latencies, 99), latencies[-1])
+            if stats.unsynced:
+                line += " (%d frames without synced clock)" % stats.unsynced
+            print(line)
+            stats.reset()
+    print(flush=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="localhost")
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--user")
+    parser.add_argument("--password")
+    parser.add_argument("--interval", type=float, default=10.0, help="seconds between reports")
+    args = parser.parse_args()
+
+    sites = {}
+    lock = threading.Lock()
+
+    def on_connect(client, userdata, flags, rc):
+        client.subscribe("+/audioStats")
+
+    def on_message(client, userdata, msg):
+        received_us = int(time.time() * 1000000)
+        site = msg.topic.split("/")[0]
+        try:
+            stats = json.loads(msg.payload)
+        except ValueError:
+            return
+        with lock:
+            sites.setdefault(site, SiteStats()).add(stats, received_us)
+
+    client = mqtt.Client()
+    if args.user:
+        client.username_pw_set(args.user, args.password)
+    client.on_connect = on_connect
+    client.on_message = on_message
+    client.connect(args.host, args.port)
+    client.loop_start()
+    try:
+        while True:
+            time.sleep(args.interval)
+            report(sites, lock)
+    except KeyboardInterrupt:
+        client.loop_stop()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""Generate src/PolyphaseTables.h, the filters of PolyphaseResampler.
+
+For every pair of input and output rate the ratio is reduced to up/down, a Kaiser windowed
+sinc low pass is designed at up times the input rate and split into up phases of taps
+coefficients each, in Q15. Every phase is scaled to a sum of exactly 32768, so a constant
+input comes out unchanged. Run it again after changing the rates or the filter parameters.
+
+The playback filters have TAPS taps. The capture filters take the mic down to the 16 kHz of
+the audioFrames, when the codec runs at the playback rate. They get as many taps as their
+transition band from CAPTURE_PASS to CAPTURE_STOP needs at the input rate.
+
+usage: gen_polyphase.py [--output PATH]
+"""
+import argparse
+import math
+import os
+
+# only the pairs a device resamples, every table stays in flash: the Matrix Voice plays at
+# 44.1 kHz, the other devices play at the rate of the WAV
+INPUT_RATES = [16000, 22050, 24000]
+OUTPUT_RATES = [44100]
+TAPS = 16
+# Kaiser beta, about 70 dB stop band attenuation
+BETA = 7.0
+# pass band edge as a fraction of the lower Nyquist frequency
+CUTOFF = 0.9
+
+# the AudioKit clocks the ES8388 at the rate of what it plays, 48 kHz included
+CAPTURE_INPUT_RATES = [22050, 24000, 32000, 44100, 48000]
+CAPTURE_OUTPUT_RATE = 16000
+# pass band and stop band edge in Hz, what is above 8 kHz only aliases down to 7.2 kHz
+CAPTURE_PASS = 6000
+CAPTURE_STOP = 8800
+# stop band attenuation of BETA in dB
+ATTENUATION = BETA / 0.1102 + 8.7
+
+
+def capture_taps(in_rate):
+    width = 2.0 * math.pi * (CAPTURE_STOP - CAPTURE_PASS) / in_rate
+    taps = int(math.ceil((ATTENUATION - 8.0) / (2.285 * width)))
+    return (taps + 7) // 8 * 8
+
+
+def bessel_i0(x):
+    total = 1.0
+    term = 1.0
+    k = 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def design(up, taps, fc):
+    """fc is the cutoff relative to the upsampled rate"""
+    length = up * taps
+    center = (length - 1) / 2.0
+    h = []
+    for n in range(length):
+        t = n - center
+        sinc = 2.0 * fc if t == 0 else math.sin(2.0 * math.pi * fc * t) / (math.pi * t)
+        window = bessel_i0(BETA * math.sqrt(max(0.0, 1.0 - (t / center) ** 2))) / bessel_i0(BETA)
+        h.append(sinc * window)
+    phases = []
+    for p in range(up):
+        # phase p takes every up-th coefficient, tap k multiplies the input k samples back
+        coefficients = [h[p + k * up] for k in range(taps)]
+        total = sum(coefficients)
+        q15 = [int(round(c / total * 32768)) for c in coefficients]
+        # push the rounding error into the largest tap, so the phase sums to 32768
+        q15[q15.index(max(q15))] += 32768 - sum(q15)
+        phases.append(q15)
+    return phases
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    default = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "PolyphaseTables.h")
+    parser.add_argument("--output", default=default)
+    args = parser.parse_args()
+
+    filters = []
+    for in_rate in INPUT_RATES:
+        for out_rate in OUTPUT_RATES:
+            g = math.gcd(in_rate, out_rate)
+            up, down = out_rate // g, in_rate // g
+            filters.append((in_rate, out_rate, up, down, TAPS, CUTOFF * 0.5 / max(up, down)))
+    for in_rate in CAPTURE_INPUT_RATES:
+        g = math.gcd(in_rate, CAPTURE_OUTPUT_RATE)
+        up, down = CAPTURE_OUTPUT_RATE // g, in_rate // g
+        fc = (CAPTURE_PASS + CAPTURE_STOP) / 2.0 / (up * in_rate)
+        filters.append((in_rate, CAPTURE_OUTPUT_RATE, up, down, capture_taps(in_rate), fc))
+
+    lines = [
+        "#pragma once",
+        "// Generated by tools/gen_polyphase.py, do not edit",
+        "#include <stdint.h>",
+        "",
+        "const int POLYPHASE_MAX_TAPS = %d;" % max(f[4] for f in filters),
+        "",
+    ]
+    entries = []
+    for in_rate, out_rate, up, down, taps, fc in filters:
+        name = "polyphase_%d_%d" % (in_rate, out_rate)
+        lines.append("// %d Hz to %d Hz, %d phases of %d taps" % (in_rate, out_rate, up, taps))
+        lines.append("const int16_t %s[%d][%d] = {" % (name, up, taps))
+        for phase in design(up, taps, fc):
+            lines.append("    {" + ", ".join(str(c) for c in phase) + "},")
+        lines.append("};")
+        lines.append("")
+        entries.append("    {%d, %d, %d, %d, %d, &%s[0][0]}," % (in_rate, out_rate, up, down, taps, name))
+    lines.append("struct PolyphaseTable {")
+    lines.append("    int inRate;")
+    lines.append("    int outRate;")
+    lines.append("    int up;")
+    lines.append("    int down;")
+    lines.append("    int taps;")
+    lines.append("    const int16_t *coefficients; // up phases of taps")
+    lines.append("};")
+    lines.append("")
+    lines.append("const PolyphaseTable polyphaseTables[] = {")
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("")
+    with open(args.output, "w") as out:
+        out.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
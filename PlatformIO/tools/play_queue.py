@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Send several WAV files as playBytes right after each other and check they all play in order.
+
+Every file is published as its own playBytes request without waiting for the one before, the
+way Rhasspy sends a chime followed by the TTS reply. The satellite queues them and reports a
+playFinished for each, this prints when each one arrived and whether the order was kept.
+With --streaming every other request is sent as playBytesStreaming chunks instead.
+
+usage: play_queue.py --site SITEID file.wav [file.wav ...] [--host HOST] [--port PORT] [--streaming]
+"""
+import argparse
+import io
+import json
+import threading
+import time
+import uuid
+import wave
+
+import paho.mqtt.client as mqtt
+
+
+def streaming_chunks(path, chunk_ms=250):
+    with wave.open(path, "rb") as wav:
+        params = wav.getparams()
+        frames_per_chunk = max(1, params.framerate * chunk_ms // 1000)
+        chunks = []
+        while True:
+            frames = wav.readframes(frames_per_chunk)
+            if not frames:
+                break
+            out = io.BytesIO()
+            with wave.open(out, "wb") as chunk:
+                chunk.setnchannels(params.nchannels)
+                chunk.setsampwidth(params.sampwidth)
+                chunk.setframerate(params.framerate)
+                chunk.writeframes(frames)
+            chunks.append(out.getvalue())
+        return chunks
+
+
+def duration(path):
+    with wave.open(path, "rb") as wav:
+        return wav.getnframes() / wav.getframerate()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("files", nargs="+")
+    parser.add_argument("--site", required=True)
+    parser.add_argument("--host", default="localhost")
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--user")
+    parser.add_argument("--password")
+    parser.add_argument("--streaming", action="store_true", help="send every other file as playBytesStreaming")
+    args = parser.parse_args()
+
+    ids = [str(uuid.uuid4()) for _ in args.files]
+    finished = []
+    done = threading.Event()
+    lock = threading.Lock()
+
+    def on_message(client, userdata, msg):
+        try:
+            request_id = json.loads(msg.payload).get("id")
+        except ValueError:
+            return
+        if request_id in ids:
+            with lock:
+                finished.append((request_id, time.time()))
+                if len(finished) == len(ids):
+                    done.set()
+
+    client = mqtt.Client()
+    if args.user:
+        client.username_pw_set(args.user, args.password)
+    client.on_message = on_message
+    client.connect(args.host, args.port)
+    client.subscribe("hermes/audioServer/%s/playFinished" % args.site)
+    client.loop_start()
+    time.sleep(0.5)
+
+    start = time.time()
+    for index, (path, request_id) in enumerate(zip(args.files, ids)):
+        if args.streaming and index % 2 == 1:
+            chunks = streaming_chunks(path)
+            for chunk_index, chunk in enumerate(chunks):
+                last = "true" if chunk_index == len(chunks) - 1 else "false"
+                topic = "hermes/audioServer/%s/playBytesStreaming/%s/%d/%s" % (args.site, request_id, chunk_index, last)
+                client.publish(topic, chunk)
+        else:
+            with open(path, "rb") as wav:
+                client.publish("hermes/audioServer/%s/playBytes/%s" % (args.site, request_id), wav.read())
+
+    total = sum(duration(path) for path in args.files)
+    done.wait(total + 30)
+    client.loop_stop()
+
+    expected = 0.0
+    for path, request_id in zip(args.files, ids):
+        expected += duration(path)
+        times = [t for i, t in finished if i == request_id]
+        if times:
+            print("%-30s playFinished after %6.2f s, %6.2f s of audio up to here" % (path, times[0] - start, expected))
+        else:
+            print("%-30s no playFinished" % path)
+    order = [i for i, _ in finished]
+    print("order kept" if order == [i for i in ids if i in order] else "order NOT kept")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Replay a WAV file as a chunked playBytesStreaming request and time the playback.
+
+The file is split into chunks of --chunk-ms, each sent as a WAV of its own, paced like a
+TTS engine producing --speed times faster than real time. The satellite reports
+playFinished once the last chunk has played, the time to that minus the audio duration
+is the start latency plus any time lost to underruns.
+
+usage: play_streaming.py --site SITEID file.wav [--host HOST] [--port PORT] [--chunk-ms MS] [--speed FACTOR]
+"""
+import argparse
+import io
+import json
+import threading
+import time
+import uuid
+import wave
+
+import paho.mqtt.client as mqtt
+
+
+def chunk_wavs(path, chunk_ms):
+    with wave.open(path, "rb") as wav:
+        params = wav.getparams()
+        frames_per_chunk = max(1, params.framerate * chunk_ms // 1000)
+        while True:
+            frames = wav.readframes(frames_per_chunk)
+            if not frames:
+                break
+            out = io.BytesIO()
+            with wave.open(out, "wb") as chunk:
+                chunk.setnchannels(params.nchannels)
+                chunk.setsampwidth(params.sampwidth)
+                chunk.setframerate(params.framerate)
+                chunk.writeframes(frames)
+            yield out.getvalue(), len(frames) / (params.sampwidth * params.nchannels) / params.framerate
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file")
+    parser.add_argument("--site", required=True)
+    parser.add_argument("--host", default="localhost")
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--user")
+    parser.add_argument("--password")
+    parser.add_argument("--chunk-ms", type=int, default=500)
+    parser.add_argument("--speed", type=float, default=4.0, help="how much faster than real time chunks are sent")
+    args = parser.parse_args()
+
+    request_id = str(uuid.uuid4())
+    finished = threading.Event()
+
+    def on_message(client, userdata, msg):
+        try:
+            if json.loads(msg.payload).get("id") == request_id:
+                finished.set()
+        except ValueError:
+            pass
+
+    client = mqtt.Client()
+    if args.user:
+        client.username_pw_set(args.user, args.password)
+    client.on_message = on_message
+    client.connect(args.host, args.port)
+    client.subscribe("hermes/audioServer/%s/playFinished" % args.site)
+    client.loop_start()
+    time.sleep(0.5)
+
+    chunks = list(chunk_wavs(args.file, args.chunk_ms))
+    duration = sum(seconds for _, seconds in chunks)
+    start = time.time()
+    for index, (payload, seconds) in enumerate(chunks):
+        last = "true" if index == len(chunks) - 1 else "false"
+        topic = "hermes/audioServer/%s/playBytesStreaming/%s/%d/%s" % (args.site, request_id, index, last)
+        client.publish(topic, payload)
+        if index == 0:
+            print("first chunk sent after %.3f s" % (time.time() - start))
+        time.sleep(seconds / args.speed)
+
+    if finished.wait(duration + 30):
+        elapsed = time.time() - start
+        print("%d chunks, %.2f s of audio, playFinished after %.2f s" % (len(chunks), duration, elapsed))
+        print("start latency and underruns: %.2f s" % (elapsed - duration))
+    else:
+        print("no playFinished received")
+    client.loop_stop()
+
+
+if __name__ == "__main__":
+    main()